@@ -0,0 +1,355 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <bit>        // For std::bit_width
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>    // For std::getenv
+#include <filesystem>
+#include <functional>
+#include <memory>     // For std::unique_ptr
+#include <random>     // For random numbers
+#include <string>
+#include <thread>
+#include <utility>    // For std::pair
+#include <vector>
+
+#include "data_structure/pq_indexed_dary.h"  // Dijkstra for the rank buckets
+#include "demo/astar.h"                     // Engine instantiations with GreatCircleHeuristic
+#include "demo/search_context.h"            // SearchContext::INF
+#include "road_network.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>  // Hardware cache-miss counter
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// --- Configuration ---
+// Road networks written by convert_graphml_to_binary.py next to their GraphML files.
+// ASTAR_BENCHMARK_DATA_DIR overrides the directory compiled in by CMake.
+#ifndef OSM_DATA_DIR
+#define OSM_DATA_DIR "../osm_data"
+#endif
+
+struct City
+{
+    const char *name;
+    const char *file;
+};
+
+const City CITIES[] = {
+    {"Shinjuku", "shinjuku_tokyo_drive_simplified.rnet"},
+    {"London", "london_drive_simplified.rnet"},
+};
+
+// Node orders every city is benchmarked in (RoadNetwork::reordered of the mapped file)
+struct Layout
+{
+    const char *name;
+    NodeOrder order;
+};
+
+const Layout LAYOUTS[] = {
+    {"id", NodeOrder::Id},
+    {"hilbert", NodeOrder::Hilbert},
+    {"bfs", NodeOrder::BreadthFirst},
+    {"rcm", NodeOrder::ReverseCuthillMcKee},
+};
+
+// Queries of Dijkstra rank 2^r for r in [MIN_RANK, log2(num_nodes)]: the goal is the
+// 2^r-th node a Dijkstra from the start settles, so bucket r holds queries of a similar
+// search-space size whatever the geometry of the network.
+const int MIN_RANK = 6;
+const size_t QUERIES_PER_RANK = 32;
+const unsigned QUERY_SEED = 42;
+
+// --- Query Generation ---
+using Query = std::pair<long long, long long>;
+
+// Seeded random (start, goal) OSM id pairs, grouped by Dijkstra rank (index r - MIN_RANK)
+std::vector<std::vector<Query>> generate_rank_queries(const RoadNetwork &network, unsigned seed)
+{
+    const size_t n = network.num_nodes();
+    const int max_rank = static_cast<int>(std::bit_width(n)) - 1;
+    std::vector<std::vector<Query>> buckets(std::max(0, max_rank - MIN_RANK + 1));
+    if (buckets.empty())
+        return buckets;
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<NodeIndex> node_dist(0, static_cast<NodeIndex>(n - 1));
+    DataStructure::PriorityQueue::IndexedDaryHeap<4, double, std::greater<double>> heap(n);
+    std::vector<double> dist(n);
+
+    // One Dijkstra per start fills every bucket its search space reaches; starts whose
+    // component is too small for the largest rank leave that bucket short, so retry
+    // a bounded number of times
+    for (size_t attempt = 0; attempt < 8 * QUERIES_PER_RANK; ++attempt)
+    {
+        bool full = true;
+        for (const auto &bucket : buckets)
+            full = full && bucket.size() >= QUERIES_PER_RANK;
+        if (full)
+            break;
+
+        const NodeIndex start = node_dist(gen);
+        std::fill(dist.begin(), dist.end(), SearchContext::INF);
+        heap.clear();
+        dist[start] = 0.0;
+        heap.push(start, 0.0);
+        size_t settled = 0;
+        while (!heap.empty())
+        {
+            auto [u, d] = heap.pop();
+            ++settled;
+            if (std::has_single_bit(settled))
+            {
+                const int rank = static_cast<int>(std::bit_width(settled)) - 1;
+                if (rank >= MIN_RANK && buckets[rank - MIN_RANK].size() < QUERIES_PER_RANK)
+                    buckets[rank - MIN_RANK].push_back({network.id_of(start), network.id_of(u)});
+            }
+            for (EdgeIndex e = network.edge_begin(u); e < network.edge_end(u); ++e)
+            {
+                NodeIndex v = network.edge_target(e);
+                double candidate = d + network.edge_weight(e);
+                if (candidate < dist[v])
+                {
+                    dist[v] = candidate;
+                    heap.push_or_decrease(v, candidate);
+                }
+            }
+        }
+    }
+    return buckets;
+}
+
+// --- Engines ---
+// Every A* engine as a uniform callable; sequential engines ignore the thread count
+using Heuristic = AStarEngine::GreatCircleHeuristic;
+using Cost = AStarEngine::EdgeWeightCost;
+
+template <class Stats>
+using EngineFn = std::vector<long long> (*)(const RoadNetwork &, long long, long long, int, Stats &);
+
+struct Engine
+{
+    const char *name;
+    bool parallel;  // Swept over thread counts; otherwise run once with its fixed parallelism
+    EngineFn<AStarEngine::NoStats> run;
+    EngineFn<AStarEngine::StatsRecorder> run_with_stats;
+};
+
+template <class Stats>
+std::vector<long long> sequential(const RoadNetwork &network, long long start, long long goal, int, Stats &stats)
+{
+    return AStarEngine::search<Heuristic, Cost, AStarEngine::DefaultOpenSet>(network, start, goal, stats);
+}
+
+template <class Stats>
+std::vector<long long> bidirectional(const RoadNetwork &network, long long start, long long goal, int, Stats &stats)
+{
+    return AStarEngine::search_bidirectional<Heuristic, Cost>(network, start, goal, stats);
+}
+
+#define PARALLEL_ENGINE(NAME)                                                                              \
+    {#NAME, true, &AStarEngine::search_##NAME<Heuristic, Cost, AStarEngine::NoStats>,                      \
+     &AStarEngine::search_##NAME<Heuristic, Cost, AStarEngine::StatsRecorder>}
+
+const Engine ENGINES[] = {
+    {"Sequential", false, &sequential<AStarEngine::NoStats>, &sequential<AStarEngine::StatsRecorder>},
+    {"Bidirectional", false, &bidirectional<AStarEngine::NoStats>, &bidirectional<AStarEngine::StatsRecorder>},
+    PARALLEL_ENGINE(TPool_CppLib),
+    PARALLEL_ENGINE(TVector_CppLib),
+    PARALLEL_ENGINE(TPool_PqFine),
+    PARALLEL_ENGINE(TVector_PqFine),
+    PARALLEL_ENGINE(TPool_MultiQueue),
+    PARALLEL_ENGINE(TVector_MultiQueue),
+    PARALLEL_ENGINE(HDA),
+};
+
+#undef PARALLEL_ENGINE
+
+// 1, 2, 4, ... up to the hardware concurrency (always including it)
+std::vector<int> thread_sweep()
+{
+    const int hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> counts;
+    for (int threads = 1; threads < hardware; threads *= 2)
+        counts.push_back(threads);
+    counts.push_back(hardware);
+    return counts;
+}
+
+// --- Cache Misses ---
+// Last-level cache misses of the calling thread (perf_event_open, user space only). Worker
+// threads of the parallel engines are not counted, so compare layouts per engine. Where
+// the kernel refuses the counter (no PMU, perf_event_paranoid) it stays unavailable and
+// the benchmarks report no cache_misses.
+class CacheMissCounter
+{
+public:
+    CacheMissCounter()
+    {
+#ifdef __linux__
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter()
+    {
+#ifdef __linux__
+        if (fd_ >= 0)
+            close(fd_);
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter &) = delete;
+    CacheMissCounter &operator=(const CacheMissCounter &) = delete;
+
+    bool available() const { return fd_ >= 0; }
+
+    void start()
+    {
+#ifdef __linux__
+        if (fd_ >= 0)
+        {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Misses since start()
+    std::uint64_t stop()
+    {
+        std::uint64_t count = 0;
+#ifdef __linux__
+        if (fd_ >= 0)
+        {
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count)))
+                count = 0;
+        }
+#endif
+        return count;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+// --- Benchmark Definition ---
+// One iteration answers one query of the bucket (cycling through it): the time per
+// iteration is the query latency at that Dijkstra rank. A pass over the bucket with a
+// StatsRecorder first warms the caches and yields the per-query search counters;
+// cache_misses is the per-query miss count of the timed loop.
+void BM_AStarRankQuery(benchmark::State &state, const RoadNetwork *network, const Engine *engine,
+                       const std::vector<Query> *queries)
+{
+    const int threads = static_cast<int>(state.range(1));
+
+    AStarEngine::SearchStats totals;
+    for (const auto &[start, goal] : *queries)
+    {
+        AStarEngine::StatsRecorder stats;
+        benchmark::DoNotOptimize(engine->run_with_stats(*network, start, goal, threads, stats));
+        const AStarEngine::SearchStats query = stats.result();
+        totals.expanded += query.expanded;
+        totals.reopened += query.reopened;
+        totals.pushes += query.pushes;
+        totals.peak_open = std::max(totals.peak_open, query.peak_open);
+    }
+
+    AStarEngine::NoStats no_stats;
+    CacheMissCounter cache_misses;
+    size_t next = 0;
+    cache_misses.start();
+    for (auto _ : state)
+    {
+        const auto &[start, goal] = (*queries)[next];
+        next = (next + 1) % queries->size();
+        benchmark::DoNotOptimize(engine->run(*network, start, goal, threads, no_stats));
+    }
+    const std::uint64_t misses = cache_misses.stop();
+    state.SetItemsProcessed(state.iterations());
+    if (cache_misses.available())
+        state.counters["cache_misses"] =
+            benchmark::Counter(static_cast<double>(misses), benchmark::Counter::kAvgIterations);
+
+    const double count = static_cast<double>(queries->size());
+    state.counters["expanded"] = static_cast<double>(totals.expanded) / count;
+    state.counters["reopened"] = static_cast<double>(totals.reopened) / count;
+    state.counters["pushes"] = static_cast<double>(totals.pushes) / count;
+    state.counters["peak_open"] = static_cast<double>(totals.peak_open);
+}
+
+// --- Main Function ---
+// Registers one benchmark per city, layout, engine, rank bucket and thread count, named
+// BM_<engine>/<city>_<layout>_rank<r>/rank:<r>/threads:<t>. The queries of a city are the
+// same OSM id pairs in every layout. plot_benchmarks.py groups by engine and thread count,
+// so plot one city, layout and bucket at a time, e.g. with
+// --benchmark_filter=Shinjuku_hilbert_rank12/.
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+
+    const char *data_dir_override = std::getenv("ASTAR_BENCHMARK_DATA_DIR");
+    const std::filesystem::path data_dir = data_dir_override ? data_dir_override : OSM_DATA_DIR;
+    const std::vector<int> sweep = thread_sweep();
+
+    // Networks and queries live until the benchmarks have run
+    std::vector<std::unique_ptr<RoadNetwork>> networks;
+    std::vector<std::unique_ptr<std::vector<std::vector<Query>>>> query_sets;
+
+    for (const City &city : CITIES)
+    {
+        const std::filesystem::path path = data_dir / city.file;
+        if (!std::filesystem::exists(path))
+        {
+            std::fprintf(stderr, "Skipping %s: %s not found (run convert_graphml_to_binary.py)\n", city.name,
+                         path.string().c_str());
+            continue;
+        }
+        const RoadNetwork mapped = RoadNetwork::open_mmap(path.string());
+        query_sets.push_back(
+            std::make_unique<std::vector<std::vector<Query>>>(generate_rank_queries(mapped, QUERY_SEED)));
+
+        for (const Layout &layout : LAYOUTS)
+        {
+            networks.push_back(std::make_unique<RoadNetwork>(mapped.reordered(layout.order)));
+            const RoadNetwork *network = networks.back().get();
+
+            for (const Engine &engine : ENGINES)
+            {
+                for (size_t bucket = 0; bucket < query_sets.back()->size(); ++bucket)
+                {
+                    const std::vector<Query> *queries = &(*query_sets.back())[bucket];
+                    if (queries->empty())
+                        continue;
+                    const int rank = MIN_RANK + static_cast<int>(bucket);
+                    const std::string name = std::string("BM_") + engine.name + "/" + city.name + "_" +
+                                             layout.name + "_rank" + std::to_string(rank);
+                    auto *registered = benchmark::RegisterBenchmark(name.c_str(), BM_AStarRankQuery, network,
+                                                                    &engine, queries);
+                    registered->ArgNames({"rank", "threads"})->Unit(benchmark::kMillisecond);
+                    if (engine.parallel)
+                        for (int threads : sweep)
+                            registered->Args({rank, threads});
+                    else
+                        registered->Args({rank, std::string(engine.name) == "Bidirectional" ? 2 : 1});
+                }
+            }
+        }
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
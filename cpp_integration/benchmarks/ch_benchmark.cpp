@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <memory>   // For std::unique_ptr
+#include <random>   // For random numbers
+#include <utility>  // For std::pair
+#include <vector>
+
+#include "demo/astar.h"                  // AStar::search
+#include "demo/contraction_hierarchy.h"  // CH::ContractionHierarchy
+#include "road_network.h"
+
+// --- Configuration ---
+// A synthetic road grid: GRID_SIDE x GRID_SIDE intersections about 100 m apart,
+// EDGE_DROP_RATIO of the street segments missing and weights of 1.0-1.5x the
+// straight-line length, so shortest paths are not unique Manhattan staircases.
+const int GRID_SIDE = 100;
+const double EDGE_DROP_RATIO = 0.10;
+const size_t NUM_QUERIES = 256;
+const double EXECUTION_WARMUP_SECONDS = 0.25;
+
+// --- Network and Query Helpers ---
+std::unique_ptr<RoadNetwork> build_grid_network(int side, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> detour(1.0, 1.5);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+
+    std::vector<long long> node_ids, sources, targets;
+    std::vector<double> lats, lons, weights;
+    for (int y = 0; y < side; ++y)
+    {
+        for (int x = 0; x < side; ++x)
+        {
+            node_ids.push_back(y * side + x);
+            lats.push_back(51.5 + y * 0.0009);   // ~100 m per row
+            lons.push_back(-0.1 + x * 0.0014);   // ~100 m per column at London's latitude
+        }
+    }
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+    for (int y = 0; y < side; ++y)
+    {
+        for (int x = 0; x < side; ++x)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                int nx = x + dx[k], ny = y + dy[k];
+                if (nx < 0 || ny < 0 || nx >= side || ny >= side || coin(gen) < EDGE_DROP_RATIO)
+                    continue;
+                sources.push_back(y * side + x);
+                targets.push_back(ny * side + nx);
+                weights.push_back(100.0 * std::hypot(dx[k], dy[k]) * detour(gen));
+            }
+        }
+    }
+    return std::make_unique<RoadNetwork>(node_ids, lats, lons, sources, targets, weights);
+}
+
+std::vector<std::pair<long long, long long>> generate_queries(size_t count, int side, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<long long> node_dist(0, static_cast<long long>(side) * side - 1);
+    std::vector<std::pair<long long, long long>> queries;
+    queries.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        queries.push_back({node_dist(gen), node_dist(gen)});
+    return queries;
+}
+
+// --- Globally Built Inputs ---
+// Built once so both benchmarks answer the same queries on the same network; the
+// hierarchy's preprocessing time is not part of the query latency measured below
+const std::unique_ptr<RoadNetwork> NETWORK = build_grid_network(GRID_SIDE, 42);
+const std::vector<std::pair<long long, long long>> QUERIES = generate_queries(NUM_QUERIES, GRID_SIDE, 7);
+
+const CH::ContractionHierarchy &hierarchy()
+{
+    static const CH::ContractionHierarchy ch = CH::ContractionHierarchy::build(*NETWORK, 0);
+    return ch;
+}
+
+// --- Benchmark Definitions ---
+// One iteration answers one query (cycling through QUERIES): the time per iteration is
+// the point-to-point query latency.
+
+static void BM_AStarQuery(benchmark::State &state)
+{
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        const auto &[start, goal] = QUERIES[next];
+        next = (next + 1) % QUERIES.size();
+        benchmark::DoNotOptimize(AStar::search(*NETWORK, start, goal));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_CHQuery(benchmark::State &state)
+{
+    const CH::ContractionHierarchy &ch = hierarchy();  // Preprocessed outside the timed loop
+    size_t next = 0;
+    for (auto _ : state)
+    {
+        const auto &[start, goal] = QUERIES[next];
+        next = (next + 1) % QUERIES.size();
+        benchmark::DoNotOptimize(ch.search(*NETWORK, start, goal));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["shortcuts"] = static_cast<double>(ch.num_shortcuts());
+}
+
+// --- Register Benchmarks ---
+
+BENCHMARK(BM_AStarQuery)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_CHQuery)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// --- Main Function ---
+BENCHMARK_MAIN();
@@ -0,0 +1,151 @@
+#include <algorithm>  // For std::max
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>         // For std::unique_ptr
+#include <mutex>          // For std::mutex, std::lock_guard
+#include <random>         // For random numbers
+#include <thread>         // For std::thread::hardware_concurrency
+#include <unordered_map>  // Baseline map
+#include <vector>
+
+#include "data_structure/hashmap_concurrent.h"
+
+// --- Configuration ---
+// Models the shared g-score table of a parallel A*: many threads lowering the scores of
+// a node range at once. Most updates lose (the stored score is already smaller), as in
+// a search where a node is relaxed far more often than it improves.
+const size_t NUM_OPERATIONS = 100000;
+const std::uint32_t KEY_RANGE = 10000;
+const double EXECUTION_WARMUP_SECONDS = 0.25;
+
+// --- Define Operation Structure ---
+struct Update
+{
+    std::uint32_t key;
+    std::uint32_t parent;
+    float cost;
+};
+
+// --- Generate Operations Helper ---
+std::vector<Update> generate_updates(size_t count, std::uint32_t key_range)
+{
+    std::vector<Update> updates;
+    updates.reserve(count);
+    std::mt19937 gen(std::random_device{}());  // Seed PRNG
+    std::uniform_int_distribution<std::uint32_t> key_dist(0, key_range - 1);
+    std::uniform_real_distribution<float> cost_dist(0.0f, 1.0e6f);
+
+    for (size_t i = 0; i < count; ++i)
+        updates.push_back({key_dist(gen), key_dist(gen), cost_dist(gen)});
+    return updates;
+}
+
+// Generate the workload once so both maps see the same updates
+const std::vector<Update> FIXED_WORKLOAD = generate_updates(NUM_OPERATIONS, KEY_RANGE);
+
+// --- Baseline: one global mutex around std::unordered_map ---
+// The scheme the fork-join searches used before: every relaxation takes the same lock.
+class MutexHashMap
+{
+private:
+    std::mutex map_mutex;
+    std::unordered_map<std::uint32_t, std::uint64_t> map;
+
+public:
+    explicit MutexHashMap(size_t expected_keys) { map.reserve(expected_keys); }
+
+    bool update_min(std::uint32_t key, std::uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(map_mutex);
+        auto [it, inserted] = map.try_emplace(key, value);
+        if (inserted)
+            return true;
+        if (value < it->second)
+        {
+            it->second = value;
+            return true;
+        }
+        return false;
+    }
+};
+
+using LockFreeHashMap = DataStructure::HashMap::ConcurrentHashMap<std::uint32_t, std::uint64_t>;
+
+// --- Base Benchmark Fixture Definition (with Mutex for SetUp/TearDown safety) ---
+template <typename MapType>
+class HashMapBenchmarkFixture : public ::benchmark::Fixture
+{
+private:
+    std::mutex fixture_mutex;  // Protects fixture setup/teardown if framework calls concurrently
+public:
+    std::unique_ptr<MapType> map_instance;
+
+    void SetUp(const ::benchmark::State & /* state */) override
+    {
+        std::lock_guard<std::mutex> lock(fixture_mutex);
+        if (!map_instance)
+            map_instance = std::make_unique<MapType>(KEY_RANGE);
+    }
+
+    void TearDown(const ::benchmark::State & /* state */) override
+    {
+        std::lock_guard<std::mutex> lock(fixture_mutex);
+        map_instance.reset();
+    }
+};
+
+// Generic benchmark body: each thread applies its slice of the workload
+template <typename MapType>
+void BenchmarkBody(benchmark::State &state, MapType *map)
+{
+    if (!map)
+    {
+        state.SkipWithError("Fixture setup failed - map_instance is null");
+        return;
+    }
+    const size_t num_threads = static_cast<size_t>(state.threads());
+    const size_t ops_per_thread = FIXED_WORKLOAD.size() / num_threads;
+    const size_t start_index = static_cast<size_t>(state.thread_index()) * ops_per_thread;
+    // The last thread processes any remaining operations
+    const size_t end_index = (static_cast<size_t>(state.thread_index()) == num_threads - 1)
+                                 ? FIXED_WORKLOAD.size()
+                                 : start_index + ops_per_thread;
+
+    for (auto _ : state)
+    {
+        for (size_t i = start_index; i < end_index; ++i)
+        {
+            const Update &update = FIXED_WORKLOAD[i];
+            benchmark::DoNotOptimize(map->update_min(
+                update.key, DataStructure::HashMap::pack_score(update.cost, update.parent)));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (end_index - start_index)));
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(HashMapBenchmarkFixture, BM_MutexUnorderedMapUpdateMin, MutexHashMap)
+(benchmark::State &state) { BenchmarkBody(state, this->map_instance.get()); }
+
+BENCHMARK_TEMPLATE_DEFINE_F(HashMapBenchmarkFixture, BM_ConcurrentHashMapUpdateMin, LockFreeHashMap)
+(benchmark::State &state) { BenchmarkBody(state, this->map_instance.get()); }
+
+// --- Register Benchmarks using BENCHMARK_REGISTER_F ---
+
+const int num_hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+
+// Register the global-lock baseline (run for multiple threads)
+BENCHMARK_REGISTER_F(HashMapBenchmarkFixture, BM_MutexUnorderedMapUpdateMin)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Register the lock-free open-addressing map (run for multiple threads)
+BENCHMARK_REGISTER_F(HashMapBenchmarkFixture, BM_ConcurrentHashMapUpdateMin)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// --- Main Function ---
+BENCHMARK_MAIN();
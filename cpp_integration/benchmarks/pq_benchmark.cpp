@@ -1,6 +1,9 @@
 #include <algorithm>  // For std::max
 #include <benchmark/benchmark.h>
+#include <cstdint>     // For std::uint32_t
+#include <functional>  // For std::less
 #include <limits>
+#include <mutex>    // For std::mutex
 #include <queue>    // For std::priority_queue
 #include <random>   // For random numbers
 #include <thread>   // For std::thread::hardware_concurrency
@@ -8,7 +11,10 @@
 #include <vector>
 
 // Include your PQ implementations and interface (though interface isn't strictly needed here)
-#include "data_structure/pq_fine.h"  // Contains SortedLinkedList_FineLockPQ
+#include "data_structure/pq_fine.h"        // Contains SortedLinkedList_FineLockPQ
+#include "data_structure/pq_indexed_dary.h"  // Contains IndexedDaryHeap
+#include "data_structure/pq_multiqueue.h"  // Contains MultiQueuePQ
+#include "data_structure/spin_lock.h"      // Contains SpinLock (1-byte node lock)
 
 // --- Configuration & Test Element Setup ---
 using TestPQElement = std::pair<int, int>;  // {priority, sequence_id}
@@ -98,11 +104,14 @@ const std::vector<PQOperation> PQ_FIXED_WORKLOAD =
     generate_pq_operations(PQ_NUM_OPERATIONS, PQ_VALUE_RANGE, PQ_PUSH_RATIO);
 
 // --- Benchmark for Custom Fine-Grained Priority Queue ---
+// Lock is the per-node lock: std::mutex (40 bytes) or SpinLock (1 byte)
+template <class Lock>
 static void BM_CustomFineLockPQ(benchmark::State &state)
 {
     // Type alias for clarity, includes the necessary comparator
-    using CustomPQ = DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement,
-                                                                               ComparePriorityOnly>;
+    using CustomPQ =
+        DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement,
+                                                                  ComparePriorityOnly, Lock>;
     CustomPQ pq;  // Create instance
 
     // Warmup phase (single threaded)
@@ -153,6 +162,140 @@ static void BM_CustomFineLockPQ(benchmark::State &state)
     state.SetComplexityN(total_ops);
 }
 
+// --- Benchmark for Relaxed MultiQueue Priority Queue ---
+// All benchmark threads share one queue (set up and torn down by thread 0), so the
+// measurement includes contention between threads.
+static void BM_MultiQueuePQ(benchmark::State &state)
+{
+    using CustomPQ = DataStructure::PriorityQueue::MultiQueuePQ<TestPQElement, ComparePriorityOnly>;
+    static CustomPQ *pq = nullptr;
+
+    if (state.thread_index() == 0)
+    {
+        pq = new CustomPQ();
+        // Warmup phase (single thread, before the start barrier)
+        for (const auto &op : PQ_WARMUP_WORKLOAD)
+        {
+            if (op.type == PQOperation::OpType::PUSH)
+            {
+                pq->push(op.value);
+            }
+            else
+            {
+                pq->pop();  // Ignore result during warmup
+            }
+        }
+    }
+
+    // Calculate work distribution for this thread
+    int num_threads = state.threads();
+    size_t total_ops = PQ_FIXED_WORKLOAD.size();
+    size_t ops_per_thread = total_ops / num_threads;
+    size_t start_index = state.thread_index() * ops_per_thread;
+    size_t end_index =
+        (state.thread_index() == num_threads - 1) ? total_ops : (start_index + ops_per_thread);
+
+    for (auto _ : state)
+    {
+        for (size_t i = start_index; i < end_index; ++i)
+        {
+            const auto &op = PQ_FIXED_WORKLOAD[i];
+            if (op.type == PQOperation::OpType::PUSH)
+            {
+                pq->push(op.value);
+            }
+            else
+            {
+                benchmark::DoNotOptimize(pq->pop());
+            }
+        }
+    }
+    state.SetItemsProcessed(end_index - start_index);
+    state.SetComplexityN(total_ops);
+
+    if (state.thread_index() == 0)
+    {
+        delete pq;
+        pq = nullptr;
+    }
+}
+
+// --- Benchmark for Batched Operations (push_bulk / pop_k) ---
+// Same workload, but runs of consecutive PUSH ops are inserted with push_bulk and runs of
+// consecutive POP ops removed with pop_k, PQ_BATCH_SIZE at most at a time (an A* open set
+// pushes the successors of one expansion together). Compare against the single-op
+// benchmark of the same queue. One queue is shared by all threads, as for the MultiQueue.
+const size_t PQ_BATCH_SIZE = 8;
+
+template <class PQ>
+static void BM_BatchedPQ(benchmark::State &state)
+{
+    static PQ *pq = nullptr;
+
+    if (state.thread_index() == 0)
+    {
+        pq = new PQ();
+        // Warmup phase (single thread, before the start barrier)
+        for (const auto &op : PQ_WARMUP_WORKLOAD)
+        {
+            if (op.type == PQOperation::OpType::PUSH)
+            {
+                pq->push(op.value);
+            }
+            else
+            {
+                pq->pop();  // Ignore result during warmup
+            }
+        }
+    }
+
+    // Calculate work distribution for this thread
+    int num_threads = state.threads();
+    size_t total_ops = PQ_FIXED_WORKLOAD.size();
+    size_t ops_per_thread = total_ops / num_threads;
+    size_t start_index = state.thread_index() * ops_per_thread;
+    size_t end_index =
+        (state.thread_index() == num_threads - 1) ? total_ops : (start_index + ops_per_thread);
+
+    std::vector<TestPQElement> batch;
+    std::vector<TestPQElement> popped;
+    batch.reserve(PQ_BATCH_SIZE);
+    popped.reserve(PQ_BATCH_SIZE);
+    for (auto _ : state)
+    {
+        size_t i = start_index;
+        while (i < end_index)
+        {
+            const PQOperation::OpType type = PQ_FIXED_WORKLOAD[i].type;
+            size_t run_end = i;
+            while (run_end < end_index && run_end - i < PQ_BATCH_SIZE && PQ_FIXED_WORKLOAD[run_end].type == type)
+                ++run_end;
+
+            if (type == PQOperation::OpType::PUSH)
+            {
+                batch.clear();
+                for (size_t j = i; j < run_end; ++j)
+                    batch.push_back(PQ_FIXED_WORKLOAD[j].value);
+                pq->push_bulk(batch);
+            }
+            else
+            {
+                popped.clear();
+                benchmark::DoNotOptimize(pq->pop_k(run_end - i, popped));
+            }
+            i = run_end;
+        }
+    }
+    state.SetItemsProcessed(end_index - start_index);
+    state.SetComplexityN(total_ops);
+
+    if (state.thread_index() == 0)
+    {
+        delete pq;
+        pq = nullptr;
+    }
+}
+
 // --- Benchmark for std::priority_queue ---
 static void BM_StdPriorityQueue(benchmark::State &state)
 {
@@ -204,11 +347,86 @@ static void BM_StdPriorityQueue(benchmark::State &state)
     state.SetComplexityN(total_ops);
 }
 
+// --- Benchmark for the indexed d-ary heap (decrease-key open set) ---
+// PUSH ops map their sequence id onto a small id range, so repeated ids turn into
+// decrease_key calls the way relaxations of an already queued node do in A*.
+const size_t PQ_INDEXED_ID_RANGE = 4096;
+
+template <size_t Arity>
+static void BM_IndexedDaryHeap(benchmark::State &state)
+{
+    using IndexedHeap = DataStructure::PriorityQueue::IndexedDaryHeap<Arity, int, std::less<int>>;
+    IndexedHeap pq(PQ_INDEXED_ID_RANGE);
+
+    auto apply = [&pq](const PQOperation &op)
+    {
+        if (op.type == PQOperation::OpType::PUSH)
+        {
+            pq.push_or_decrease(static_cast<std::uint32_t>(op.value.second % PQ_INDEXED_ID_RANGE),
+                                op.value.first);
+        }
+        else if (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.pop());
+        }
+    };
+
+    // Warmup phase (single threaded)
+    for (const auto &op : PQ_WARMUP_WORKLOAD)
+    {
+        apply(op);
+    }
+
+    // Benchmark loop (sequential structure, registered single-threaded only)
+    size_t total_ops = PQ_FIXED_WORKLOAD.size();
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < total_ops; ++i)
+        {
+            apply(PQ_FIXED_WORKLOAD[i]);
+        }
+    }
+    state.SetItemsProcessed(total_ops);
+    state.SetComplexityN(total_ops);
+}
+
 // --- Register Benchmarks ---
 const int num_hardware_threads = std::max(1u, std::thread::hardware_concurrency());
 
-// Register Custom Fine-Grained PQ (Multi-threaded)
-BENCHMARK(BM_CustomFineLockPQ)
+// Register Custom Fine-Grained PQ (Multi-threaded), once per node lock type
+BENCHMARK_TEMPLATE(BM_CustomFineLockPQ, std::mutex)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_CustomFineLockPQ, DataStructure::SpinLock)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+
+// Register relaxed MultiQueuePQ (Multi-threaded, one queue shared by all threads)
+BENCHMARK(BM_MultiQueuePQ)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+
+// Register the batched operations of both concurrent queues (Multi-threaded, shared queue).
+// Named explicitly: the template arguments would not fit plot_benchmarks.py's name pattern.
+BENCHMARK_TEMPLATE(BM_BatchedPQ, DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<
+                                     TestPQElement, ComparePriorityOnly, std::mutex>)
+    ->Name("BM_BatchedFineLockPQ")
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_BatchedPQ, DataStructure::PriorityQueue::MultiQueuePQ<TestPQElement, ComparePriorityOnly>)
+    ->Name("BM_BatchedMultiQueuePQ")
     ->ThreadRange(1, num_hardware_threads)
     ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
     ->Unit(benchmark::kMillisecond)
@@ -223,5 +441,25 @@ BENCHMARK(BM_StdPriorityQueue)
     ->UseRealTime()
     ->Complexity();
 
+// Register the indexed heap at the arities worth comparing (Single-threaded ONLY)
+BENCHMARK_TEMPLATE(BM_IndexedDaryHeap, 2)
+    ->DenseThreadRange(1, 1)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_IndexedDaryHeap, 4)
+    ->DenseThreadRange(1, 1)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_IndexedDaryHeap, 8)
+    ->DenseThreadRange(1, 1)
+    ->MinWarmUpTime(PQ_EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Complexity();
+
 // --- Main Function ---
 BENCHMARK_MAIN();
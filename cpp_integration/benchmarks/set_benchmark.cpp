@@ -12,7 +12,10 @@
 #include "data_structure/iset.h"
 #include "data_structure/set_coarse.h"
 #include "data_structure/set_fine.h"
+#include "data_structure/set_lazy.h"
+#include "data_structure/set_optimistic.h"
 #include "data_structure/set_sequential.h"
+#include "data_structure/spin_lock.h"
 
 // --- Configuration ---
 using TestSetElement = int;
@@ -166,6 +169,10 @@ public:
 using SequentialSet = DataStructure::Set::SortedLinkedList_Sequential<TestSetElement>;
 using CoarseLockSet = DataStructure::Set::SortedLinkedList_CoarseLock<TestSetElement>;
 using FineLockSet = DataStructure::Set::SortedLinkedList_FineLock<TestSetElement>;
+using FineSpinLockSet =
+    DataStructure::Set::SortedLinkedList_FineLock<TestSetElement, DataStructure::SpinLock>;
+using OptimisticSet = DataStructure::Set::SortedLinkedList_Optimistic<TestSetElement>;
+using LazySet = DataStructure::Set::SortedLinkedList_Lazy<TestSetElement>;
 using StdSet = StdSetAdapter<TestSetElement>;                    // Use adapter
 using StdUnorderedSet = StdUnorderedSetAdapter<TestSetElement>;  // Use adapter
 
@@ -240,6 +247,15 @@ BENCHMARK_TEMPLATE_DEFINE_F(SetBenchmarkFixture, BM_CoarseLockOps, CoarseLockSet
 BENCHMARK_TEMPLATE_DEFINE_F(SetBenchmarkFixture, BM_FineLockOps, FineLockSet)
 (benchmark::State &state) { BenchmarkBody(state, this->set_instance.get()); }
 
+BENCHMARK_TEMPLATE_DEFINE_F(SetBenchmarkFixture, BM_FineSpinLockOps, FineSpinLockSet)
+(benchmark::State &state) { BenchmarkBody(state, this->set_instance.get()); }
+
+BENCHMARK_TEMPLATE_DEFINE_F(SetBenchmarkFixture, BM_OptimisticOps, OptimisticSet)
+(benchmark::State &state) { BenchmarkBody(state, this->set_instance.get()); }
+
+BENCHMARK_TEMPLATE_DEFINE_F(SetBenchmarkFixture, BM_LazyOps, LazySet)
+(benchmark::State &state) { BenchmarkBody(state, this->set_instance.get()); }
+
 BENCHMARK_TEMPLATE_DEFINE_F(SetBenchmarkFixture, BM_StdSetOps, StdSet)
 (benchmark::State &state) { BenchmarkBody(state, this->set_instance.get()); }
 
@@ -272,6 +288,27 @@ BENCHMARK_REGISTER_F(SetBenchmarkFixture, BM_FineLockOps)
     ->Unit(benchmark::kMillisecond)
     ->UseRealTime();
 
+// Register Fine Lock with 1-byte spinlocks per node (run for multiple threads)
+BENCHMARK_REGISTER_F(SetBenchmarkFixture, BM_FineSpinLockOps)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Register Optimistic (run for multiple threads)
+BENCHMARK_REGISTER_F(SetBenchmarkFixture, BM_OptimisticOps)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Register Lazy, wait-free contains (run for multiple threads)
+BENCHMARK_REGISTER_F(SetBenchmarkFixture, BM_LazyOps)
+    ->ThreadRange(1, num_hardware_threads)
+    ->MinWarmUpTime(EXECUTION_WARMUP_SECONDS)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
 // Register std::set Adapter (RUN ONLY FOR 1 THREAD)
 BENCHMARK_REGISTER_F(SetBenchmarkFixture, BM_StdSetOps)
     ->DenseThreadRange(1, 1)  // IMPORTANT: Enforce single thread
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ROAD_NETWORK_HAS_MMAP 1
+#endif
+
+/**
+ * On-disk road network format ("RNETBIN").
+ *
+ * Layout: a fixed-size header followed by a directory of sections and the section
+ * payloads. Every payload starts on a 64-byte boundary so it can be used in place
+ * from a read-only memory mapping. All values are little-endian / native; the header
+ * carries an endianness probe so a foreign file is rejected instead of misread.
+ *
+ * Readers ignore sections they do not know, so new optional sections can be added
+ * without bumping the version. The version changes only when an existing section
+ * changes meaning.
+ */
+namespace BinaryFormat
+{
+
+inline constexpr char MAGIC[8] = {'R', 'N', 'E', 'T', 'B', 'I', 'N', '\0'};
+inline constexpr std::uint32_t VERSION = 1;
+inline constexpr std::uint32_t ENDIAN_PROBE = 0x01020304;
+inline constexpr std::uint64_t ALIGNMENT = 64;
+inline constexpr std::uint32_t MAX_SECTIONS = 32;
+
+enum class SectionId : std::uint32_t
+{
+    Offsets = 1,      // EdgeIndex[num_nodes + 1], CSR row offsets
+    Targets = 2,      // NodeIndex[num_edges]
+    Weights = 3,      // double[num_edges]
+    Lats = 4,         // double[num_nodes], degrees
+    Lons = 5,         // double[num_nodes], degrees
+    NodeIds = 6,      // int64[num_nodes], dense index -> OSM id
+    IdMapIds = 7,     // int64[num_nodes], OSM ids in ascending order
+    IdMapIndex = 8,   // NodeIndex[num_nodes], dense index of IdMapIds[i]
+    RevOffsets = 9,   // EdgeIndex[num_nodes + 1], reverse CSR (optional, rebuilt if absent)
+    RevSources = 10,  // NodeIndex[num_edges]
+    RevWeights = 11,  // double[num_edges]
+    LandmarkIds = 12,   // NodeIndex[K], ALT landmarks (optional, see landmark_table.h)
+    LandmarkFrom = 13,  // float[num_nodes * K], d(landmark, v), node-major
+    LandmarkTo = 14,    // float[num_nodes * K], d(v, landmark), node-major
+    LatRad = 15,        // double[num_nodes], radians (optional, rebuilt if absent)
+    LonRad = 16,        // double[num_nodes], radians
+    CosLat = 17,        // double[num_nodes], cos(LatRad)
+    EdgeCosts = 18,     // double[num_edges * NUM_CRITERIA], edge-major (optional)
+    RevEdgeCosts = 19,  // double[num_edges * NUM_CRITERIA], reverse CSR order
+};
+
+struct Section
+{
+    std::uint32_t id;
+    std::uint32_t reserved;
+    std::uint64_t offset;  // From the start of the file
+    std::uint64_t bytes;
+};
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t endian_probe;
+    std::uint64_t num_nodes;
+    std::uint64_t num_edges;
+    std::uint32_t section_count;
+    std::uint32_t reserved;
+    Section sections[MAX_SECTIONS];
+};
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where the platform allows.
+ *
+ * With mmap the pages come from the shared page cache, so any number of worker
+ * processes opening the same file share one physical copy. Elsewhere the file is
+ * read into a private buffer.
+ */
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string &path)
+    {
+#ifdef ROAD_NETWORK_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("Cannot open '" + path + "'.");
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat '" + path + "'.");
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0)
+        {
+            void *addr = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Cannot mmap '" + path + "'.");
+            }
+            data_ = static_cast<const std::byte *>(addr);
+        }
+        ::close(fd);  // The mapping stays valid after closing the descriptor
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in)
+            throw std::runtime_error("Cannot open '" + path + "'.");
+        size_ = static_cast<size_t>(in.tellg());
+        buffer_.resize(size_);
+        in.seekg(0);
+        in.read(reinterpret_cast<char *>(buffer_.data()), static_cast<std::streamsize>(size_));
+        data_ = buffer_.data();
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifdef ROAD_NETWORK_HAS_MMAP
+        if (data_)
+            ::munmap(const_cast<std::byte *>(data_), size_);
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const std::byte *data() const { return data_; }
+
+    size_t size() const { return size_; }
+
+private:
+    const std::byte *data_ = nullptr;
+    size_t size_ = 0;
+#ifndef ROAD_NETWORK_HAS_MMAP
+    std::vector<std::byte> buffer_;
+#endif
+};
+
+// Validates the header of a mapped file and returns it
+inline const Header &read_header(const MappedFile &file, const std::string &path)
+{
+    if (file.size() < sizeof(Header))
+        throw std::runtime_error("'" + path + "' is too small to be a road network file.");
+    const Header &header = *reinterpret_cast<const Header *>(file.data());
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("'" + path + "' is not a road network file (bad magic).");
+    if (header.endian_probe != ENDIAN_PROBE)
+        throw std::runtime_error("'" + path + "' was written with a different byte order.");
+    if (header.version != VERSION)
+        throw std::runtime_error("'" + path + "' has unsupported format version "
+                                 + std::to_string(header.version) + ".");
+    if (header.section_count > MAX_SECTIONS)
+        throw std::runtime_error("'" + path + "' has a corrupt section directory.");
+    return header;
+}
+
+// Looks up a section and views it as `expected_count` elements of T.
+// Returns an empty span for a missing optional section; throws on size mismatch. The
+// bounds are checked without overflow, whatever the header claims.
+template <typename T>
+std::span<const T> section_view(const MappedFile &file, const Header &header, SectionId id,
+                                size_t expected_count, bool required = true)
+{
+    for (std::uint32_t i = 0; i < header.section_count; ++i)
+    {
+        const Section &section = header.sections[i];
+        if (section.id != static_cast<std::uint32_t>(id))
+            continue;
+        if (expected_count > file.size() / sizeof(T) || section.bytes != expected_count * sizeof(T)
+            || section.offset % alignof(T) != 0 || section.offset > file.size()
+            || section.bytes > file.size() - section.offset)
+            throw std::runtime_error("Road network section " + std::to_string(section.id)
+                                     + " has an unexpected size or offset.");
+        return {reinterpret_cast<const T *>(file.data() + section.offset), expected_count};
+    }
+    if (required)
+        throw std::runtime_error("Road network file is missing section "
+                                 + std::to_string(static_cast<std::uint32_t>(id)) + ".");
+    return {};
+}
+
+// Number of T elements in a section, 0 if the file does not have it
+template <typename T>
+size_t section_length(const Header &header, SectionId id)
+{
+    for (std::uint32_t i = 0; i < header.section_count; ++i)
+    {
+        if (header.sections[i].id == static_cast<std::uint32_t>(id))
+            return static_cast<size_t>(header.sections[i].bytes / sizeof(T));
+    }
+    return 0;
+}
+
+/**
+ * @brief Streams a header plus aligned section payloads to disk.
+ *
+ * Usage: add() every section, then write(). Payload spans must stay alive until
+ * write() returns.
+ */
+class Writer
+{
+public:
+    Writer(std::uint64_t num_nodes, std::uint64_t num_edges)
+    {
+        std::memset(&header_, 0, sizeof(header_));
+        std::memcpy(header_.magic, MAGIC, sizeof(MAGIC));
+        header_.version = VERSION;
+        header_.endian_probe = ENDIAN_PROBE;
+        header_.num_nodes = num_nodes;
+        header_.num_edges = num_edges;
+    }
+
+    template <typename T>
+    void add(SectionId id, std::span<const T> payload)
+    {
+        if (header_.section_count == MAX_SECTIONS)
+            throw std::length_error("Too many sections in road network file.");
+        payloads_.push_back({reinterpret_cast<const char *>(payload.data()), payload.size_bytes()});
+        header_.sections[header_.section_count++] = {static_cast<std::uint32_t>(id), 0, 0,
+                                                     payload.size_bytes()};
+    }
+
+    void write(const std::string &path)
+    {
+        std::uint64_t offset = align(sizeof(Header));
+        for (std::uint32_t i = 0; i < header_.section_count; ++i)
+        {
+            header_.sections[i].offset = offset;
+            offset = align(offset + header_.sections[i].bytes);
+        }
+
+        // Write to a temporary name and rename, so readers never map a half-written file
+        const std::string tmp_path = path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("Cannot create '" + tmp_path + "'.");
+            out.write(reinterpret_cast<const char *>(&header_), sizeof(header_));
+            std::uint64_t position = sizeof(header_);
+            for (std::uint32_t i = 0; i < header_.section_count; ++i)
+            {
+                pad(out, position, header_.sections[i].offset);
+                out.write(payloads_[i].data, static_cast<std::streamsize>(payloads_[i].bytes));
+                position += payloads_[i].bytes;
+            }
+            pad(out, position, align(position));
+            if (!out)
+                throw std::runtime_error("Failed writing '" + tmp_path + "'.");
+        }
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+            throw std::runtime_error("Cannot move '" + tmp_path + "' to '" + path + "'.");
+    }
+
+private:
+    struct Payload
+    {
+        const char *data;
+        size_t bytes;
+    };
+
+    static std::uint64_t align(std::uint64_t offset)
+    {
+        return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    static void pad(std::ofstream &out, std::uint64_t &position, std::uint64_t target)
+    {
+        static const char zeros[ALIGNMENT] = {};
+        out.write(zeros, static_cast<std::streamsize>(target - position));
+        position = target;
+    }
+
+    Header header_;
+    std::vector<Payload> payloads_;
+};
+
+}  // namespace BinaryFormat
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>  // For std::move
+#include <vector>
+
+namespace DataStructure
+{
+
+/**
+ * @brief Epoch-based memory reclamation (EBR) for structures with lock-free readers.
+ *
+ * A thread that may dereference shared nodes without holding their locks pins the
+ * current global epoch for the duration of the operation (EpochDomain::Guard).
+ * Unlinked nodes are not freed right away but retired: they wait in the retiring
+ * thread's limbo list until the global epoch has advanced twice past the epoch they
+ * were retired in. The epoch only advances when every pinned thread has observed the
+ * current one, so by then no thread can still hold a pointer to them.
+ *
+ * Usage inside a structure:
+ *     EpochDomain::Guard guard;        // for the whole traversal
+ *     ...unlink node...
+ *     EpochDomain::instance().retire<Node, &destroy_node>(node);
+ *
+ * Guards nest. A thread that stays pinned forever stalls reclamation (memory grows) but
+ * never makes it unsafe. Limbo lists of exiting threads are adopted by the domain and
+ * freed by whichever thread next advances the epoch.
+ */
+class EpochDomain
+{
+    struct Record;
+
+public:
+    using Deleter = void (*)(void *);
+
+    // Retirements between two attempts to advance the epoch
+    static constexpr size_t RETIRE_SCAN_THRESHOLD = 64;
+
+    // Process-wide domain. Never destroyed, so thread exit handlers can always reach it.
+    static EpochDomain &instance()
+    {
+        static EpochDomain *domain = new EpochDomain;
+        return *domain;
+    }
+
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain &operator=(const EpochDomain &) = delete;
+
+    // Pins the calling thread to the current epoch for its lifetime
+    class Guard
+    {
+    public:
+        Guard() : domain(EpochDomain::instance()), record(domain.local_record())
+        {
+            domain.enter(record);
+        }
+
+        ~Guard() { domain.leave(record); }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+    private:
+        EpochDomain &domain;
+        Record *record;
+    };
+
+    // Hands an unlinked object to the domain; deleter(pointer) runs once no pinned thread
+    // can reach it. Must be called after the object became unreachable for new readers.
+    void retire(void *pointer, Deleter deleter)
+    {
+        Record *record = local_record();
+        const std::uint64_t epoch = global_epoch.load(std::memory_order_acquire);
+        Limbo &bucket = record->limbo[epoch % 3];
+        if (bucket.epoch != epoch)
+        {
+            // The bucket holds objects from epoch - 3 or older: safe to free now
+            free_all(bucket.objects);
+            bucket.epoch = epoch;
+        }
+        bucket.objects.push_back({pointer, deleter});
+
+        if (++record->retired_since_scan >= RETIRE_SCAN_THRESHOLD)
+        {
+            record->retired_since_scan = 0;
+            try_advance();
+            reclaim(record);
+        }
+    }
+
+    // Typed form with the deleter fixed at compile time, e.g. retire<Node, &Pool::destroy>(node)
+    template <typename T, void (*Destroy)(T *)>
+    void retire(T *pointer)
+    {
+        retire(static_cast<void *>(pointer),
+               [](void *object) { Destroy(static_cast<T *>(object)); });
+    }
+
+    // Current global epoch (monotonic; for tests and diagnostics)
+    std::uint64_t epoch() const { return global_epoch.load(std::memory_order_acquire); }
+
+    // Tries to move the epoch forward and frees what the calling thread may free.
+    // Quiescent helper for tests/shutdown; concurrent use is safe but rarely needed.
+    void collect()
+    {
+        Record *record = local_record();
+        try_advance();
+        reclaim(record);
+    }
+
+private:
+    struct Retired
+    {
+        void *pointer;
+        Deleter deleter;
+    };
+
+    struct Limbo
+    {
+        std::uint64_t epoch = 0;  // Epoch the objects were retired in
+        std::vector<Retired> objects;
+    };
+
+    // Per-thread state. Records are recycled between threads and never freed.
+    struct alignas(64) Record
+    {
+        std::atomic<std::uint64_t> pinned{0};  // Epoch while inside a guard, 0 when quiescent
+        std::atomic<bool> in_use{false};
+        Record *next = nullptr;  // Immutable once published
+        unsigned nesting = 0;
+        size_t retired_since_scan = 0;
+        Limbo limbo[3];
+    };
+
+    // Releases the thread's record at thread exit
+    struct RecordHandle
+    {
+        Record *record = nullptr;
+
+        ~RecordHandle()
+        {
+            if (record != nullptr)
+                EpochDomain::instance().release(record);
+        }
+    };
+
+    std::atomic<Record *> records{nullptr};
+    std::atomic<std::uint64_t> global_epoch{1};  // Starts at 1: 0 means "not pinned"
+
+    std::mutex orphan_mutex;     // Guards orphans
+    std::vector<Limbo> orphans;  // Limbo lists of threads that exited
+
+    EpochDomain() = default;
+
+    static void free_all(std::vector<Retired> &objects)
+    {
+        for (const Retired &object : objects)
+            object.deleter(object.pointer);
+        objects.clear();
+    }
+
+    Record *local_record()
+    {
+        thread_local RecordHandle handle;
+        if (handle.record == nullptr)
+            handle.record = acquire_record();
+        return handle.record;
+    }
+
+    Record *acquire_record()
+    {
+        // Reuse a record released by an exited thread
+        for (Record *record = records.load(std::memory_order_acquire); record != nullptr;
+             record = record->next)
+        {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed)
+                && record->in_use.compare_exchange_strong(expected, true))
+                return record;
+        }
+
+        Record *record = new Record;
+        record->in_use.store(true, std::memory_order_relaxed);
+        Record *head = records.load(std::memory_order_relaxed);
+        do
+        {
+            record->next = head;
+        } while (!records.compare_exchange_weak(head, record, std::memory_order_release,
+                                                std::memory_order_relaxed));
+        return record;
+    }
+
+    void release(Record *record)
+    {
+        {
+            std::lock_guard<std::mutex> lock(orphan_mutex);
+            for (Limbo &bucket : record->limbo)
+            {
+                if (!bucket.objects.empty())
+                    orphans.push_back(std::move(bucket));
+                bucket = Limbo{};
+            }
+        }
+        record->nesting = 0;
+        record->retired_since_scan = 0;
+        record->pinned.store(0, std::memory_order_release);
+        record->in_use.store(false, std::memory_order_release);
+    }
+
+    void enter(Record *record)
+    {
+        if (record->nesting++ > 0)
+            return;
+        // Publish the pin, then confirm the epoch did not move in between; otherwise a
+        // reclaimer could have missed us and freed nodes we are about to reach
+        std::uint64_t epoch = global_epoch.load(std::memory_order_seq_cst);
+        while (true)
+        {
+            record->pinned.store(epoch, std::memory_order_seq_cst);
+            std::uint64_t current = global_epoch.load(std::memory_order_seq_cst);
+            if (current == epoch)
+                break;
+            epoch = current;
+        }
+    }
+
+    void leave(Record *record)
+    {
+        if (--record->nesting == 0)
+            record->pinned.store(0, std::memory_order_release);
+    }
+
+    // Advances the epoch if every pinned thread has seen the current one
+    void try_advance()
+    {
+        std::uint64_t epoch = global_epoch.load(std::memory_order_seq_cst);
+        for (Record *record = records.load(std::memory_order_acquire); record != nullptr;
+             record = record->next)
+        {
+            std::uint64_t pinned = record->pinned.load(std::memory_order_seq_cst);
+            if (pinned != 0 && pinned != epoch)
+                return;  // Someone is still in an older epoch
+        }
+        global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    }
+
+    // Frees the calling thread's buckets and orphans retired at least two epochs ago
+    void reclaim(Record *record)
+    {
+        const std::uint64_t epoch = global_epoch.load(std::memory_order_acquire);
+        for (Limbo &bucket : record->limbo)
+            if (bucket.epoch + 2 <= epoch)
+                free_all(bucket.objects);
+
+        // Orphans are freed outside the lock so deleters never run under orphan_mutex
+        std::vector<Limbo> ready;
+        {
+            std::unique_lock<std::mutex> lock(orphan_mutex, std::try_to_lock);
+            if (!lock.owns_lock())
+                return;
+            for (size_t i = 0; i < orphans.size();)
+            {
+                if (orphans[i].epoch + 2 <= epoch)
+                {
+                    ready.push_back(std::move(orphans[i]));
+                    orphans[i] = std::move(orphans.back());
+                    orphans.pop_back();
+                }
+                else
+                    ++i;
+            }
+        }
+        for (Limbo &bucket : ready)
+            free_all(bucket.objects);
+    }
+};
+
+}  // namespace DataStructure
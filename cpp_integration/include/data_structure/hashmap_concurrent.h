@@ -0,0 +1,214 @@
+#pragma once
+
+#include <atomic>
+#include <algorithm>  // For std::max
+#include <bit>        // For std::bit_cast, std::bit_ceil
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>  // For std::unique_ptr
+#include <stdexcept>
+#include <type_traits>
+
+namespace DataStructure
+{
+namespace HashMap
+{
+
+/**
+ * @brief Fixed-capacity concurrent hash map from integer keys to 64-bit words.
+ *
+ * Open addressing with linear probing over two flat arrays (keys, values). A key is
+ * inserted by CAS-ing an empty key slot; keys are never removed individually, so a
+ * probe sequence never has holes. Values are updated in place with CAS, which gives a
+ * lock-free atomic-min: all threads relaxing the same key meet in one compare-exchange
+ * instead of a global mutex.
+ *
+ * Several fields that must change together (e.g. a g-score and its parent, see
+ * pack_score()) fit into one value word, so readers never see a torn pair.
+ *
+ * clear() is not concurrent and costs O(size()), not O(capacity()): every claimed slot
+ * is remembered, so a map reused across queries only resets what the last one touched.
+ *
+ * @tparam Key Unsigned integral key type; its maximum value is reserved as "empty".
+ * @tparam Value Unsigned integral value type; its maximum value means "no value yet".
+ */
+template <typename Key = std::uint32_t, typename Value = std::uint64_t>
+class ConcurrentHashMap
+{
+    static_assert(std::is_unsigned_v<Key> && std::is_unsigned_v<Value>,
+                  "ConcurrentHashMap keys and values are unsigned integers");
+    static_assert(std::atomic<Key>::is_always_lock_free && std::atomic<Value>::is_always_lock_free,
+                  "ConcurrentHashMap needs lock-free atomics for its slots");
+
+public:
+    static constexpr Key EMPTY_KEY = std::numeric_limits<Key>::max();
+    static constexpr Value EMPTY_VALUE = std::numeric_limits<Value>::max();
+
+    // Capacity is the next power of two holding expected_keys at <= 50% load
+    explicit ConcurrentHashMap(size_t expected_keys)
+        : slot_count(std::bit_ceil(std::max<size_t>(2 * expected_keys, 16))),
+          mask(slot_count - 1),
+          keys(std::make_unique<std::atomic<Key>[]>(slot_count)),
+          values(std::make_unique<std::atomic<Value>[]>(slot_count)),
+          claimed(std::make_unique<size_t[]>(slot_count))
+    {
+        for (size_t i = 0; i < slot_count; ++i)
+        {
+            keys[i].store(EMPTY_KEY, std::memory_order_relaxed);
+            values[i].store(EMPTY_VALUE, std::memory_order_relaxed);
+        }
+    }
+
+    // Non-copyable and non-movable due to atomics
+    ConcurrentHashMap(const ConcurrentHashMap &) = delete;
+    ConcurrentHashMap &operator=(const ConcurrentHashMap &) = delete;
+
+    size_t capacity() const { return slot_count; }
+
+    // Number of keys inserted since the last clear()
+    size_t size() const { return claimed_count.load(std::memory_order_acquire); }
+
+    // Value stored for key, EMPTY_VALUE if the key is absent
+    Value load(Key key) const
+    {
+        const size_t slot = find(key);
+        return slot == NOT_FOUND ? EMPTY_VALUE : values[slot].load(std::memory_order_acquire);
+    }
+
+    // Atomic min: stores value if it is smaller than the current one (inserting the key
+    // if needed). Returns true if this call lowered the stored value.
+    bool update_min(Key key, Value value)
+    {
+        std::atomic<Value> &slot = values[claim(key)];
+        Value current = slot.load(std::memory_order_relaxed);
+        while (value < current)
+        {
+            if (slot.compare_exchange_weak(current, value, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    // Atomic min under a custom order: stores value if the key has no value yet or if
+    // less(value, current) holds. Returns true if this call replaced the stored value.
+    template <typename Less>
+    bool update_min(Key key, Value value, Less less)
+    {
+        std::atomic<Value> &slot = values[claim(key)];
+        Value current = slot.load(std::memory_order_relaxed);
+        while (current == EMPTY_VALUE || less(value, current))
+        {
+            if (slot.compare_exchange_weak(current, value, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    // Unconditional store (inserting the key if needed)
+    void store(Key key, Value value) { values[claim(key)].store(value, std::memory_order_release); }
+
+    // Removes every key. NOT THREAD-SAFE: call only while no other thread uses the map.
+    void clear()
+    {
+        const size_t count = claimed_count.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            keys[claimed[i]].store(EMPTY_KEY, std::memory_order_relaxed);
+            values[claimed[i]].store(EMPTY_VALUE, std::memory_order_relaxed);
+        }
+        claimed_count.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+    const size_t slot_count;
+    const size_t mask;
+    std::unique_ptr<std::atomic<Key>[]> keys;
+    std::unique_ptr<std::atomic<Value>[]> values;
+    std::unique_ptr<size_t[]> claimed;  // Slots claimed since the last clear()
+    std::atomic<size_t> claimed_count{0};
+
+    // Fibonacci hashing spreads consecutive ids (dense node indices) over the table
+    size_t home_slot(Key key) const
+    {
+        return static_cast<size_t>((static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> 32)
+               & mask;
+    }
+
+    size_t find(Key key) const
+    {
+        size_t slot = home_slot(key);
+        for (size_t probes = 0; probes < slot_count; ++probes)
+        {
+            const Key stored = keys[slot].load(std::memory_order_acquire);
+            if (stored == key)
+                return slot;
+            if (stored == EMPTY_KEY)
+                return NOT_FOUND;
+            slot = (slot + 1) & mask;
+        }
+        return NOT_FOUND;
+    }
+
+    // Returns the slot of key, inserting it into the first empty slot of its probe sequence
+    size_t claim(Key key)
+    {
+        size_t slot = home_slot(key);
+        for (size_t probes = 0; probes < slot_count; ++probes)
+        {
+            Key stored = keys[slot].load(std::memory_order_acquire);
+            if (stored == EMPTY_KEY
+                && keys[slot].compare_exchange_strong(stored, key, std::memory_order_acq_rel,
+                                                      std::memory_order_acquire))
+            {
+                claimed[claimed_count.fetch_add(1, std::memory_order_relaxed)] = slot;
+                return slot;
+            }
+            if (stored == key)
+                return slot;  // Present already, or another thread inserted it first
+            slot = (slot + 1) & mask;
+        }
+        throw std::length_error("ConcurrentHashMap is full.");
+    }
+};
+
+// --- Packed (cost, index) values for atomic-min updates ---
+//
+// A non-negative float compares like its bit pattern, so placing it in the high half of
+// a 64-bit word makes integer order equal cost order (ties broken by the index). One
+// update_min() then lowers a cost and records the matching index (e.g. the parent of a
+// search node) in a single atomic step. Costs are rounded to float precision, i.e. a
+// relative error of about 6e-8 per update.
+//
+// For parent pointers use update_min(key, value, score_cost_less): the plain word order
+// counts an equal cost with a smaller index as an improvement, which lets a zero-length
+// edge (or one shorter than an ulp of g) re-parent a node at the same cost and close a
+// parent cycle.
+
+inline std::uint64_t pack_score(float cost, std::uint32_t index)
+{
+    return (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(cost)) << 32) | index;
+}
+
+inline float score_cost(std::uint64_t packed)
+{
+    return std::bit_cast<float>(static_cast<std::uint32_t>(packed >> 32));
+}
+
+inline std::uint32_t score_index(std::uint64_t packed)
+{
+    return static_cast<std::uint32_t>(packed);
+}
+
+// Order of packed scores by cost alone: an equal cost is no improvement
+inline bool score_cost_less(std::uint64_t a, std::uint64_t b)
+{
+    return score_cost(a) < score_cost(b);
+}
+
+}  // namespace HashMap
+}  // namespace DataStructure
@@ -2,6 +2,9 @@
 
 #include <cstddef>  // For size_t
 #include <optional>
+#include <span>     // For push_bulk() batches
+#include <utility>  // For std::move
+#include <vector>   // For pop_k() output
 
 namespace DataStructure
 {
@@ -37,6 +40,46 @@ public:
      */
     virtual std::optional<T> pop() = 0;
 
+    /**
+     * @brief Inserts every element of a batch, in any order.
+     *
+     * Equivalent to calling push() on each element in turn (the relative FIFO order of
+     * equal priorities within the batch is kept). The default does exactly that;
+     * implementations override it to insert the whole batch with fewer lock
+     * acquisitions. The batch is not inserted atomically: a concurrent pop() may see
+     * part of it.
+     * @param values The values to insert.
+     * @throws std::bad_alloc if node allocation fails (nothing is inserted then).
+     */
+    virtual void push_bulk(std::span<const T> values)
+    {
+        for (const T &val : values)
+            push(val);
+    }
+
+    /**
+     * @brief Removes up to k highest priority elements and appends them to out.
+     *
+     * Elements are appended in the order repeated pop() calls would return them. The
+     * default calls pop() until it has k elements or the queue is empty;
+     * implementations override it to take them in one locked pass.
+     * @param k Maximum number of elements to remove.
+     * @param out Receives the removed elements.
+     * @return The number of elements appended (less than k only if the queue ran empty).
+     */
+    virtual size_t pop_k(size_t k, std::vector<T> &out)
+    {
+        size_t taken = 0;
+        for (; taken < k; ++taken)
+        {
+            std::optional<T> val = pop();
+            if (!val)
+                break;
+            out.push_back(std::move(*val));
+        }
+        return taken;
+    }
+
     /**
      * @brief Checks if the priority queue contains no elements.
      * @return true if the queue is empty, false otherwise.
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>  // For std::unique_ptr
+#include <mutex>
+#include <new>  // For placement new
+#include <utility>  // For std::forward
+#include <vector>
+
+namespace DataStructure
+{
+
+/**
+ * @brief Process-wide pool of fixed-size node blocks with per-thread caches.
+ *
+ * Replaces per-operation new/delete in the linked-list structures. Each thread keeps a
+ * private free list, so the common create()/destroy() pair touches no shared state.
+ * Threads only meet at the shared free list, and then a whole batch of
+ * NODES_PER_BATCH blocks moves at once: a thread that runs dry takes a batch (or carves
+ * a new slab), and a thread whose cache grows past two batches hands one back. This
+ * also covers nodes that are created on one thread and destroyed on another, e.g. a
+ * push and a pop of the same priority queue element.
+ *
+ * One pool exists per Node type and is shared by every container of that type. Slabs
+ * are kept until process exit: freed nodes are recycled, never returned to the OS.
+ *
+ * @tparam Node Node type handed out by create(). Any constructor arguments work.
+ */
+template <typename Node>
+class NodePool
+{
+public:
+    // Blocks moved between a thread cache and the shared list in one go
+    static constexpr size_t NODES_PER_BATCH = 256;
+
+    // Allocates a block and constructs a Node in it
+    template <typename... Args>
+    static Node *create(Args &&...args)
+    {
+        Block *block = local().take();
+        try
+        {
+            return ::new (static_cast<void *>(block->storage)) Node(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            local().give(block);
+            throw;
+        }
+    }
+
+    // Destroys a node from create() and recycles its block; nullptr is ignored
+    static void destroy(Node *node)
+    {
+        if (node == nullptr)
+            return;
+        node->~Node();
+        local().give(reinterpret_cast<Block *>(node));
+    }
+
+private:
+    union Block
+    {
+        Block *next;  // Valid while the block is free
+        alignas(Node) std::byte storage[sizeof(Node)];
+    };
+
+    // A chain of free blocks linked through Block::next
+    struct Chain
+    {
+        Block *head = nullptr;
+        size_t count = 0;
+    };
+
+    struct Shared
+    {
+        std::mutex mutex;
+        std::vector<Chain> batches;                   // Free chains, guarded by mutex
+        std::vector<std::unique_ptr<Block[]>> slabs;  // Owns every block ever handed out
+    };
+
+    // Never destroyed: thread caches may flush into it while statics are torn down
+    // (e.g. pool workers joined from a static destructor)
+    static Shared &shared()
+    {
+        static Shared *instance = new Shared;
+        return *instance;
+    }
+
+    class LocalCache
+    {
+    public:
+        ~LocalCache()
+        {
+            // Thread exit: hand the whole cache back so other threads can reuse it
+            if (free.count > 0)
+            {
+                Shared &pool = shared();
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                pool.batches.push_back(free);
+            }
+        }
+
+        Block *take()
+        {
+            if (free.head == nullptr)
+                refill();
+            Block *block = free.head;
+            free.head = block->next;
+            --free.count;
+            return block;
+        }
+
+        void give(Block *block)
+        {
+            block->next = free.head;
+            free.head = block;
+            if (++free.count > 2 * NODES_PER_BATCH)
+                release_batch();
+        }
+
+    private:
+        Chain free;
+
+        void refill()
+        {
+            Shared &pool = shared();
+            {
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                if (!pool.batches.empty())
+                {
+                    free = pool.batches.back();
+                    pool.batches.pop_back();
+                    return;
+                }
+            }
+
+            // Nothing to reuse: carve a new slab outside the lock, then register it
+            std::unique_ptr<Block[]> slab(new Block[NODES_PER_BATCH]);
+            Block *blocks = slab.get();
+            for (size_t i = 0; i + 1 < NODES_PER_BATCH; ++i)
+                blocks[i].next = &blocks[i + 1];
+            blocks[NODES_PER_BATCH - 1].next = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                pool.slabs.push_back(std::move(slab));
+            }
+            free = {blocks, NODES_PER_BATCH};
+        }
+
+        // Splits NODES_PER_BATCH blocks off the front of the cache and shares them
+        void release_batch()
+        {
+            Chain batch{free.head, NODES_PER_BATCH};
+            Block *last = free.head;
+            for (size_t i = 1; i < NODES_PER_BATCH; ++i)
+                last = last->next;
+            free.head = last->next;
+            free.count -= NODES_PER_BATCH;
+            last->next = nullptr;
+
+            Shared &pool = shared();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            pool.batches.push_back(batch);
+        }
+    };
+
+    static LocalCache &local()
+    {
+        thread_local LocalCache cache;
+        return cache;
+    }
+};
+
+}  // namespace DataStructure
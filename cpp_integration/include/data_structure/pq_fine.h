@@ -1,15 +1,18 @@
 #pragma once
 
 #include "ipq.h"  // Include the interface definition
+#include "node_pool.h"  // For NodePool
+#include <algorithm>  // For std::stable_sort
 #include <atomic>
 #include <cassert>  // For assert()
 #include <cstddef>
 #include <functional>  // For std::less (default comparator)
 #include <limits>
-#include <memory>  // For placement new header <new> and std::destroy_at
 #include <mutex>
 #include <optional>  // For pop() return type
+#include <span>
 #include <utility>   // For std::pair, std::move
+#include <vector>
 
 namespace DataStructure
 {
@@ -19,16 +22,17 @@ namespace PriorityQueue
 /**
  * @brief Node structure for the fine-grained locking priority queue.
  * @tparam T Element type.
+ * @tparam Lock Per-node lock type (std::mutex or DataStructure::SpinLock).
  */
-template <typename T>
+template <typename T, class Lock = std::mutex>
 struct FinePQNode
 {
     T val;
-    FinePQNode<T> *next;
-    std::mutex node_mutex;  // Mutex protecting this node's state (primarily 'next')
+    FinePQNode *next;
+    Lock node_mutex;  // Lock protecting this node's state (primarily 'next')
 
     // Constructor for data nodes (moves value)
-    FinePQNode(T v, FinePQNode<T> *n = nullptr) : val(std::move(v)), next(n) { }
+    FinePQNode(T v, FinePQNode *n = nullptr) : val(std::move(v)), next(n) { }
 
     // Constructor for sentinel nodes (value initialized separately)
     FinePQNode() : next(nullptr) { }
@@ -51,32 +55,39 @@ struct FinePQNode
  * @brief A fine-grained locking priority queue based on a sorted linked list
  * with sentinel nodes.
  *
- * Implements the IPriorityQueue interface. Uses mutexes on each node.
+ * Implements the IPriorityQueue interface. Uses a lock on each node.
  * Highest priority element is at the tail. Pop removes from the tail.
  * Supports concurrent push and pop operations. FIFO for equal priorities.
+ * Nodes come from a NodePool, so push/pop do not go through the global allocator.
+ * push_bulk() and pop_k() insert or remove a whole batch in a single traversal.
  *
  * @tparam T Element type. Must have numeric_limits specialized.
  * @tparam Compare Comparison function object type. Defaults to std::less<T>,
  * resulting in smaller values having lower priority (max heap).
  * Use std::greater<T> for a min heap. Comparison defines order.
+ * @tparam Lock Per-node lock. DataStructure::SpinLock shrinks each node by the size of
+ * a std::mutex minus one byte; the lock is only held for a few pointer updates.
  */
-template <typename T, class Compare = std::less<T>>  // Added Compare parameter
+template <typename T, class Compare = std::less<T>, class Lock = std::mutex>
 class SortedLinkedList_FineLockPQ : public IPriorityQueue<T>
 {
 private:
-    FinePQNode<T> *head;                  // Pointer to head sentinel (lowest value)
-    FinePQNode<T> *tail;                  // Pointer to tail sentinel (highest value)
+    using Node = FinePQNode<T, Lock>;
+    using Pool = NodePool<Node>;
+
+    Node *head;                  // Pointer to head sentinel (lowest value)
+    Node *tail;                  // Pointer to tail sentinel (highest value)
     std::atomic<size_t> current_size{0};  // Tracks number of *data* nodes
     Compare comp;                         // Comparator instance
 
     // Helper: Locates and locks predecessor and current nodes using Hand-over-Hand.
     // Finds position based on the 'comp' comparator to maintain sorted order.
     // Returns {pred, curr} locked. Caller must unlock. Sentinels ensure non-null.
-    std::pair<FinePQNode<T> *, FinePQNode<T> *> find_and_lock_for_push(const T &val) const
+    std::pair<Node *, Node *> find_and_lock_for_push(const T &val) const
     {
-        FinePQNode<T> *pred = head;
+        Node *pred = head;
         pred->lock();
-        FinePQNode<T> *curr = head->next;
+        Node *curr = head->next;
         assert(curr != nullptr);  // Sentinel invariant
         curr->lock();
 
@@ -106,44 +117,32 @@ public:
         T min_val = std::numeric_limits<T>::lowest();
         T max_val = std::numeric_limits<T>::max();
 
-        // Allocate sentinels (can throw std::bad_alloc)
-        head = new FinePQNode<T>();
-        tail = new FinePQNode<T>();
-
-        // Use placement new to construct values within sentinels
+        // Allocate sentinels holding the extreme values (can throw std::bad_alloc)
+        tail = Pool::create(max_val);
         try
         {
-            new (&head->val) T(min_val);
-            new (&tail->val) T(max_val);
+            head = Pool::create(min_val, tail);  // Link head to tail
         }
         catch (...)
         {
-            delete head;  // Cleanup if value construction fails
-            delete tail;
-            throw;  // Re-throw the exception from T's constructor
+            Pool::destroy(tail);  // Cleanup if the second allocation fails
+            throw;
         }
-
-        head->next = tail;  // Link head to tail
     }
 
     // Destructor: Cleans up all nodes including sentinels
     ~SortedLinkedList_FineLockPQ() override
     {
-        FinePQNode<T> *current = head;
+        Node *current = head;
         while (current != nullptr)
         {
-            FinePQNode<T> *next_node = current->next;
-            // Explicitly call destructor for sentinel values constructed with placement new
-            if (current == head || current == tail)
-            {
-                std::destroy_at(&current->val);  // C++20
-            }
-            delete current;
+            Node *next_node = current->next;
+            Pool::destroy(current);
             current = next_node;
         }
     }
 
-    // Disable copy/move due to pointers and mutexes
+    // Disable copy/move due to pointers and per-node locks
     SortedLinkedList_FineLockPQ(const SortedLinkedList_FineLockPQ &) = delete;
     SortedLinkedList_FineLockPQ &operator=(const SortedLinkedList_FineLockPQ &) = delete;
     SortedLinkedList_FineLockPQ(SortedLinkedList_FineLockPQ &&) = delete;
@@ -154,9 +153,9 @@ public:
     void push(const T &val) override
     {
         // Allocate node first (can throw bad_alloc)
-        FinePQNode<T> *new_node = new FinePQNode<T>(val);
-        FinePQNode<T> *pred = nullptr;
-        FinePQNode<T> *curr = nullptr;
+        Node *new_node = Pool::create(val);
+        Node *pred = nullptr;
+        Node *curr = nullptr;
 
         try
         {
@@ -175,8 +174,8 @@ public:
         }
         catch (...)
         {
-            // If find or locking fails, ensure allocated node is deleted
-            delete new_node;
+            // If find or locking fails, ensure allocated node is released
+            Pool::destroy(new_node);
             // Attempt cleanup - robust error handling here is complex
             if (curr)
                 curr->unlock();
@@ -188,9 +187,9 @@ public:
 
     std::optional<T> pop() override
     {
-        FinePQNode<T> *pred_pred = nullptr;  // Node before the node to delete
-        FinePQNode<T> *node_to_delete = nullptr;
-        FinePQNode<T> *tail_sentinel_locked = nullptr;  // Tail sentinel alias
+        Node *pred_pred = nullptr;  // Node before the node to delete
+        Node *node_to_delete = nullptr;
+        Node *tail_sentinel_locked = nullptr;  // Tail sentinel alias
 
         // Acquire locks hand-over-hand to find node before tail
         pred_pred = head;
@@ -210,7 +209,7 @@ public:
         // Traverse until node_to_delete->next is the tail sentinel
         while (node_to_delete->next != tail)
         {
-            FinePQNode<T> *next_node = node_to_delete->next;
+            Node *next_node = node_to_delete->next;
             assert(next_node != nullptr);  // Invariant check
             next_node->lock();
             pred_pred->unlock();
@@ -235,12 +234,130 @@ public:
         node_to_delete->unlock();
         pred_pred->unlock();
 
-        // Delete the node (Consider deferred reclamation for production systems)
-        delete node_to_delete;
+        // Recycle the node. No other thread can still reach it: every traversal holds
+        // the predecessor's lock before following 'next'.
+        Pool::destroy(node_to_delete);
 
         return {std::move(value_to_return)};  // Return moved value in optional
     }
 
+    // Inserts the batch in one hand-over-hand traversal instead of one per element:
+    // the new nodes are sorted (stably, so equal priorities keep the FIFO order of
+    // single pushes) and each is linked in as the traversal passes its position.
+    void push_bulk(std::span<const T> values) override
+    {
+        if (values.size() <= 1)
+        {
+            if (!values.empty())
+                push(values.front());
+            return;
+        }
+
+        // Allocate every node before taking a lock (can throw bad_alloc)
+        std::vector<Node *> nodes;
+        nodes.reserve(values.size());
+        try
+        {
+            for (const T &val : values)
+                nodes.push_back(Pool::create(val));
+        }
+        catch (...)
+        {
+            for (Node *node : nodes)
+                Pool::destroy(node);
+            throw;
+        }
+        std::stable_sort(nodes.begin(), nodes.end(),
+                         [this](const Node *a, const Node *b) { return comp(a->val, b->val); });
+
+        Node *pred = head;
+        pred->lock();
+        Node *curr = head->next;
+        assert(curr != nullptr);  // Sentinel invariant
+        curr->lock();
+
+        for (Node *new_node : nodes)
+        {
+            // Same stopping rule as find_and_lock_for_push(), resumed from the last insertion
+            while (curr != tail && comp(curr->val, new_node->val))
+            {
+                pred->unlock();
+                pred = curr;  // pred remains locked
+                curr = curr->next;
+                assert(curr != nullptr);  // Sentinel invariant
+                curr->lock();
+            }
+
+            // Link pred -> new_node -> curr. The traversal continues with new_node as curr
+            // (locked before it becomes reachable), so a later equal value lands in front of
+            // it, exactly where a single push would put it.
+            new_node->lock();
+            new_node->next = curr;
+            pred->next = new_node;
+            curr->unlock();
+            curr = new_node;
+        }
+
+        current_size.fetch_add(nodes.size(), std::memory_order_relaxed);
+        curr->unlock();
+        pred->unlock();
+    }
+
+    // Removes the k nodes in front of the tail in one traversal instead of k. The
+    // traversal keeps the k + 1 most recently locked nodes locked, so on reaching the tail
+    // the predecessor of the top-k run is still held and one pointer write unlinks the run.
+    size_t pop_k(size_t k, std::vector<T> &out) override
+    {
+        if (k <= 1)
+            return IPriorityQueue<T>::pop_k(k, out);
+
+        // Ring buffer of locked nodes in list order; window[first] precedes the rest
+        std::vector<Node *> window(k + 1);
+        size_t first = 0;
+        size_t count = 1;
+        window[0] = head;
+        head->lock();
+
+        Node *last = head;
+        while (last->next != tail)
+        {
+            Node *next_node = last->next;
+            assert(next_node != nullptr);  // Invariant check
+            next_node->lock();
+            if (count == window.size())
+            {
+                // Window full: release its oldest node, which now precedes more than k nodes
+                window[first]->unlock();
+                window[first] = next_node;
+                first = (first + 1) % window.size();
+            }
+            else
+            {
+                window[(first + count) % window.size()] = next_node;
+                ++count;
+            }
+            last = next_node;
+        }
+        Node *tail_sentinel_locked = last->next;
+        tail_sentinel_locked->lock();
+
+        // Unlink window[first + 1 ..] and hand out their values, highest priority first
+        const size_t taken = count - 1;
+        window[first]->next = tail_sentinel_locked;
+        for (size_t i = count - 1; i >= 1; --i)
+            out.push_back(std::move(window[(first + i) % window.size()]->val));
+        current_size.fetch_sub(taken, std::memory_order_relaxed);
+
+        tail_sentinel_locked->unlock();
+        for (size_t i = 0; i < count; ++i)
+            window[(first + i) % window.size()]->unlock();
+
+        // Recycle the unlinked nodes (unreachable, see pop())
+        for (size_t i = 1; i < count; ++i)
+            Pool::destroy(window[(first + i) % window.size()]);
+        return taken;
+    }
+
     bool empty() const override
     {
         // Reading atomic variable is thread-safe.
@@ -256,8 +373,8 @@ public:
     bool check_invariants() const override
     {
         // WARNING: NOT THREAD-SAFE - Assumes list is quiescent. No locks acquired.
-        [[maybe_unused]] FinePQNode<T> *pred = head;  // Decorated to avoid unused warning
-        FinePQNode<T> *curr = head->next;
+        [[maybe_unused]] Node *pred = head;  // Decorated to avoid unused warning
+        Node *curr = head->next;
         assert(head != nullptr && tail != nullptr);  // Basic sentinel check
 
         [[maybe_unused]] size_t count = 0;  // Decorated to avoid unused warning
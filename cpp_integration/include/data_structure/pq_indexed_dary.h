@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // For std::less (default comparator)
+#include <limits>
+#include <utility>  // For std::pair
+#include <vector>
+
+namespace DataStructure
+{
+namespace PriorityQueue
+{
+
+/**
+ * @brief Sequential d-ary heap over dense integer ids with decrease_key, update_key and erase.
+ *
+ * Every id in [0, capacity) can be in the heap at most once. A position array keyed by
+ * id remembers where each id sits, so contains() is O(1) and an improved key is sifted
+ * up in place instead of inserting a duplicate entry. Heap slots store the key next to
+ * the id, so sifting compares keys without touching the position array.
+ *
+ * Positions are cleared lazily: pop() resets the popped id and clear() resets only the
+ * ids still stored, so a heap reused across queries never walks the whole id range.
+ *
+ * Not thread-safe and not an IPriorityQueue: the interface is keyed by id, not by value.
+ *
+ * @tparam Arity Children per node (2 = binary heap). Wider heaps are shallower and
+ * sift-up cheaper, at the cost of more comparisons per sift-down.
+ * @tparam Key Priority type.
+ * @tparam Compare Comparison function object type. Defaults to std::less<Key>,
+ * resulting in larger keys having higher priority. Use std::greater<Key> for a min
+ * heap (e.g. A* open sets keyed by f-score).
+ */
+template <size_t Arity, typename Key, class Compare = std::less<Key>>
+class IndexedDaryHeap
+{
+    static_assert(Arity >= 2, "IndexedDaryHeap needs at least two children per node");
+
+public:
+    using Index = std::uint32_t;
+
+    // Position of an id that is not in the heap
+    static constexpr Index NOT_IN_HEAP = std::numeric_limits<Index>::max();
+
+    explicit IndexedDaryHeap(size_t capacity = 0) { reserve_ids(capacity); }
+
+    // Makes ids in [0, capacity) usable. Never shrinks; keeps the current contents.
+    void reserve_ids(size_t capacity)
+    {
+        if (position.size() < capacity)
+            position.resize(capacity, NOT_IN_HEAP);
+    }
+
+    // Number of usable ids
+    size_t capacity() const { return position.size(); }
+
+    bool empty() const { return heap.empty(); }
+
+    size_t size() const { return heap.size(); }
+
+    bool contains(Index id) const { return position[id] != NOT_IN_HEAP; }
+
+    // Key of an id that is in the heap
+    const Key &key_of(Index id) const { return heap[position[id]].key; }
+
+    // Highest priority entry; heap must not be empty
+    std::pair<Index, Key> top() const { return {heap.front().id, heap.front().key}; }
+
+    // Inserts an id that is not in the heap yet
+    void push(Index id, const Key &key)
+    {
+        heap.push_back({key, id});
+        position[id] = static_cast<Index>(heap.size() - 1);
+        sift_up(heap.size() - 1);
+    }
+
+    // Raises the priority of an id that is in the heap; key must not be lower priority
+    void decrease_key(Index id, const Key &key)
+    {
+        size_t slot = position[id];
+        heap[slot].key = key;
+        sift_up(slot);
+    }
+
+    // push() or decrease_key(), whichever applies. Returns false (and leaves the heap
+    // unchanged) if id is already stored with an equal or higher priority.
+    bool push_or_decrease(Index id, const Key &key)
+    {
+        if (!contains(id))
+        {
+            push(id, key);
+            return true;
+        }
+        if (!comp(heap[position[id]].key, key))
+            return false;
+        decrease_key(id, key);
+        return true;
+    }
+
+    // Changes the key of an id that is in the heap, in either direction (incremental
+    // searches such as D* Lite also lower priorities)
+    void update_key(Index id, const Key &key)
+    {
+        size_t slot = position[id];
+        const bool raised = comp(heap[slot].key, key);
+        heap[slot].key = key;
+        if (raised)
+            sift_up(slot);
+        else
+            sift_down(slot);
+    }
+
+    // Removes an id that is in the heap, wherever it sits
+    void erase(Index id)
+    {
+        size_t slot = position[id];
+        position[id] = NOT_IN_HEAP;
+        Slot last = heap.back();
+        heap.pop_back();
+        if (slot == heap.size())
+            return;
+        heap[slot] = last;
+        position[last.id] = static_cast<Index>(slot);
+        // The moved entry may belong above or below its new slot
+        if (slot > 0 && comp(heap[(slot - 1) / Arity].key, last.key))
+            sift_up(slot);
+        else
+            sift_down(slot);
+    }
+
+    // Removes and returns the highest priority entry; heap must not be empty
+    std::pair<Index, Key> pop()
+    {
+        Slot result = heap.front();
+        position[result.id] = NOT_IN_HEAP;
+        Slot last = heap.back();
+        heap.pop_back();
+        if (!heap.empty())
+        {
+            heap.front() = last;
+            position[last.id] = 0;
+            sift_down(0);
+        }
+        return {result.id, result.key};
+    }
+
+    // Empties the heap in O(size()), independent of capacity()
+    void clear()
+    {
+        for (const Slot &slot : heap)
+            position[slot.id] = NOT_IN_HEAP;
+        heap.clear();
+    }
+
+    // Heap order holds and every stored id points back at its slot
+    bool check_invariants() const
+    {
+        for (size_t slot = 0; slot < heap.size(); ++slot)
+        {
+            if (heap[slot].id >= position.size() || position[heap[slot].id] != slot)
+                return false;
+            if (slot > 0 && comp(heap[(slot - 1) / Arity].key, heap[slot].key))
+                return false;
+        }
+        size_t stored = 0;
+        for (Index pos : position)
+            stored += (pos != NOT_IN_HEAP);
+        return stored == heap.size();
+    }
+
+private:
+    struct Slot
+    {
+        Key key;
+        Index id;
+    };
+
+    std::vector<Slot> heap;       // Implicit d-ary tree, children of i at Arity*i+1 ..
+    std::vector<Index> position;  // id -> slot in heap, NOT_IN_HEAP if absent
+    Compare comp;
+
+    // Moves the entry at slot towards the root while its parent has lower priority
+    void sift_up(size_t slot)
+    {
+        Slot moving = heap[slot];
+        while (slot > 0)
+        {
+            size_t parent = (slot - 1) / Arity;
+            if (!comp(heap[parent].key, moving.key))
+                break;
+            heap[slot] = heap[parent];
+            position[heap[slot].id] = static_cast<Index>(slot);
+            slot = parent;
+        }
+        heap[slot] = moving;
+        position[moving.id] = static_cast<Index>(slot);
+    }
+
+    // Moves the entry at slot down while some child has higher priority
+    void sift_down(size_t slot)
+    {
+        Slot moving = heap[slot];
+        const size_t count = heap.size();
+        while (true)
+        {
+            size_t first_child = Arity * slot + 1;
+            if (first_child >= count)
+                break;
+            size_t last_child = (first_child + Arity < count) ? first_child + Arity : count;
+
+            size_t best = first_child;
+            for (size_t child = first_child + 1; child < last_child; ++child)
+                if (comp(heap[best].key, heap[child].key))
+                    best = child;
+            if (!comp(moving.key, heap[best].key))
+                break;
+
+            heap[slot] = heap[best];
+            position[heap[slot].id] = static_cast<Index>(slot);
+            slot = best;
+        }
+        heap[slot] = moving;
+        position[moving.id] = static_cast<Index>(slot);
+    }
+};
+
+}  // namespace PriorityQueue
+}  // namespace DataStructure
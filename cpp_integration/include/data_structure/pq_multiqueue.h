@@ -0,0 +1,293 @@
+#pragma once
+
+#include "ipq.h"  // Include the interface definition
+#include <algorithm>  // For std::push_heap, std::pop_heap, std::is_heap
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // For std::less (default comparator)
+#include <memory>      // For std::unique_ptr
+#include <mutex>
+#include <optional>  // For pop() return type
+#include <span>
+#include <thread>    // For std::thread::hardware_concurrency
+#include <utility>   // For std::move
+#include <vector>
+
+namespace DataStructure
+{
+namespace PriorityQueue
+{
+
+/**
+ * @brief A relaxed concurrent priority queue (MultiQueue).
+ *
+ * Implements the IPriorityQueue interface with c * p independent binary heaps, each
+ * guarded by its own mutex. push() inserts into one random heap; pop() looks at two
+ * random heaps and removes the larger of their tops ("power of two choices"). With
+ * uniform random placement the popped element is close to the global maximum in rank,
+ * while threads rarely touch the same heap at the same time.
+ *
+ * Relaxed semantics: pop() is NOT guaranteed to return the highest priority element,
+ * and equal priorities are not FIFO. Users must tolerate slightly out-of-order pops
+ * (e.g. A* with re-expansion and an incumbent bound). pop() returns std::nullopt only
+ * after checking every heap, so it never reports empty while elements are quiescently
+ * stored.
+ *
+ * push_bulk() puts a whole batch into one random heap under one lock; pop_k() takes the
+ * best k of two random heaps under one pair of locks (as relaxed as k single pops).
+ *
+ * @tparam T Element type.
+ * @tparam Compare Comparison function object type. Defaults to std::less<T>,
+ * resulting in larger values having higher priority. Use std::greater<T> for a min
+ * queue.
+ */
+template <typename T, class Compare = std::less<T>>
+class MultiQueuePQ : public IPriorityQueue<T>
+{
+private:
+    // One heap per cache line so neighboring heaps do not false-share their locks
+    struct alignas(64) SubQueue
+    {
+        std::mutex mutex;
+        std::vector<T> heap;  // Max-heap under comp (front = highest priority)
+    };
+
+    std::unique_ptr<SubQueue[]> queues;
+    size_t num_queues;
+    std::atomic<size_t> current_size{0};
+    Compare comp;
+
+    // Per-thread xorshift generator; cheap and good enough for load balancing
+    static std::uint64_t next_random()
+    {
+        thread_local std::uint64_t state =
+            0x9E3779B97F4A7C15ull ^ reinterpret_cast<std::uintptr_t>(&state);
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    size_t random_queue() { return static_cast<size_t>(next_random() % num_queues); }
+
+    // Pops the top of a locked sub-queue
+    T take_top(SubQueue &queue)
+    {
+        std::pop_heap(queue.heap.begin(), queue.heap.end(), comp);
+        T value = std::move(queue.heap.back());
+        queue.heap.pop_back();
+        current_size.fetch_sub(1, std::memory_order_relaxed);
+        return value;
+    }
+
+    // Pushes under the lock of one random heap, preferring uncontended ones; after a few
+    // misses just waits for one
+    template <class Insert>
+    void push_locked(Insert insert)
+    {
+        for (int attempt = 0;; ++attempt)
+        {
+            SubQueue &queue = queues[random_queue()];
+            std::unique_lock<std::mutex> lock(queue.mutex, std::defer_lock);
+            if (attempt < 4)
+                lock.try_lock();
+            else
+                lock.lock();
+
+            if (lock.owns_lock())
+            {
+                insert(queue.heap);
+                return;
+            }
+        }
+    }
+
+    // Moves up to k of the best tops of two locked sub-queues to out
+    size_t take_best(SubQueue &first, SubQueue &second, size_t k, std::vector<T> &out)
+    {
+        size_t taken = 0;
+        for (; taken < k; ++taken)
+        {
+            if (second.heap.empty() || (!first.heap.empty() && !comp(first.heap.front(), second.heap.front())))
+            {
+                if (first.heap.empty())
+                    break;
+                out.push_back(take_top(first));
+            }
+            else
+            {
+                out.push_back(take_top(second));
+            }
+        }
+        return taken;
+    }
+
+    // Fallback when random probing found nothing: sweep every heap once
+    std::optional<T> pop_any()
+    {
+        for (size_t i = 0; i < num_queues; ++i)
+        {
+            std::lock_guard<std::mutex> lock(queues[i].mutex);
+            if (!queues[i].heap.empty())
+                return {take_top(queues[i])};
+        }
+        return std::nullopt;
+    }
+
+public:
+    // Default number of heaps per thread; c = 2 is the usual MultiQueue choice
+    static constexpr size_t QUEUES_PER_THREAD = 2;
+
+    // Constructor: num_queues = 0 picks QUEUES_PER_THREAD * hardware threads
+    explicit MultiQueuePQ(size_t num_queues_ = 0) : num_queues(num_queues_), comp()
+    {
+        if (num_queues == 0)
+            num_queues = QUEUES_PER_THREAD * std::max(1u, std::thread::hardware_concurrency());
+        queues = std::make_unique<SubQueue[]>(num_queues);
+    }
+
+    ~MultiQueuePQ() override = default;
+
+    // Disable copy/move due to mutexes
+    MultiQueuePQ(const MultiQueuePQ &) = delete;
+    MultiQueuePQ &operator=(const MultiQueuePQ &) = delete;
+    MultiQueuePQ(MultiQueuePQ &&) = delete;
+    MultiQueuePQ &operator=(MultiQueuePQ &&) = delete;
+
+    // --- IPriorityQueue Interface Methods ---
+
+    void push(const T &val) override
+    {
+        push_locked(
+            [&](std::vector<T> &heap)
+            {
+                heap.push_back(val);
+                std::push_heap(heap.begin(), heap.end(), comp);
+                current_size.fetch_add(1, std::memory_order_relaxed);
+            });
+    }
+
+    // The whole batch goes into one heap: one lock acquisition instead of one per element
+    void push_bulk(std::span<const T> values) override
+    {
+        if (values.empty())
+            return;
+        push_locked(
+            [&](std::vector<T> &heap)
+            {
+                for (const T &val : values)
+                {
+                    heap.push_back(val);
+                    std::push_heap(heap.begin(), heap.end(), comp);
+                }
+                current_size.fetch_add(values.size(), std::memory_order_relaxed);
+            });
+    }
+
+    std::optional<T> pop() override
+    {
+        if (current_size.load(std::memory_order_acquire) == 0)
+            return std::nullopt;
+        if (num_queues == 1)
+            return pop_any();
+
+        // Two-choice pop over a few attempts; lock pairs in index order to avoid deadlock
+        for (int attempt = 0; attempt < 4; ++attempt)
+        {
+            size_t i = random_queue();
+            size_t j = random_queue();
+            if (i == j)
+                j = (j + 1) % num_queues;
+            if (j < i)
+                std::swap(i, j);
+
+            std::unique_lock<std::mutex> lock_i(queues[i].mutex, std::try_to_lock);
+            if (!lock_i.owns_lock())
+                continue;
+            std::unique_lock<std::mutex> lock_j(queues[j].mutex, std::try_to_lock);
+            if (!lock_j.owns_lock())
+                continue;
+
+            std::vector<T> &heap_i = queues[i].heap;
+            std::vector<T> &heap_j = queues[j].heap;
+            if (heap_i.empty() && heap_j.empty())
+                continue;
+            if (heap_j.empty() || (!heap_i.empty() && !comp(heap_i.front(), heap_j.front())))
+                return {take_top(queues[i])};
+            return {take_top(queues[j])};
+        }
+        return pop_any();
+    }
+
+    size_t pop_k(size_t k, std::vector<T> &out) override
+    {
+        if (k == 0 || current_size.load(std::memory_order_acquire) == 0)
+            return 0;
+
+        // Same two-choice probing as pop(), merging the two heaps' tops up to k elements
+        if (num_queues > 1)
+        {
+            for (int attempt = 0; attempt < 4; ++attempt)
+            {
+                size_t i = random_queue();
+                size_t j = random_queue();
+                if (i == j)
+                    j = (j + 1) % num_queues;
+                if (j < i)
+                    std::swap(i, j);
+
+                std::unique_lock<std::mutex> lock_i(queues[i].mutex, std::try_to_lock);
+                if (!lock_i.owns_lock())
+                    continue;
+                std::unique_lock<std::mutex> lock_j(queues[j].mutex, std::try_to_lock);
+                if (!lock_j.owns_lock())
+                    continue;
+
+                if (size_t taken = take_best(queues[i], queues[j], k, out))
+                    return taken;
+            }
+        }
+
+        // Sweep every heap once, as pop_any() does
+        size_t taken = 0;
+        for (size_t i = 0; i < num_queues && taken < k; ++i)
+        {
+            std::lock_guard<std::mutex> lock(queues[i].mutex);
+            while (taken < k && !queues[i].heap.empty())
+            {
+                out.push_back(take_top(queues[i]));
+                ++taken;
+            }
+        }
+        return taken;
+    }
+
+    bool empty() const override
+    {
+        // Reading atomic variable is thread-safe.
+        return current_size.load(std::memory_order_acquire) == 0;
+    }
+
+    size_t size() const override
+    {
+        // Reading atomic variable is thread-safe.
+        return current_size.load(std::memory_order_acquire);
+    }
+
+    bool check_invariants() const override
+    {
+        // WARNING: NOT THREAD-SAFE - Assumes queue is quiescent. No locks acquired.
+        size_t count = 0;
+        for (size_t i = 0; i < num_queues; ++i)
+        {
+            if (!std::is_heap(queues[i].heap.begin(), queues[i].heap.end(), comp))
+                return false;
+            count += queues[i].heap.size();
+        }
+        return count == current_size.load(std::memory_order_relaxed);
+    }
+};
+
+}  // namespace PriorityQueue
+}  // namespace DataStructure
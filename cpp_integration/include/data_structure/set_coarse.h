@@ -1,6 +1,7 @@
 #pragma once
 
 #include "iset.h"   // Include the common interface
+#include "node_pool.h"  // For NodePool
 #include <atomic>   // For std::atomic
 #include <cstddef>  // For size_t
 #include <limits>
@@ -26,11 +27,13 @@ struct CoarseNode
     CoarseNode(T v, CoarseNode<T> *n = nullptr) : val(std::move(v)), next(n) { }
 };
 
-// Coarse-Grained Locking Implementation
+// Coarse-Grained Locking Implementation (nodes come from a NodePool)
 template <typename T>
 class SortedLinkedList_CoarseLock : public ISet<T>
 {
 private:
+    using Pool = NodePool<CoarseNode<T>>;
+
     CoarseNode<T> *head;
     CoarseNode<T> *tail;
     mutable std::shared_mutex list_mutex;  // Mutex for the whole list
@@ -66,14 +69,14 @@ public:
                 throw std::logic_error("Type T requires std::numeric_limits specialization.");
             }
             // Allocate tail first, then head pointing to tail
-            tail = new CoarseNode<T>(max_val, nullptr);
-            head = new CoarseNode<T>(min_val, tail);
+            tail = Pool::create(max_val, nullptr);
+            head = Pool::create(min_val, tail);
         }
         catch (...)
         {
             // Clean up if allocation fails
-            delete head;
-            delete tail;
+            Pool::destroy(head);
+            Pool::destroy(tail);
             throw std::runtime_error("SortedLinkedList_CoarseLock construction failed.");
         }
     }
@@ -86,7 +89,7 @@ public:
         while (current != nullptr)
         {
             CoarseNode<T> *next_node = current->next;
-            delete current;
+            Pool::destroy(current);
             current = next_node;
         }
     }
@@ -128,7 +131,7 @@ public:
             // Add the node
             try
             {
-                CoarseNode<T> *new_node = new CoarseNode<T>(val, curr);
+                CoarseNode<T> *new_node = Pool::create(val, curr);
                 pred->next = new_node;
                 current_size.fetch_add(1, std::memory_order_relaxed);  // Increment size
                 success = true;
@@ -157,7 +160,7 @@ public:
             // Decrement size *before* deleting node to maintain consistency if delete throws
             // (unlikely here)
             current_size.fetch_sub(1, std::memory_order_relaxed);
-            delete curr;  // Deallocate the removed node
+            Pool::destroy(curr);  // Recycle the removed node
             success = true;
         }
         else
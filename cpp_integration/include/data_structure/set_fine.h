@@ -1,6 +1,7 @@
 #pragma once
 
 #include "iset.h"   // Include the common interface
+#include "node_pool.h"  // For NodePool
 #include <atomic>   // For std::atomic
 #include <cstddef>  // For size_t
 #include <limits>
@@ -15,17 +16,18 @@ namespace Set
 {
 
 // Node Structure for Fine-Grained Implementation
-template <typename T>
+// Lock is std::mutex or the 1-byte DataStructure::SpinLock
+template <typename T, class Lock = std::mutex>
 struct FineNode
 {
     T val;
-    FineNode<T> *next;
-    std::mutex node_mutex;  // Mutex for each node
+    FineNode *next;
+    Lock node_mutex;  // Lock for each node
 
-    FineNode(T v, FineNode<T> *n = nullptr) : val(std::move(v)), next(n) { }
+    FineNode(T v, FineNode *n = nullptr) : val(std::move(v)), next(n) { }
 
     // Default destructor ok
-    // No copy/move for mutex (implicitly deleted/defaulted)
+    // No copy/move for the lock (implicitly deleted/defaulted)
 
     void lock() { node_mutex.lock(); }
 
@@ -33,19 +35,23 @@ struct FineNode
 };
 
 // Fine-Grained Locking Implementation
-template <typename T>
+// Nodes come from a NodePool; Lock selects the per-node lock (see FineNode)
+template <typename T, class Lock = std::mutex>
 class SortedLinkedList_FineLock : public ISet<T>
 {
 private:
-    FineNode<T> *head;
-    FineNode<T> *tail;
+    using Node = FineNode<T, Lock>;
+    using Pool = NodePool<Node>;
+
+    Node *head;
+    Node *tail;
     std::atomic<size_t> current_size{0};  // Atomic counter for size
 
     // Helper: Locates and locks predecessor and current nodes using Hand-over-Hand.
     // Returns {pred, curr} locked. Caller must unlock.
-    std::pair<FineNode<T> *, FineNode<T> *> find_and_lock_hoh(const T &val) const
+    std::pair<Node *, Node *> find_and_lock_hoh(const T &val) const
     {
-        FineNode<T> *pred = nullptr, *curr = nullptr;
+        Node *pred = nullptr, *curr = nullptr;
         pred = head;
         pred->lock();
         curr = pred->next;
@@ -76,10 +82,10 @@ private:
 
     // Internal unsafe getter for head (needed for unsafe check_invariants)
     // USE WITH EXTREME CAUTION - only when list is quiescent.
-    FineNode<T> *get_head_unsafe() const { return head; }
+    Node *get_head_unsafe() const { return head; }
 
     // Internal unsafe getter for tail (needed for unsafe check_invariants)
-    FineNode<T> *get_tail_unsafe() const { return tail; }
+    Node *get_tail_unsafe() const { return tail; }
 
 public:
     // Constructor
@@ -98,13 +104,13 @@ public:
                 throw std::logic_error(
                     "Type T requires std::numeric_limits specialization for sentinels.");
             }
-            tail = new FineNode<T>(max_val, nullptr);
-            head = new FineNode<T>(min_val, tail);
+            tail = Pool::create(max_val, nullptr);
+            head = Pool::create(min_val, tail);
         }
         catch (...)
         {
-            delete head;
-            delete tail;
+            Pool::destroy(head);
+            Pool::destroy(tail);
             throw std::runtime_error("SortedLinkedList_FineLock construction failed.");
         }
     }
@@ -113,11 +119,11 @@ public:
     ~SortedLinkedList_FineLock() override
     {
         // No locking needed during destruction (assume single-threaded context)
-        FineNode<T> *current = head;
+        Node *current = head;
         while (current != nullptr)
         {
-            FineNode<T> *next_node = current->next;
-            delete current;
+            Node *next_node = current->next;
+            Pool::destroy(current);
             current = next_node;
         }
     }
@@ -126,7 +132,7 @@ public:
     SortedLinkedList_FineLock(const SortedLinkedList_FineLock &) = delete;
     SortedLinkedList_FineLock &operator=(const SortedLinkedList_FineLock &) = delete;
 
-    // Explicitly delete move semantics due to mutex members in nodes and potential complexity
+    // Explicitly delete move semantics due to lock members in nodes and potential complexity
     SortedLinkedList_FineLock(SortedLinkedList_FineLock &&) = delete;
     SortedLinkedList_FineLock &operator=(SortedLinkedList_FineLock &&) = delete;
 
@@ -134,7 +140,7 @@ public:
 
     bool contains(const T &val) const override
     {
-        FineNode<T> *pred = nullptr, *curr = nullptr;
+        Node *pred = nullptr, *curr = nullptr;
         bool result = false;
         try
         {
@@ -162,7 +168,7 @@ public:
 
     bool add(const T &val) override
     {
-        FineNode<T> *pred = nullptr, *curr = nullptr;
+        Node *pred = nullptr, *curr = nullptr;
         bool success = false;
         try
         {
@@ -177,7 +183,7 @@ public:
             else
             {
                 // Value doesn't exist, add it
-                FineNode<T> *new_node = new FineNode<T>(val, curr);
+                Node *new_node = Pool::create(val, curr);
                 pred->next = new_node;
                 // Update size atomically while locks are held
                 current_size.fetch_add(1, std::memory_order_relaxed);
@@ -186,7 +192,7 @@ public:
         }
         catch (const std::bad_alloc &e)
         {
-            // Exception during 'new FineNode'. Locks must be released.
+            // Exception during node allocation. Locks must be released.
             if (curr)
                 curr->unlock();
             if (pred)
@@ -212,8 +218,8 @@ public:
 
     bool remove(const T &val) override
     {
-        FineNode<T> *pred = nullptr, *curr = nullptr;
-        FineNode<T> *node_to_delete = nullptr;
+        Node *pred = nullptr, *curr = nullptr;
+        Node *node_to_delete = nullptr;
         bool success = false;
         try
         {
@@ -252,9 +258,9 @@ public:
         if (pred)
             pred->unlock();  // Unlock predecessor node
 
-        // Delete the node after releasing locks
-        // Note: Potential ABA/memory reclamation issues in robust systems. Simple delete here.
-        delete node_to_delete;
+        // Recycle the node after releasing locks. Hand-over-hand traversals hold the
+        // predecessor's lock before following 'next', so nobody can still reach it.
+        Pool::destroy(node_to_delete);
 
         return success;
     }
@@ -273,10 +279,10 @@ public:
     {
         // This check traverses without locks. It is inherently unsafe
         // if the list is being modified concurrently. Use only for post-test validation.
-        FineNode<T> *h = get_head_unsafe();  // Use unsafe getter
-        FineNode<T> *t = get_tail_unsafe();  // Use unsafe getter
-        FineNode<T> *pred = h;
-        FineNode<T> *curr = h->next;
+        Node *h = get_head_unsafe();  // Use unsafe getter
+        Node *t = get_tail_unsafe();  // Use unsafe getter
+        Node *pred = h;
+        Node *curr = h->next;
 
         if (!h || !t || h->next == nullptr)
             return false;  // Basic structure check
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "epoch_reclamation.h"  // For EpochDomain
+#include "iset.h"               // Include the common interface
+#include "node_pool.h"          // For NodePool
+#include <atomic>               // For std::atomic
+#include <cstddef>              // For size_t
+#include <limits>
+#include <mutex>  // For std::mutex, std::lock_guard
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>  // For std::pair
+
+namespace DataStructure
+{
+namespace Set
+{
+
+// Node Structure for the Lazy Implementation
+// Lock is std::mutex or the 1-byte DataStructure::SpinLock
+template <typename T, class Lock = std::mutex>
+struct LazyNode
+{
+    const T val;
+    std::atomic<LazyNode *> next;
+    std::atomic<bool> marked{false};  // Set before unlinking: logically removed
+    Lock node_mutex;
+
+    LazyNode(T v, LazyNode *n = nullptr) : val(std::move(v)), next(n) { }
+
+    void lock() { node_mutex.lock(); }
+
+    void unlock() { node_mutex.unlock(); }
+};
+
+// Lazy Synchronization Implementation
+//
+// add/remove search without locks, then lock pred and curr and validate that both are
+// unmarked and still adjacent; on failure they retry. remove marks the node before
+// unlinking it, so contains() can run wait-free: one unlocked traversal plus a mark
+// check, never blocked by writers. This suits read-mostly sets such as closed-set
+// lookups from many search threads.
+//
+// Unlocked readers may still stand on an unlinked node, so removed nodes are retired
+// through EpochDomain and recycled into the NodePool only once no reader can reach them.
+template <typename T, class Lock = std::mutex>
+class SortedLinkedList_Lazy : public ISet<T>
+{
+private:
+    using Node = LazyNode<T, Lock>;
+    using Pool = NodePool<Node>;
+
+    Node *head;
+    Node *tail;
+    std::atomic<size_t> current_size{0};  // Atomic counter for size
+
+    // Helper: Unlocked search. Returns {pred, curr} with pred->val < val <= curr->val
+    // (curr may be tail). Caller must hold an EpochDomain::Guard.
+    std::pair<Node *, Node *> find(const T &val) const
+    {
+        Node *pred = head;
+        Node *curr = pred->next.load(std::memory_order_acquire);
+        while (curr != tail && curr->val < val)
+        {
+            pred = curr;
+            curr = curr->next.load(std::memory_order_acquire);
+        }
+        return {pred, curr};
+    }
+
+    // Helper: Both nodes are still in the list and adjacent. Caller holds both locks.
+    static bool validate(Node *pred, Node *curr)
+    {
+        return !pred->marked.load(std::memory_order_relaxed)
+               && !curr->marked.load(std::memory_order_relaxed)
+               && pred->next.load(std::memory_order_relaxed) == curr;
+    }
+
+public:
+    // Constructor
+    SortedLinkedList_Lazy() : head(nullptr), tail(nullptr)
+    {
+        try
+        {
+            T min_val, max_val;
+            if constexpr (std::numeric_limits<T>::is_specialized)
+            {
+                min_val = std::numeric_limits<T>::lowest();
+                max_val = std::numeric_limits<T>::max();
+            }
+            else
+            {
+                throw std::logic_error(
+                    "Type T requires std::numeric_limits specialization for sentinels.");
+            }
+            tail = Pool::create(max_val, nullptr);
+            head = Pool::create(min_val, tail);
+        }
+        catch (...)
+        {
+            Pool::destroy(head);
+            Pool::destroy(tail);
+            throw std::runtime_error("SortedLinkedList_Lazy construction failed.");
+        }
+    }
+
+    // Destructor: frees the linked nodes; already retired ones belong to the EpochDomain
+    ~SortedLinkedList_Lazy() override
+    {
+        // No locking needed during destruction (assume single-threaded context)
+        Node *current = head;
+        while (current != nullptr)
+        {
+            Node *next_node = current->next.load(std::memory_order_relaxed);
+            Pool::destroy(current);
+            current = next_node;
+        }
+    }
+
+    // Disable copy and move semantics (nodes hold locks, readers hold raw pointers)
+    SortedLinkedList_Lazy(const SortedLinkedList_Lazy &) = delete;
+    SortedLinkedList_Lazy &operator=(const SortedLinkedList_Lazy &) = delete;
+    SortedLinkedList_Lazy(SortedLinkedList_Lazy &&) = delete;
+    SortedLinkedList_Lazy &operator=(SortedLinkedList_Lazy &&) = delete;
+
+    // --- ISet Interface Methods ---
+
+    // Wait-free: a single traversal, no locks, no retries
+    bool contains(const T &val) const override
+    {
+        EpochDomain::Guard guard;
+        Node *curr = head->next.load(std::memory_order_acquire);
+        while (curr != tail && curr->val < val)
+            curr = curr->next.load(std::memory_order_acquire);
+        return curr != tail && curr->val == val && !curr->marked.load(std::memory_order_acquire);
+    }
+
+    bool add(const T &val) override
+    {
+        EpochDomain::Guard guard;
+        while (true)
+        {
+            auto [pred, curr] = find(val);
+            std::lock_guard<Node> pred_lock(*pred);
+            std::lock_guard<Node> curr_lock(*curr);
+            if (!validate(pred, curr))
+                continue;  // Raced with a writer; search again
+
+            if (curr != tail && curr->val == val)
+                return false;  // Already exists
+
+            try
+            {
+                Node *new_node = Pool::create(val, curr);
+                // Release: readers that see the node also see its value and next
+                pred->next.store(new_node, std::memory_order_release);
+            }
+            catch (const std::bad_alloc &e)
+            {
+                throw std::runtime_error("Failed node allocation in add: " + std::string(e.what()));
+            }
+            current_size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    bool remove(const T &val) override
+    {
+        EpochDomain::Guard guard;
+        Node *removed = nullptr;
+        while (removed == nullptr)
+        {
+            auto [pred, curr] = find(val);
+            std::lock_guard<Node> pred_lock(*pred);
+            std::lock_guard<Node> curr_lock(*curr);
+            if (!validate(pred, curr))
+                continue;  // Raced with a writer; search again
+
+            if (curr == tail || !(curr->val == val))
+                return false;  // Not found
+
+            // Logical removal first, so wait-free readers stop reporting it
+            curr->marked.store(true, std::memory_order_release);
+            pred->next.store(curr->next.load(std::memory_order_relaxed), std::memory_order_release);
+            current_size.fetch_sub(1, std::memory_order_relaxed);
+            removed = curr;
+        }
+
+        // Locks are released; readers may still be on the node until the epoch moves on
+        EpochDomain::instance().retire<Node, &Pool::destroy>(removed);
+        return true;
+    }
+
+    // Returns the number of elements (thread-safe read).
+    size_t size() const override { return current_size.load(std::memory_order_relaxed); }
+
+    // Checks invariants.
+    // WARNING: NOT THREAD-SAFE if called concurrently
+    // with add/remove. Assumes list is quiescent (e.g., called after test threads join).
+    bool check_invariants() const override
+    {
+        if (!head || !tail || head->next.load() == nullptr)
+            return false;  // Basic structure check
+
+        size_t count = 0;
+        Node *pred = head;
+        Node *curr = head->next.load();
+        while (curr != tail)
+        {
+            if (!curr)
+                return false;  // Should not encounter null before tail
+            if (curr->marked.load())
+                return false;  // Marked nodes must be unlinked
+            if (curr->val < pred->val || (pred != head && curr->val == pred->val))
+                return false;  // Check strictly sorted order
+            pred = curr;
+            curr = curr->next.load();
+            ++count;
+        }
+        return count == current_size.load();
+    }
+};
+
+}  // namespace Set
+}  // namespace DataStructure
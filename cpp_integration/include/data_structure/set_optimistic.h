@@ -0,0 +1,231 @@
+#pragma once
+
+#include "epoch_reclamation.h"  // For EpochDomain
+#include "iset.h"               // Include the common interface
+#include "node_pool.h"          // For NodePool
+#include <atomic>               // For std::atomic
+#include <cstddef>              // For size_t
+#include <limits>
+#include <mutex>  // For std::mutex, std::lock_guard
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>  // For std::pair
+
+namespace DataStructure
+{
+namespace Set
+{
+
+// Node Structure for the Optimistic Implementation
+// Lock is std::mutex or the 1-byte DataStructure::SpinLock
+template <typename T, class Lock = std::mutex>
+struct OptimisticNode
+{
+    const T val;
+    std::atomic<OptimisticNode *> next;
+    Lock node_mutex;
+
+    OptimisticNode(T v, OptimisticNode *n = nullptr) : val(std::move(v)), next(n) { }
+
+    void lock() { node_mutex.lock(); }
+
+    void unlock() { node_mutex.unlock(); }
+};
+
+// Optimistic Synchronization Implementation
+//
+// Every operation searches without locks, then locks pred and curr and validates by
+// re-traversing from head that pred is still reachable and still points to curr; on
+// failure it retries. Compared to hand-over-hand locking, a traversal takes two locks
+// instead of two per node. Without removal marks an unlocked hit may be stale, so
+// contains() validates under the locks as well; SortedLinkedList_Lazy is the variant
+// with wait-free contains().
+//
+// Searches may stand on an unlinked node (its next pointer is left intact), so removed
+// nodes are retired through EpochDomain and recycled only once no search can reach them.
+template <typename T, class Lock = std::mutex>
+class SortedLinkedList_Optimistic : public ISet<T>
+{
+private:
+    using Node = OptimisticNode<T, Lock>;
+    using Pool = NodePool<Node>;
+
+    Node *head;
+    Node *tail;
+    std::atomic<size_t> current_size{0};  // Atomic counter for size
+
+    // Helper: Unlocked search. Returns {pred, curr} with pred->val < val <= curr->val
+    // (curr may be tail). Caller must hold an EpochDomain::Guard.
+    std::pair<Node *, Node *> find(const T &val) const
+    {
+        Node *pred = head;
+        Node *curr = pred->next.load(std::memory_order_acquire);
+        while (curr != tail && curr->val < val)
+        {
+            pred = curr;
+            curr = curr->next.load(std::memory_order_acquire);
+        }
+        return {pred, curr};
+    }
+
+    // Helper: pred is reachable from head and still points to curr. Caller holds both
+    // locks, so neither node can be unlinked or relinked meanwhile.
+    bool validate(Node *pred, Node *curr) const
+    {
+        Node *node = head;
+        while (node != tail && !(pred->val < node->val))
+        {
+            if (node == pred)
+                return pred->next.load(std::memory_order_acquire) == curr;
+            node = node->next.load(std::memory_order_acquire);
+        }
+        return false;
+    }
+
+    // Helper: Searches, locks and validates; calls body(pred, curr) with both locked
+    template <typename Body>
+    auto locked_find(const T &val, Body &&body) const
+    {
+        while (true)
+        {
+            auto [pred, curr] = find(val);
+            std::lock_guard<Node> pred_lock(*pred);
+            std::lock_guard<Node> curr_lock(*curr);
+            if (validate(pred, curr))
+                return body(pred, curr);
+        }
+    }
+
+public:
+    // Constructor
+    SortedLinkedList_Optimistic() : head(nullptr), tail(nullptr)
+    {
+        try
+        {
+            T min_val, max_val;
+            if constexpr (std::numeric_limits<T>::is_specialized)
+            {
+                min_val = std::numeric_limits<T>::lowest();
+                max_val = std::numeric_limits<T>::max();
+            }
+            else
+            {
+                throw std::logic_error(
+                    "Type T requires std::numeric_limits specialization for sentinels.");
+            }
+            tail = Pool::create(max_val, nullptr);
+            head = Pool::create(min_val, tail);
+        }
+        catch (...)
+        {
+            Pool::destroy(head);
+            Pool::destroy(tail);
+            throw std::runtime_error("SortedLinkedList_Optimistic construction failed.");
+        }
+    }
+
+    // Destructor: frees the linked nodes; already retired ones belong to the EpochDomain
+    ~SortedLinkedList_Optimistic() override
+    {
+        // No locking needed during destruction (assume single-threaded context)
+        Node *current = head;
+        while (current != nullptr)
+        {
+            Node *next_node = current->next.load(std::memory_order_relaxed);
+            Pool::destroy(current);
+            current = next_node;
+        }
+    }
+
+    // Disable copy and move semantics (nodes hold locks, readers hold raw pointers)
+    SortedLinkedList_Optimistic(const SortedLinkedList_Optimistic &) = delete;
+    SortedLinkedList_Optimistic &operator=(const SortedLinkedList_Optimistic &) = delete;
+    SortedLinkedList_Optimistic(SortedLinkedList_Optimistic &&) = delete;
+    SortedLinkedList_Optimistic &operator=(SortedLinkedList_Optimistic &&) = delete;
+
+    // --- ISet Interface Methods ---
+
+    bool contains(const T &val) const override
+    {
+        EpochDomain::Guard guard;
+        return locked_find(val,
+                           [&](Node *, Node *curr) { return curr != tail && curr->val == val; });
+    }
+
+    bool add(const T &val) override
+    {
+        EpochDomain::Guard guard;
+        return locked_find(val,
+                           [&](Node *pred, Node *curr)
+                           {
+                               if (curr != tail && curr->val == val)
+                                   return false;  // Already exists
+                               try
+                               {
+                                   Node *new_node = Pool::create(val, curr);
+                                   // Release: searches that see the node also see its fields
+                                   pred->next.store(new_node, std::memory_order_release);
+                               }
+                               catch (const std::bad_alloc &e)
+                               {
+                                   throw std::runtime_error("Failed node allocation in add: "
+                                                            + std::string(e.what()));
+                               }
+                               current_size.fetch_add(1, std::memory_order_relaxed);
+                               return true;
+                           });
+    }
+
+    bool remove(const T &val) override
+    {
+        EpochDomain::Guard guard;
+        Node *removed = locked_find(val,
+                                    [&](Node *pred, Node *curr) -> Node *
+                                    {
+                                        if (curr == tail || !(curr->val == val))
+                                            return nullptr;  // Not found
+                                        pred->next.store(
+                                            curr->next.load(std::memory_order_relaxed),
+                                            std::memory_order_release);
+                                        current_size.fetch_sub(1, std::memory_order_relaxed);
+                                        return curr;
+                                    });
+        if (removed == nullptr)
+            return false;
+
+        // Locks are released; searches may still be on the node until the epoch moves on
+        EpochDomain::instance().retire<Node, &Pool::destroy>(removed);
+        return true;
+    }
+
+    // Returns the number of elements (thread-safe read).
+    size_t size() const override { return current_size.load(std::memory_order_relaxed); }
+
+    // Checks invariants.
+    // WARNING: NOT THREAD-SAFE if called concurrently
+    // with add/remove. Assumes list is quiescent (e.g., called after test threads join).
+    bool check_invariants() const override
+    {
+        if (!head || !tail || head->next.load() == nullptr)
+            return false;  // Basic structure check
+
+        size_t count = 0;
+        Node *pred = head;
+        Node *curr = head->next.load();
+        while (curr != tail)
+        {
+            if (!curr)
+                return false;  // Should not encounter null before tail
+            if (curr->val < pred->val || (pred != head && curr->val == pred->val))
+                return false;  // Check strictly sorted order
+            pred = curr;
+            curr = curr->next.load();
+            ++count;
+        }
+        return count == current_size.load();
+    }
+};
+
+}  // namespace Set
+}  // namespace DataStructure
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "iset.h"
+#include "node_pool.h"  // For NodePool
 #include <cstddef>  // For size_t
 #include <limits>
 #include <new>        // For std::bad_alloc
@@ -21,11 +22,13 @@ struct SeqNode
     SeqNode(T v, SeqNode<T> *n = nullptr) : val(std::move(v)), next(n) { }
 };
 
-// Sequential Sorted Linked List Implementation
+// Sequential Sorted Linked List Implementation (nodes come from a NodePool)
 template <typename T>
 class SortedLinkedList_Sequential : public ISet<T>
 {
 private:
+    using Pool = NodePool<SeqNode<T>>;
+
     SeqNode<T> *head;
     SeqNode<T> *tail;
 
@@ -59,13 +62,13 @@ public:
                 throw std::logic_error(
                     "Type T requires std::numeric_limits specialization for sentinels.");
             }
-            tail = new SeqNode<T>(max_val, nullptr);
-            head = new SeqNode<T>(min_val, tail);
+            tail = Pool::create(max_val, nullptr);
+            head = Pool::create(min_val, tail);
         }
         catch (...)
         {
-            delete head;
-            delete tail;
+            Pool::destroy(head);
+            Pool::destroy(tail);
             throw std::runtime_error("SortedLinkedList_Sequential construction failed.");
         }
     }
@@ -77,7 +80,7 @@ public:
         while (current != nullptr)
         {
             SeqNode<T> *next_node = current->next;
-            delete current;
+            Pool::destroy(current);
             current = next_node;
         }
     }
@@ -111,7 +114,7 @@ public:
 
         try
         {
-            SeqNode<T> *new_node = new SeqNode<T>(val, curr);
+            SeqNode<T> *new_node = Pool::create(val, curr);
             pred->next = new_node;
         }
         catch (const std::bad_alloc &e)
@@ -129,7 +132,7 @@ public:
         if (curr != tail && curr->val == val)
         {
             pred->next = curr->next;
-            delete curr;  // Deallocate the removed node
+            Pool::destroy(curr);  // Recycle the removed node
             return true;
         }
         return false;  // Value not found
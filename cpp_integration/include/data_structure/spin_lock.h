@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <thread>  // For std::this_thread::yield
+
+namespace DataStructure
+{
+
+/**
+ * @brief One-byte test-and-test-and-set spinlock.
+ *
+ * Drop-in replacement for std::mutex (lock/unlock/try_lock, usable with std::lock_guard)
+ * where critical sections are a handful of pointer updates, e.g. the per-node locks of
+ * the hand-over-hand lists. A glibc std::mutex takes 40 bytes; this takes one, so a
+ * list node stays within a single cache line.
+ *
+ * Waiters spin on a plain load and only retry the exchange once the lock looks free,
+ * so the line is not bounced between cores while it is held. After SPIN_LIMIT polls a
+ * waiter yields its time slice, which keeps oversubscribed runs (more threads than
+ * cores) from burning the holder's CPU. There is no fairness: do not hold it across
+ * blocking calls.
+ */
+class SpinLock
+{
+public:
+    // Polls before a waiter starts yielding
+    static constexpr int SPIN_LIMIT = 64;
+
+    SpinLock() = default;
+
+    SpinLock(const SpinLock &) = delete;
+    SpinLock &operator=(const SpinLock &) = delete;
+
+    void lock()
+    {
+        while (locked.exchange(true, std::memory_order_acquire))
+        {
+            for (int spin = 0; locked.load(std::memory_order_relaxed); ++spin)
+            {
+                if (spin < SPIN_LIMIT)
+                    cpu_relax();
+                else
+                    std::this_thread::yield();
+            }
+        }
+    }
+
+    bool try_lock()
+    {
+        return !locked.load(std::memory_order_relaxed)
+               && !locked.exchange(true, std::memory_order_acquire);
+    }
+
+    void unlock() { locked.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> locked{false};
+
+    static void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+};
+
+static_assert(sizeof(SpinLock) == 1, "SpinLock is meant to fit into spare node padding");
+
+}  // namespace DataStructure
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../graph_types.h"   // CostVector, NUM_CRITERIA
+#include "../road_network.h"  // RoadNetwork class header
+#include <cstddef>
+#include <vector>
+
+/**
+ * Multi-objective A* (NAMOA* with dimensionality reduction) over the edge cost vectors
+ * of a RoadNetwork (distance, time, toll; see CostVector).
+ *
+ * A label is one partial path: its cost vector g, its node and its parent label. Labels
+ * are appended to a per-thread arena and never freed during a query; the path of a
+ * solution is read back through the parent indices. The open list is ordered
+ * lexicographically by f = g + h, where h is the ideal point of every node (the exact
+ * per-criterion distance to the goal, from one reverse Dijkstra per criterion).
+ *
+ * With a consistent h and lexicographic extraction, a label can only be dominated by
+ * labels extracted before it, and those are already lexicographically smaller. Dominance
+ * therefore reduces to the last two criteria: each node keeps just the 2-D Pareto
+ * staircase of the (time, toll) costs of its closed labels, and the goal keeps one of its
+ * solutions. A dominance check is a binary search in the staircase instead of a scan over
+ * full label vectors, and dominated labels are dropped both when generated and when
+ * extracted, so only the non-dominated frontier of each node is ever kept.
+ *
+ * Without cost vectors on the network every edge costs {weight, 0, 0} and the search
+ * returns the single shortest path.
+ */
+namespace AStarEnhancementVectorFunction {
+
+    // One Pareto-optimal path: its cost under every criterion and its nodes as OSM ids,
+    // start first
+    struct ParetoPath {
+        CostVector cost;
+        std::vector<long long> path;
+    };
+
+    // All Pareto-optimal start -> goal paths, one per non-dominated cost vector, in
+    // lexicographic cost order (so the first one is the shortest by distance). Empty if the
+    // goal is unreachable; throws std::runtime_error for unknown ids.
+    //
+    // max_labels > 0 caps the labels one query may create. The search then stops early:
+    // every returned path is still Pareto-optimal, but the front may be incomplete.
+    std::vector<ParetoPath> search(const RoadNetwork &network, long long start_node_id, long long goal_node_id,
+                                   size_t max_labels = 0);
+
+}
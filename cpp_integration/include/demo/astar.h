@@ -1,79 +1,106 @@
 #pragma once
 
 #include "../graph_types.h"   // Node/Edge types used by heuristic/Graph
+#include "../path_cache.h"    // Cache of repeated queries
 #include "../road_network.h"  // RoadNetwork class header
-#include <cmath>
-#include <limits>
+#include "astar_engine.h"     // Policy-based A* engine and its instantiations
+#include <memory>
 #include <vector>
 
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+// Entry points of the great-circle searches. Each one is the AStarEngine instantiation
+// with GreatCircleHeuristic and EdgeWeightCost (see astar_engine.h).
 
 namespace AStar {
 
-    inline double heuristic(const Node &a, const Node &b)
+    using Heuristic = AStarEngine::GreatCircleHeuristic;
+    using Cost = AStarEngine::EdgeWeightCost;
+
+    // Haversine (or network.geo_bound) lower bound from a to b, tightened by ALT tables
+    inline double heuristic(const RoadNetwork &network, NodeIndex a, NodeIndex b)
     {
-        // Haversine implementation
-        if (a.id == 0 || b.id == 0)
-        {
-            return std::numeric_limits<double>::max();
-        }
-        double lat1_rad = a.lat * M_PI / 180.0;
-        double lon1_rad = a.lon * M_PI / 180.0;
-        double lat2_rad = b.lat * M_PI / 180.0;
-        double lon2_rad = b.lon * M_PI / 180.0;
-
-        double dlon = lon2_rad - lon1_rad;
-        double dlat = lat2_rad - lat1_rad;
-
-        double haversine_a =
-            pow(sin(dlat / 2.0), 2) + cos(lat1_rad) * cos(lat2_rad) * pow(sin(dlon / 2.0), 2);
-        double c = 2.0 * asin(sqrt(haversine_a));
-
-        double r = 6371.0;  // Earth radius in kilometers
-        return c * r;
+        return Heuristic::estimate(network, a, b);
     }
 
-    std::vector<long long> search(const RoadNetwork &network,
-                                        long long start_node_id, long long goal_node_id);
+    // search() answered from / recorded in cache under the weights version of the query.
+    // A result is only recorded if no weight update was published while it was searched.
+    std::vector<long long> search_cached(const RoadNetwork &network, PathCache &cache,
+                                         long long start_node_id, long long goal_node_id);
+
+    // Sequential A*; through the network's path cache when one is attached. The query
+    // holds its own reference, so the cache may be replaced or detached meanwhile.
+    inline std::vector<long long> search(const RoadNetwork &network,
+                                         long long start_node_id, long long goal_node_id)
+    {
+        if (const std::shared_ptr<PathCache> cache = network.path_cache())
+            return search_cached(network, *cache, start_node_id, goal_node_id);
+        return AStarEngine::search<Heuristic, Cost, AStarEngine::DefaultOpenSet>(network, start_node_id, goal_node_id);
+    }
+
+    // Bidirectional A*: forward and backward searches on two threads, meeting in the middle.
+    inline std::vector<long long> search_bidirectional(const RoadNetwork &network,
+                                                       long long start_node_id, long long goal_node_id)
+    {
+        return AStarEngine::search_bidirectional<Heuristic, Cost>(network, start_node_id, goal_node_id);
+    }
+
+    // Weighted / focal A* within epsilon of the optimum, stopping at the limits of options;
+    // returns the path or the best partial result with its status.
+    inline AStarEngine::SearchResult search_bounded(const RoadNetwork &network, long long start_node_id,
+                                                    long long goal_node_id, const AStarEngine::SearchOptions &options)
+    {
+        return AStarEngine::search_bounded<Heuristic, Cost>(network, start_node_id, goal_node_id, options);
+    }
 } 
 
 namespace AStarParallel {
 
-    inline double heuristic(const Node &a, const Node &b)
+    using Heuristic = AStarEngine::GreatCircleHeuristic;
+    using Cost = AStarEngine::EdgeWeightCost;
+
+    inline std::vector<long long> search_TPool_CppLib(const RoadNetwork& network,
+                                        long long start_node_id, long long goal_node_id, int NUM_THREADS)
     {
-        // Haversine implementation
-        if (a.id == 0 || b.id == 0)
-        {
-            return std::numeric_limits<double>::max();
-        }
-        double lat1_rad = a.lat * M_PI / 180.0;
-        double lon1_rad = a.lon * M_PI / 180.0;
-        double lat2_rad = b.lat * M_PI / 180.0;
-        double lon2_rad = b.lon * M_PI / 180.0;
-
-        double dlon = lon2_rad - lon1_rad;
-        double dlat = lat2_rad - lat1_rad;
-
-        double haversine_a =
-            pow(sin(dlat / 2.0), 2) + cos(lat1_rad) * cos(lat2_rad) * pow(sin(dlon / 2.0), 2);
-        double c = 2.0 * asin(sqrt(haversine_a));
-
-        double r = 6371.0;  // Earth radius in kilometers
-        return c * r;
+        return AStarEngine::search_TPool_CppLib<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
     }
 
-    std::vector<long long> search_TPool_CppLib(const RoadNetwork& network,
-                                        long long start_node_id, long long goal_node_id, int NUM_THREADS);
+    inline std::vector<long long> search_TVector_CppLib(const RoadNetwork &network,
+                                        long long start_node_id, long long goal_node_id, int NUM_THREADS)
+    {
+        return AStarEngine::search_TVector_CppLib<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
+    }
 
-    std::vector<long long> search_TVector_CppLib(const RoadNetwork &network, 
-                                        long long start_node_id, long long goal_node_id, int NUM_THREADS);
+    inline std::vector<long long> search_TPool_PqFine(const RoadNetwork& network,
+                                            long long start_node_id, long long goal_node_id, int NUM_THREADS)
+    {
+        return AStarEngine::search_TPool_PqFine<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
+    }
+
+    inline std::vector<long long> search_TVector_PqFine(const RoadNetwork &network,
+                                        long long start_node_id, long long goal_node_id, int NUM_THREADS)
+    {
+        return AStarEngine::search_TVector_PqFine<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
+    }
+
+    // Same searches with the relaxed MultiQueue open set (pq_multiqueue.h); optimality
+    // is restored by re-expansion and an incumbent bound on the goal cost.
+    inline std::vector<long long> search_TPool_MultiQueue(const RoadNetwork& network,
+                                                long long start_node_id, long long goal_node_id, int NUM_THREADS)
+    {
+        return AStarEngine::search_TPool_MultiQueue<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
+    }
 
-    std::vector<long long> search_TPool_PqFine(const RoadNetwork& network,
-                                            long long start_node_id, long long goal_node_id, int NUM_THREADS);
+    inline std::vector<long long> search_TVector_MultiQueue(const RoadNetwork &network,
+                                                  long long start_node_id, long long goal_node_id, int NUM_THREADS)
+    {
+        return AStarEngine::search_TVector_MultiQueue<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
+    }
 
-    std::vector<long long> search_TVector_PqFine(const RoadNetwork &network, 
-                                        long long start_node_id, long long goal_node_id, int NUM_THREADS);
+    // Hash-Distributed A*: nodes are partitioned over NUM_THREADS workers by hash, each
+    // with its own open list, exchanging successors through lock-free mailboxes.
+    inline std::vector<long long> search_HDA(const RoadNetwork &network,
+                                      long long start_node_id, long long goal_node_id, int NUM_THREADS)
+    {
+        return AStarEngine::search_HDA<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS);
+    }
 
 }
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "astar_policies.h"   // Heuristic, Cost and OpenSet policies
+#include "../road_network.h"  // RoadNetwork class header
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * One A* engine for every search variant.
+ *
+ * Each function is a template over the policies of astar_policies.h; the former
+ * per-namespace copies (AStar, AStarParallel, AStarEnhancement, ...) are now explicit
+ * instantiations of it. All of them take OSM ids, throw std::runtime_error for unknown
+ * ids and return the path as OSM ids, start first (empty if the goal is unreachable).
+ *
+ * Every function takes a Stats policy object last (search_stats.h): pass a StatsRecorder
+ * to collect per-query counters and timings. The overloads without it use NoStats, which
+ * compiles to the uninstrumented search.
+ *
+ * Definitions live in astar_engine_impl.h. The instantiations listed at the end of this
+ * header are compiled once into demo_lib / demo_lib_dynamic_cost_function; other policy
+ * combinations can be instantiated by including astar_engine_impl.h.
+ */
+namespace AStarEngine {
+
+    // ---- Bounded-suboptimal search (search_bounded) ----
+
+    // How search_bounded() trades path cost for fewer expansions; both return a path of
+    // cost at most epsilon times the optimum (with an admissible, consistent heuristic)
+    enum class BoundedMode {
+        WEIGHTED,  // Weighted A*: expands by g + epsilon * h
+        FOCAL      // Focal search: among the open nodes with f <= epsilon * min f, expands the
+                   // one the Focal policy ranks first
+    };
+
+    // Why search_bounded() returned
+    enum class SearchStatus {
+        FOUND,            // path reaches the goal
+        UNREACHABLE,      // Every node reachable from the start was expanded
+        EXPANSION_LIMIT,  // max_expansions nodes were expanded
+        DEADLINE,         // time_limit_s elapsed
+        COST_CAP          // No path within cost_cap (and nothing else left to expand)
+    };
+
+    // Suboptimality bound and limits of one search_bounded() call
+    struct SearchOptions {
+        BoundedMode mode = BoundedMode::WEIGHTED;
+        double epsilon = 1.0;              // Suboptimality factor, >= 1 (1 = optimal A*)
+        std::uint64_t max_expansions = 0;  // 0 = unlimited
+        double time_limit_s = 0.0;         // Wall-clock budget from the call, 0 = unlimited
+
+        // Paths costing more are pruned (by g + h, so the heuristic must be admissible)
+        double cost_cap = std::numeric_limits<double>::infinity();
+    };
+
+    // Outcome of search_bounded(). FOUND: path from start to goal. EXPANSION_LIMIT /
+    // DEADLINE: the best partial result, the path to the expanded node with the smallest
+    // heuristic estimate (closest to the goal). UNREACHABLE / COST_CAP: no path.
+    struct SearchResult {
+        SearchStatus status = SearchStatus::UNREACHABLE;
+        std::vector<long long> path;  // OSM ids, start first
+        double cost = std::numeric_limits<double>::infinity();  // Cost of path under the Cost policy
+        std::uint64_t expanded = 0;   // Nodes expanded before returning
+    };
+
+    // Sequential A* (decrease_key or lazy open set, depending on OpenSet)
+    template <class Heuristic, class Cost, class OpenSet, class Stats>
+    std::vector<long long> search(const RoadNetwork &network, long long start_node_id, long long goal_node_id,
+                                  Stats &stats);
+
+    // Sequential bounded-suboptimal A* (weighted or focal, see BoundedMode) that stops at the
+    // limits of options. Throws std::invalid_argument for epsilon < 1.
+    template <class Heuristic, class Cost, class Focal, class Stats>
+    SearchResult search_bounded(const RoadNetwork &network, long long start_node_id, long long goal_node_id,
+                                const SearchOptions &options, Stats &stats);
+
+    // Bidirectional A*: forward and backward searches on two threads, meeting in the middle
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_bidirectional(const RoadNetwork &network, long long start_node_id,
+                                                long long goal_node_id, Stats &stats);
+
+    // Fork-join parallel A*: the edges of each expanded node are relaxed on the thread pool
+    // (TPool: one edge per task, TVector: one slice per thread), with a std::priority_queue
+    // (CppLib), fine-grained locked list (PqFine) or relaxed MultiQueue open set. Optimality
+    // with the MultiQueue is restored by re-expansion and an incumbent bound on the goal cost.
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TPool_CppLib(const RoadNetwork &network, long long start_node_id,
+                                               long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TVector_CppLib(const RoadNetwork &network, long long start_node_id,
+                                                 long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TPool_PqFine(const RoadNetwork &network, long long start_node_id,
+                                               long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TVector_PqFine(const RoadNetwork &network, long long start_node_id,
+                                                 long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TPool_MultiQueue(const RoadNetwork &network, long long start_node_id,
+                                                   long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TVector_MultiQueue(const RoadNetwork &network, long long start_node_id,
+                                                     long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    // Hash-Distributed A*: nodes are partitioned over NUM_THREADS workers by hash, each
+    // with its own open list, exchanging successors through lock-free mailboxes
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_HDA(const RoadNetwork &network, long long start_node_id,
+                                      long long goal_node_id, int NUM_THREADS, Stats &stats);
+
+    // ---- Uninstrumented overloads (NoStats) ----
+
+    template <class Heuristic, class Cost, class OpenSet>
+    std::vector<long long> search(const RoadNetwork &network, long long start_node_id, long long goal_node_id) {
+        NoStats stats;
+        return search<Heuristic, Cost, OpenSet>(network, start_node_id, goal_node_id, stats);
+    }
+
+    template <class Heuristic, class Cost, class Focal = DistanceToGoFocal>
+    SearchResult search_bounded(const RoadNetwork &network, long long start_node_id, long long goal_node_id,
+                                const SearchOptions &options) {
+        NoStats stats;
+        return search_bounded<Heuristic, Cost, Focal>(network, start_node_id, goal_node_id, options, stats);
+    }
+
+    template <class Heuristic, class Cost>
+    std::vector<long long> search_bidirectional(const RoadNetwork &network, long long start_node_id,
+                                                long long goal_node_id) {
+        NoStats stats;
+        return search_bidirectional<Heuristic, Cost>(network, start_node_id, goal_node_id, stats);
+    }
+
+// Defines the NoStats overload of a parallel engine function
+#define ASTAR_ENGINE_PARALLEL_OVERLOAD(NAME)                                                            \
+    template <class Heuristic, class Cost>                                                              \
+    std::vector<long long> NAME(const RoadNetwork &network, long long start_node_id,                    \
+                                long long goal_node_id, int NUM_THREADS) {                              \
+        NoStats stats;                                                                                  \
+        return NAME<Heuristic, Cost>(network, start_node_id, goal_node_id, NUM_THREADS, stats);         \
+    }
+
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_TPool_CppLib)
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_TVector_CppLib)
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_TPool_PqFine)
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_TVector_PqFine)
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_TPool_MultiQueue)
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_TVector_MultiQueue)
+    ASTAR_ENGINE_PARALLEL_OVERLOAD(search_HDA)
+
+#undef ASTAR_ENGINE_PARALLEL_OVERLOAD
+
+// Declares (PREFIX = extern template) or defines (PREFIX = template) the instantiations
+// of every engine function for one heuristic and Stats policy with plain edge-weight costs
+#define ASTAR_ENGINE_INSTANTIATIONS(PREFIX, HEURISTIC, STATS)                                           \
+    PREFIX std::vector<long long> search<HEURISTIC, EdgeWeightCost, DefaultOpenSet, STATS>(             \
+        const RoadNetwork &, long long, long long, STATS &);                                            \
+    PREFIX SearchResult search_bounded<HEURISTIC, EdgeWeightCost, DistanceToGoFocal, STATS>(            \
+        const RoadNetwork &, long long, long long, const SearchOptions &, STATS &);                     \
+    PREFIX std::vector<long long> search_bidirectional<HEURISTIC, EdgeWeightCost, STATS>(               \
+        const RoadNetwork &, long long, long long, STATS &);                                            \
+    PREFIX std::vector<long long> search_TPool_CppLib<HEURISTIC, EdgeWeightCost, STATS>(                \
+        const RoadNetwork &, long long, long long, int, STATS &);                                       \
+    PREFIX std::vector<long long> search_TVector_CppLib<HEURISTIC, EdgeWeightCost, STATS>(              \
+        const RoadNetwork &, long long, long long, int, STATS &);                                       \
+    PREFIX std::vector<long long> search_TPool_PqFine<HEURISTIC, EdgeWeightCost, STATS>(                \
+        const RoadNetwork &, long long, long long, int, STATS &);                                       \
+    PREFIX std::vector<long long> search_TVector_PqFine<HEURISTIC, EdgeWeightCost, STATS>(              \
+        const RoadNetwork &, long long, long long, int, STATS &);                                       \
+    PREFIX std::vector<long long> search_TPool_MultiQueue<HEURISTIC, EdgeWeightCost, STATS>(            \
+        const RoadNetwork &, long long, long long, int, STATS &);                                       \
+    PREFIX std::vector<long long> search_TVector_MultiQueue<HEURISTIC, EdgeWeightCost, STATS>(          \
+        const RoadNetwork &, long long, long long, int, STATS &);                                       \
+    PREFIX std::vector<long long> search_HDA<HEURISTIC, EdgeWeightCost, STATS>(                         \
+        const RoadNetwork &, long long, long long, int, STATS &);
+
+    // Great-circle heuristic (AStar, AStarParallel), compiled in astar.cpp
+    ASTAR_ENGINE_INSTANTIATIONS(extern template, GreatCircleHeuristic, NoStats)
+    ASTAR_ENGINE_INSTANTIATIONS(extern template, GreatCircleHeuristic, StatsRecorder)
+
+    // Penalty-region heuristic (AStarEnhancement*), compiled in aStarWithDynamicCostFunction.cpp
+    ASTAR_ENGINE_INSTANTIATIONS(extern template, DynamicCostHeuristic, NoStats)
+    ASTAR_ENGINE_INSTANTIATIONS(extern template, DynamicCostHeuristic, StatsRecorder)
+
+}
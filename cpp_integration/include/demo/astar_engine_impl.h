@@ -0,0 +1,1389 @@
+#pragma once
+
+// Template definitions of the A* engine declared in astar_engine.h. Only the translation
+// units that instantiate the engine (astar.cpp, aStarWithDynamicCostFunction.cpp) include
+// this header; everything else uses the exported instantiations.
+
+#include "astar_engine.h"
+#include "search_context.h"
+#include "search_stats.h"
+#include "../data_structure/hashmap_concurrent.h"
+#include "../data_structure/pq_fine.h"
+#include "../data_structure/pq_multiqueue.h"
+#include "../numa.h"
+#include "../thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace AStarEngine {
+
+    // ==========================================================================
+    // Sequential A*
+    // ==========================================================================
+
+    template <class Heuristic, class Cost, class OpenSet, class Stats>
+    std::vector<long long> search(const RoadNetwork &network,  // Accepts RoadNetwork
+                                  long long start_node_id, long long goal_node_id, Stats &stats)
+    {
+        const std::uint64_t setup_start = stats.start_timer();
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        // Per-thread open set (one per instantiation), reused across queries
+        thread_local OpenSet open_set;
+        open_set.reset(network.num_nodes());
+
+        // Dense per-thread g/parent/closed state, reset in O(1) via its epoch counter
+        SearchContext &context = SearchContext::for_thread(network);
+        context.set(start, 0.0, INVALID_NODE_INDEX);
+
+        // Successors improved by the current expansion, scored by one heuristic_batch() call
+        thread_local std::vector<NodeIndex> improved;
+        thread_local std::vector<double> improved_h;
+
+        // Add start node to the open set
+        open_set.push_or_decrease(start, estimate<Heuristic, Cost>(network, start, goal));
+        stats.on_push();
+        stats.add_time(Phase::SETUP, setup_start);
+        const std::uint64_t search_start = stats.start_timer();
+
+        while (!open_set.empty())
+        {
+            NodeIndex current_id = open_set.pop();
+            stats.on_pop();
+
+            // Skip stale duplicates of nodes that were already expanded (an indexed open
+            // set stores each node once, so every pop is a live entry)
+            if constexpr (OpenSet::MAY_HOLD_STALE)
+            {
+                if (context.is_closed(current_id))
+                {
+                    stats.on_stale_pop();
+                    continue;
+                }
+            }
+
+            // Goal reached (same as before)
+            if (current_id == goal)
+            {
+                stats.add_time(Phase::SEARCH, search_start);
+                const std::uint64_t path_start = stats.start_timer();
+                std::vector<long long> path = context.path_to(network, current_id);
+                stats.add_time(Phase::PATH, path_start);
+                return path;
+            }
+
+            // Get current node g_score (always set if reached via open_set) and close it
+            double current_g_score = context.g(current_id);
+            context.close(current_id);
+            stats.on_expand();
+
+            // Explore neighbors (contiguous CSR block, no hashing)
+            improved.clear();
+            for (EdgeIndex e = network.edge_begin(current_id); e < network.edge_end(current_id); ++e)
+            {
+                NodeIndex neighbor_id = network.edge_target(e);
+                double tentative_g_score = current_g_score + Cost::edge(weights, e);
+
+                // Get neighbor g_score, infinity if not seen before
+                double neighbor_g_score = context.g(neighbor_id);
+
+                if (tentative_g_score < neighbor_g_score)
+                {
+                    // Found a better path (re-open in case an inconsistent heuristic closed it early)
+                    if (context.is_closed(neighbor_id)) stats.on_reopen();
+                    context.set(neighbor_id, tentative_g_score, current_id);
+                    context.reopen(neighbor_id);
+                    improved.push_back(neighbor_id);
+                }
+            }
+
+            // Every CSR target has coordinates (dangling edges are dropped at build time).
+            // h is fixed per node, so a lower g always means a lower f: decrease_key applies.
+            // A parallel edge may list a node twice; the repeated push changes nothing.
+            improved_h.resize(improved.size());
+            Heuristic::estimate_batch(network, improved.data(), improved.size(), goal, improved_h.data());
+            for (size_t i = 0; i < improved.size(); ++i)
+            {
+                if (open_set.push_or_decrease(improved[i], context.g(improved[i]) + Cost::HEURISTIC_SCALE * improved_h[i]))
+                    stats.on_push();
+                else
+                    stats.on_decrease_key();
+            }
+        }
+
+        // Open set empty, goal not reached
+        stats.add_time(Phase::SEARCH, search_start);
+        return {};
+    }
+
+    // ==========================================================================
+    // Bounded-suboptimal A* (weighted / focal) with search limits
+    // ==========================================================================
+    //
+    // Weighted A* orders the open set by g + epsilon * h. Focal search orders it by the plain
+    // f = g + h and keeps a second heap, the focal list, of the open nodes with
+    // f <= epsilon * min f, ranked by the Focal policy; it always expands the focal front.
+    // Either way the goal is expanded with g <= epsilon * C*: for weighted A* because the
+    // inflated heuristic overestimates by at most epsilon, for focal search because the goal
+    // entered the focal list with f = g <= epsilon * min f <= epsilon * C*.
+    //
+    // Both bounds need min f <= C*, i.e. an open node on an optimal path with its optimal g.
+    // Weighted A* reopens expanded nodes reached by cheaper paths, as search() does. Focal
+    // search would reopen them constantly (its focal order ignores g, so it expands nodes
+    // through poor paths first), so it defers them instead: a closed node whose g drops
+    // keeps its new f in the lower bound but is expanded again only when it holds min f
+    // and the focal list is empty. The first node of an optimal path that is not closed
+    // with its optimal g is then either open or deferred with that g, so min f still
+    // bounds C*. Parents are updated either way, and the cost returned is summed along
+    // the returned path, which may be cheaper than the g of the goal.
+    //
+    // The limits are checked between expansions (the clock every DEADLINE_CHECK_INTERVAL of
+    // them). The cost cap prunes a successor whose g + h exceeds it, so a goal that is only
+    // reachable above the cap costs a search bounded by the cap instead of a full scan.
+
+    // Expansions between two reads of the steady clock
+    constexpr std::uint64_t DEADLINE_CHECK_INTERVAL = 64;
+
+    // Open set of focal search: every open or deferred node ordered by (f, index), plus the
+    // focal heap of the open ones with f <= bound_, ordered by their Focal priority. bound_
+    // follows epsilon * min f at every pop; membership is marked with an epoch stamp, so
+    // reset() is O(leftover entries).
+    class FocalOpenSet {
+    public:
+        void reset(size_t num_nodes, double epsilon) {
+            by_f_.clear();
+            focal_.clear();
+            focal_.reserve_ids(num_nodes);
+            if (f_.size() < num_nodes) {
+                f_.resize(num_nodes);
+                priority_.resize(num_nodes);
+                deferred_.resize(num_nodes);
+                stamp_.resize(num_nodes, 0);
+            }
+            if (++epoch_ == 0) {  // Wrapped: old stamps could collide
+                std::fill(stamp_.begin(), stamp_.end(), 0);
+                epoch_ = 1;
+            }
+            epsilon_ = epsilon;
+            bound_ = -std::numeric_limits<double>::infinity();
+        }
+
+        bool empty() const { return by_f_.empty(); }
+
+        size_t size() const { return by_f_.size(); }
+
+        // Adds u with f-score f, or moves it to the new f; true if u was not open. A deferred
+        // u (an expanded node, see above) only counts for min f until pop() picks it.
+        bool push_or_decrease(NodeIndex u, double f, double priority, bool deferred) {
+            const bool added = stamp_[u] != epoch_;
+            if (!added) by_f_.erase({f_[u], u});
+            stamp_[u] = epoch_;
+            f_[u] = f;
+            priority_[u] = priority;
+            deferred_[u] = deferred;
+            by_f_.insert({f, u});
+            if (!deferred && f <= bound_) {
+                if (focal_.contains(u)) focal_.update_key(u, priority);
+                else focal_.push(u, priority);
+            }
+            return added;
+        }
+
+        // Removes and returns the focal node ranked first after raising the bound to
+        // epsilon * min f; the node of min f if the focal list is empty (it is deferred then)
+        NodeIndex pop() {
+            const double bound = epsilon_ * by_f_.begin()->first;
+            if (bound < bound_) {
+                // min f dropped (inconsistent heuristic): rebuild the focal list from scratch
+                focal_.clear();
+                bound_ = -std::numeric_limits<double>::infinity();
+            }
+            for (auto it = by_f_.upper_bound({bound_, INVALID_NODE_INDEX}); it != by_f_.end() && it->first <= bound; ++it)
+                if (!deferred_[it->second]) focal_.push(it->second, priority_[it->second]);
+            bound_ = bound;
+
+            const NodeIndex u = focal_.empty() ? by_f_.begin()->second : focal_.pop().first;
+            by_f_.erase({f_[u], u});
+            stamp_[u] = 0;
+            return u;
+        }
+
+    private:
+        std::set<std::pair<double, NodeIndex>> by_f_;
+        DataStructure::PriorityQueue::IndexedDaryHeap<OPEN_SET_ARITY, double, std::greater<double>> focal_;
+        std::vector<double> f_;         // Key of u in by_f_ while u is open
+        std::vector<double> priority_;  // Focal priority of u while u is open
+        std::vector<char> deferred_;    // u is an expanded node waiting in by_f_ only
+        std::vector<std::uint32_t> stamp_;
+        std::uint32_t epoch_ = 0;
+        double epsilon_ = 1.0;
+        double bound_ = 0.0;
+    };
+
+    template <class Heuristic, class Cost, class Focal, class Stats>
+    SearchResult search_bounded(const RoadNetwork &network, long long start_node_id, long long goal_node_id,
+                                const SearchOptions &options, Stats &stats)
+    {
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point call_time = Clock::now();
+        const bool has_deadline = options.time_limit_s > 0.0;
+        auto past_deadline = [&] {
+            return std::chrono::duration<double>(Clock::now() - call_time).count() >= options.time_limit_s;
+        };
+        const std::uint64_t setup_start = stats.start_timer();
+
+        if (!(options.epsilon >= 1.0)) throw std::invalid_argument("SearchOptions: epsilon must be at least 1.");
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        // Per-thread open sets, reused across queries; only the one of the mode is used
+        const bool focal = options.mode == BoundedMode::FOCAL;
+        thread_local DefaultOpenSet weighted_open;
+        thread_local FocalOpenSet focal_open;
+        if (focal) focal_open.reset(network.num_nodes(), options.epsilon);
+        else weighted_open.reset(network.num_nodes());
+
+        SearchContext &context = SearchContext::for_thread(network);
+
+        // Scaled heuristic of every node pushed in this query (read only for those)
+        thread_local std::vector<double> node_h;
+        if (node_h.size() < network.num_nodes()) node_h.resize(network.num_nodes());
+        thread_local std::vector<NodeIndex> improved;
+        thread_local std::vector<double> improved_h;
+        thread_local std::vector<char> improved_closed;  // Deferred rather than reopened (focal)
+
+        // Weighted A* folds epsilon into the key; focal search applies it when it picks
+        auto push = [&](NodeIndex u, double g, double h, bool deferred) {
+            node_h[u] = h;
+            const bool added = focal ? focal_open.push_or_decrease(u, g + h, Focal::priority(network, u, goal, g, h),
+                                                                   deferred)
+                                     : weighted_open.push_or_decrease(u, g + options.epsilon * h);
+            if (added) stats.on_push();
+            else stats.on_decrease_key();
+        };
+
+        SearchResult result;
+        auto finish = [&](SearchStatus status, NodeIndex end) {
+            result.status = status;
+            if (end != INVALID_NODE_INDEX) {
+                const std::uint64_t path_start = stats.start_timer();
+                result.path = context.path_to(network, end);
+                // Cheapest parallel edge of each step, which the parent was set through
+                result.cost = 0.0;
+                for (NodeIndex u = end, p = context.parent(u); p != INVALID_NODE_INDEX; u = p, p = context.parent(u))
+                {
+                    double step = std::numeric_limits<double>::infinity();
+                    for (EdgeIndex e = network.edge_begin(p); e < network.edge_end(p); ++e)
+                        if (network.edge_target(e) == u) step = std::min(step, Cost::edge(weights, e));
+                    result.cost += step;
+                }
+                stats.add_time(Phase::PATH, path_start);
+            }
+            return std::move(result);
+        };
+
+        const double start_h = estimate<Heuristic, Cost>(network, start, goal);
+        stats.add_time(Phase::SETUP, setup_start);
+        if (start_h > options.cost_cap) return finish(SearchStatus::COST_CAP, INVALID_NODE_INDEX);
+
+        context.set(start, 0.0, INVALID_NODE_INDEX);
+        push(start, 0.0, start_h, false);
+        const std::uint64_t search_start = stats.start_timer();
+
+        // Best partial result: the expanded node that looks closest to the goal
+        NodeIndex closest = start;
+        double closest_h = start_h;
+        bool pruned = false;
+
+        while (focal ? !focal_open.empty() : !weighted_open.empty())
+        {
+            if (options.max_expansions > 0 && result.expanded >= options.max_expansions)
+            {
+                stats.add_time(Phase::SEARCH, search_start);
+                return finish(SearchStatus::EXPANSION_LIMIT, closest);
+            }
+            if (has_deadline && result.expanded % DEADLINE_CHECK_INTERVAL == 0 && past_deadline())
+            {
+                stats.add_time(Phase::SEARCH, search_start);
+                return finish(SearchStatus::DEADLINE, closest);
+            }
+
+            const NodeIndex current_id = focal ? focal_open.pop() : weighted_open.pop();
+            stats.on_pop();
+
+            if (current_id == goal)
+            {
+                stats.add_time(Phase::SEARCH, search_start);
+                return finish(SearchStatus::FOUND, goal);
+            }
+
+            const double current_g_score = context.g(current_id);
+            context.close(current_id);
+            stats.on_expand();
+            ++result.expanded;
+            if (node_h[current_id] < closest_h)
+            {
+                closest_h = node_h[current_id];
+                closest = current_id;
+            }
+
+            improved.clear();
+            improved_closed.clear();
+            for (EdgeIndex e = network.edge_begin(current_id); e < network.edge_end(current_id); ++e)
+            {
+                const NodeIndex neighbor_id = network.edge_target(e);
+                const double tentative_g_score = current_g_score + Cost::edge(weights, e);
+                if (tentative_g_score < context.g(neighbor_id))
+                {
+                    const bool closed = context.is_closed(neighbor_id);
+                    context.set(neighbor_id, tentative_g_score, current_id);
+                    if (closed && !focal)
+                    {
+                        stats.on_reopen();
+                        context.reopen(neighbor_id);
+                    }
+                    improved.push_back(neighbor_id);
+                    improved_closed.push_back(closed && focal);
+                }
+            }
+
+            // A pruned successor keeps its g, so only a cheaper path can bring it back
+            improved_h.resize(improved.size());
+            Heuristic::estimate_batch(network, improved.data(), improved.size(), goal, improved_h.data());
+            for (size_t i = 0; i < improved.size(); ++i)
+            {
+                const double g = context.g(improved[i]);
+                const double h = Cost::HEURISTIC_SCALE * improved_h[i];
+                if (g + h > options.cost_cap)
+                {
+                    pruned = true;
+                    continue;
+                }
+                push(improved[i], g, h, improved_closed[i]);
+            }
+        }
+
+        // Open set empty: nothing within the cap (if something was pruned) or no path at all
+        stats.add_time(Phase::SEARCH, search_start);
+        return finish(pruned ? SearchStatus::COST_CAP : SearchStatus::UNREACHABLE, INVALID_NODE_INDEX);
+    }
+
+    // ==========================================================================
+    // Bidirectional A*
+    // ==========================================================================
+    //
+    // A forward search from the start (heuristic towards the goal) and a backward search
+    // from the goal over the reverse edges (heuristic towards the start) run on two
+    // threads. Whenever one side improves g(v), it checks the other side's published
+    // g(v); a finite sum is a real start-goal path and may lower the best cost `mu`.
+    //
+    // Stopping criterion (symmetric approach): each side is a plain A* with an admissible
+    // heuristic, so once the smallest f in either open list is >= mu no shorter path can
+    // exist, and both sides stop. This does not need the heuristic to be consistent.
+
+    // Per-thread state reused across bidirectional queries
+    class BidirectionalState {
+    public:
+        SearchContext forward;
+        SearchContext backward;
+        DefaultOpenSet forward_open;
+        DefaultOpenSet backward_open;
+
+        // Returns the calling thread's state, sized for the network and reset
+        static BidirectionalState& for_thread(const RoadNetwork& network) {
+            thread_local BidirectionalState state;
+            state.reset(network.num_nodes());
+            return state;
+        }
+
+        // g-scores each side publishes for the other one to read concurrently
+        std::atomic<double>* published(bool is_forward) { return is_forward ? forward_g_.get() : backward_g_.get(); }
+
+        // Records that the published slot of u was written, so finish() can clear it
+        void touch(bool is_forward, NodeIndex u) { (is_forward ? forward_touched_ : backward_touched_).push_back(u); }
+
+        // Clears only the published slots this query wrote
+        void finish() {
+            for (NodeIndex u : forward_touched_) forward_g_[u].store(SearchContext::INF, std::memory_order_relaxed);
+            for (NodeIndex u : backward_touched_) backward_g_[u].store(SearchContext::INF, std::memory_order_relaxed);
+            forward_touched_.clear();
+            backward_touched_.clear();
+        }
+
+    private:
+        void reset(size_t num_nodes) {
+            forward.reset(num_nodes);
+            backward.reset(num_nodes);
+            forward_open.reset(num_nodes);
+            backward_open.reset(num_nodes);
+            if (capacity_ < num_nodes) {
+                forward_g_ = std::make_unique<std::atomic<double>[]>(num_nodes);
+                backward_g_ = std::make_unique<std::atomic<double>[]>(num_nodes);
+                for (size_t u = 0; u < num_nodes; ++u) {
+                    forward_g_[u].store(SearchContext::INF, std::memory_order_relaxed);
+                    backward_g_[u].store(SearchContext::INF, std::memory_order_relaxed);
+                }
+                capacity_ = num_nodes;
+            }
+            forward_touched_.clear();
+            backward_touched_.clear();
+        }
+
+        std::unique_ptr<std::atomic<double>[]> forward_g_;
+        std::unique_ptr<std::atomic<double>[]> backward_g_;
+        std::vector<NodeIndex> forward_touched_;
+        std::vector<NodeIndex> backward_touched_;
+        size_t capacity_ = 0;
+    };
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_bidirectional(const RoadNetwork &network,
+                                                long long start_node_id, long long goal_node_id, Stats &stats)
+    {
+        const std::uint64_t setup_start = stats.start_timer();
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        BidirectionalState &state = BidirectionalState::for_thread(network);
+
+        // Best meeting point; mu is also kept atomically for the lock-free stop checks
+        std::mutex meet_mutex;
+        double best_cost = SearchContext::INF;
+        NodeIndex meeting_node = INVALID_NODE_INDEX;
+        std::atomic<double> mu{ SearchContext::INF };
+        std::atomic<bool> done{ false };
+
+        auto offer_meeting = [&](NodeIndex node, double cost) {
+            auto lock = stats.lock(meet_mutex, LockSite::MEETING_POINT);
+            if (cost < best_cost) {
+                best_cost = cost;
+                meeting_node = node;
+                mu.store(cost, std::memory_order_relaxed);
+            }
+        };
+
+        // Seed both sides before the fork, so a side running alone still meets the other's root
+        state.forward.set(start, 0.0, INVALID_NODE_INDEX);
+        state.backward.set(goal, 0.0, INVALID_NODE_INDEX);
+        state.published(true)[start].store(0.0);
+        state.touch(true, start);
+        state.published(false)[goal].store(0.0);
+        state.touch(false, goal);
+        if (start == goal) offer_meeting(start, 0.0);
+
+        auto run_side = [&](bool is_forward) {
+            SearchContext &context = is_forward ? state.forward : state.backward;
+            std::atomic<double> *own_g = state.published(is_forward);
+            std::atomic<double> *other_g = state.published(!is_forward);
+            const NodeIndex root = is_forward ? start : goal;
+            const NodeIndex target = is_forward ? goal : start;
+
+            // Lower bound on the remaining cost of v: d(v, goal) forwards, d(start, v) backwards.
+            // The order matters once directed ALT bounds replace the symmetric haversine.
+            auto estimate = [&](NodeIndex v) {
+                return is_forward ? AStarEngine::estimate<Heuristic, Cost>(network, v, target)
+                                  : AStarEngine::estimate<Heuristic, Cost>(network, target, v);
+            };
+
+            DefaultOpenSet &open_set = is_forward ? state.forward_open : state.backward_open;
+            open_set.push_or_decrease(root, estimate(root));
+            stats.on_push();
+
+            auto relax = [&](NodeIndex neighbor_id, NodeIndex current_id, double tentative_g_score) {
+                if (tentative_g_score >= context.g(neighbor_id)) return;
+                if (context.g(neighbor_id) == SearchContext::INF) state.touch(is_forward, neighbor_id);
+                if (context.is_closed(neighbor_id)) stats.on_reopen();
+                context.set(neighbor_id, tentative_g_score, current_id);
+                context.reopen(neighbor_id);
+
+                // seq_cst store then load: of two sides reaching v at once, at least one sees the other
+                own_g[neighbor_id].store(tentative_g_score, std::memory_order_seq_cst);
+                double other = other_g[neighbor_id].load(std::memory_order_seq_cst);
+                if (other != SearchContext::INF) offer_meeting(neighbor_id, tentative_g_score + other);
+
+                if (open_set.push_or_decrease(neighbor_id, tentative_g_score + estimate(neighbor_id)))
+                    stats.on_push();
+                else
+                    stats.on_decrease_key();
+            };
+
+            while (!open_set.empty() && !done.load(std::memory_order_relaxed)) {
+                // Nothing left in this direction can beat the best meeting point
+                if (open_set.top_f() >= mu.load(std::memory_order_relaxed)) break;
+
+                NodeIndex current_id = open_set.pop();
+                stats.on_pop();
+                double current_g_score = context.g(current_id);
+                context.close(current_id);
+                stats.on_expand();
+
+                if (is_forward) {
+                    for (EdgeIndex e = network.edge_begin(current_id); e < network.edge_end(current_id); ++e)
+                        relax(network.edge_target(e), current_id, current_g_score + Cost::edge(weights, e));
+                } else {
+                    for (EdgeIndex e = network.rev_edge_begin(current_id); e < network.rev_edge_end(current_id); ++e)
+                        relax(network.rev_edge_source(e), current_id, current_g_score + Cost::reverse_edge(weights, e));
+                }
+            }
+
+            // Either criterion ends the whole search: mu is optimal, or this side is exhausted
+            done.store(true, std::memory_order_relaxed);
+        };
+
+        stats.add_time(Phase::SETUP, setup_start);
+
+        // Two sides at once; if the pool cannot run both concurrently they simply run in turn
+        const std::uint64_t search_start = stats.start_timer();
+        ThreadPool::instance().parallel_for(2, [&](size_t side) { run_side(side == 0); }, 2);
+        stats.add_time(Phase::SEARCH, search_start);
+
+        const std::uint64_t path_start = stats.start_timer();
+        std::vector<long long> path;
+        if (meeting_node != INVALID_NODE_INDEX) {
+            // start .. meeting node from the forward parents, then on to the goal via the backward ones
+            path = state.forward.path_to(network, meeting_node);
+            for (NodeIndex u = state.backward.parent(meeting_node); u != INVALID_NODE_INDEX; u = state.backward.parent(u))
+                path.push_back(network.id_of(u));
+        }
+        state.finish();
+        stats.add_time(Phase::PATH, path_start);
+        return path;
+    }
+
+    // ==========================================================================
+    // Fork-Join Parallel A*
+    // ==========================================================================
+
+    struct AStarNode {
+        NodeIndex id;
+        double f_score;
+
+        bool operator>(const AStarNode& other) const { return f_score > other.f_score; }
+    };
+
+    // Shared g/parent table of the fork-join searches. Each value packs the float g-score
+    // with the parent index, so one lock-free update_min both lowers g and records the
+    // parent; relaxation tasks no longer serialize on a global g-score lock.
+    //
+    // g is rounded to float, so the returned path is optimal only up to that rounding (a
+    // relative error of about 6e-8 per edge, which adds up on long routes of short edges).
+    // An update is accepted only if it strictly lowers the float g: a tie, from a
+    // zero-length edge or an edge below one ulp of g, keeps the parent already recorded.
+    // Every parent thus had a strictly smaller or equal g when it was recorded and g only
+    // decreases, so the parents never form a cycle, and the start (g = 0, no parent) is
+    // never re-parented.
+    using ScoreMap = DataStructure::HashMap::ConcurrentHashMap<NodeIndex, std::uint64_t>;
+
+    // Returns the calling thread's score map, emptied and large enough for the network
+    inline ScoreMap &score_map_for_thread(const RoadNetwork &network) {
+        thread_local std::unique_ptr<ScoreMap> scores;
+        if (!scores || scores->capacity() < 2 * static_cast<size_t>(network.num_nodes()))
+            scores = std::make_unique<ScoreMap>(network.num_nodes());
+        else
+            scores->clear();
+        return *scores;
+    }
+
+    // g-score of u in the shared table, INF if u has not been reached
+    inline double shared_g(const ScoreMap &scores, NodeIndex u) {
+        std::uint64_t packed = scores.load(u);
+        return packed == ScoreMap::EMPTY_VALUE ? SearchContext::INF : DataStructure::HashMap::score_cost(packed);
+    }
+
+    // Follows the parents recorded in the shared table from goal back to the start
+    inline std::vector<long long> shared_path_to(const RoadNetwork &network, const ScoreMap &scores, NodeIndex goal) {
+        std::vector<long long> path;
+        for (NodeIndex u = goal; u != INVALID_NODE_INDEX; u = DataStructure::HashMap::score_index(scores.load(u)))
+            path.push_back(network.id_of(u));
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Atomic-min relaxation of one edge; returns the new g if it strictly improved, negative
+    // otherwise. An infinite g (a closed edge, or beyond float range) never reaches the
+    // table: an empty slot would take it and make the node look reached.
+    inline double relax_shared(ScoreMap &scores, NodeIndex neighbor_id, double tentative_g_score, NodeIndex current_id) {
+        const float g = static_cast<float>(tentative_g_score);
+        if (!std::isfinite(g)) return -1.0;
+        return scores.update_min(neighbor_id, DataStructure::HashMap::pack_score(g, current_id),
+                                 DataStructure::HashMap::score_cost_less)
+                   ? g
+                   : -1.0;
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    void neighbor_search_task_CppLib(std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>>& open_set,
+                            std::mutex& open_set_mutex, ScoreMap& scores,
+                            const RoadNetwork& network, const WeightSnapshot& weights,
+                            EdgeIndex begin, EdgeIndex end, double current_g_score, NodeIndex current_id,
+                            NodeIndex goal, Stats& stats) {
+
+        for (EdgeIndex e = begin; e < end; ++e) {
+            NodeIndex neighbor_id = network.edge_target(e);
+            double tentative_g_score = relax_shared(scores, neighbor_id, current_g_score + Cost::edge(weights, e), current_id);
+
+            if (tentative_g_score >= 0.0) {
+                double h_score = estimate<Heuristic, Cost>(network, neighbor_id, goal);
+                double f_score = tentative_g_score + h_score;
+
+                {
+                    auto lock = stats.lock(open_set_mutex, LockSite::OPEN_SET);
+                    open_set.push({ neighbor_id, f_score });
+                }
+                stats.on_push();
+            }
+        }
+    }
+
+    // Successors a concurrent relaxation task collects before pushing them as one batch
+    inline constexpr size_t PUSH_BATCH_SIZE = 16;
+
+    // Relaxation task for the concurrent (internally synchronized) open sets. Improved
+    // successors go in with push_bulk: one traversal of the PqFine list (one MultiQueue
+    // lock) per slice instead of one per successor.
+    template <class Heuristic, class Cost, class OpenSet, class Stats>
+    void neighbor_search_task_Concurrent(OpenSet& open_set,
+                            ScoreMap& scores,
+                            const RoadNetwork& network, const WeightSnapshot& weights,
+                            EdgeIndex begin, EdgeIndex end, double current_g_score, NodeIndex current_id,
+                            NodeIndex goal, Stats& stats) {
+
+        AStarNode batch[PUSH_BATCH_SIZE];
+        size_t batched = 0;
+        auto flush = [&]() {
+            // The open set synchronizes itself
+            const std::uint64_t push_start = stats.start_timer();
+            open_set.push_bulk(std::span<const AStarNode>(batch, batched));
+            stats.add_time(LockSite::CONCURRENT_OPEN_SET, push_start);
+            for (size_t i = 0; i < batched; ++i) stats.on_push();
+            batched = 0;
+        };
+
+        for (EdgeIndex e = begin; e < end; ++e) {
+            NodeIndex neighbor_id = network.edge_target(e);
+            double tentative_g_score = relax_shared(scores, neighbor_id, current_g_score + Cost::edge(weights, e), current_id);
+
+            if (tentative_g_score >= 0.0) {
+                double h_score = estimate<Heuristic, Cost>(network, neighbor_id, goal);
+                batch[batched++] = { neighbor_id, tentative_g_score + h_score };
+                if (batched == PUSH_BATCH_SIZE) flush();
+            }
+        }
+        if (batched > 0) flush();
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TPool_CppLib(const RoadNetwork& network,
+                                        long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                        Stats& stats) {
+        const std::uint64_t setup_start = stats.start_timer();
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        // Open set setup; its lock belongs to this query, so concurrent queries never contend
+        std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> open_set;
+        std::mutex open_set_mutex;  // Guards open_set while relaxation tasks push into it
+
+        // Shared g/parent table for the relaxation tasks; the context only records, on this
+        // thread, the g each node was expanded with
+        ScoreMap &scores = score_map_for_thread(network);
+        scores.store(start, DataStructure::HashMap::pack_score(0.0f, INVALID_NODE_INDEX));
+        SearchContext &context = SearchContext::for_thread(network);
+
+        // Add start node to the open set
+        open_set.push({start, estimate<Heuristic, Cost>(network, start, goal)});
+        stats.on_push();
+        stats.add_time(Phase::SETUP, setup_start);
+        const std::uint64_t search_start = stats.start_timer();
+
+        while (!open_set.empty()) {
+            AStarNode current;
+            {
+                auto lock = stats.lock(open_set_mutex, LockSite::OPEN_SET);
+                current = open_set.top();
+                open_set.pop();
+            }
+            stats.on_pop();
+
+            NodeIndex current_id = current.id;
+
+            // Skip stale duplicates: expanded already, and g has not improved since
+            if (context.is_closed(current_id) && shared_g(scores, current_id) >= context.g(current_id)) {
+                stats.on_stale_pop();
+                continue;
+            }
+
+            // Goal reached (same as before)
+            if (current_id == goal) {
+                stats.add_time(Phase::SEARCH, search_start);
+                const std::uint64_t path_start = stats.start_timer();
+                std::vector<long long> path = shared_path_to(network, scores, current_id);
+                stats.add_time(Phase::PATH, path_start);
+                return path;
+            }
+
+            // Get current node g_score (always set if reached via open_set) and close it
+            double current_g_score = shared_g(scores, current_id);
+            if (context.is_closed(current_id)) stats.on_reopen();
+            context.set(current_id, current_g_score, INVALID_NODE_INDEX);
+            context.close(current_id);
+            stats.on_expand();
+
+            // Parallel explore over the node's CSR edge block
+            EdgeIndex first_edge = network.edge_begin(current_id);
+            size_t total = network.edge_end(current_id) - first_edge;
+            if (total == 0) continue;  // Node has no outgoing edges
+
+            // Fork-join on the shared pool, one edge per task: idle threads pick up
+            // the remaining edges, so uneven relaxation costs balance out
+            const std::uint64_t relax_start = stats.start_timer();
+            ThreadPool::instance().parallel_for(total, [&](size_t i) {
+                EdgeIndex e = first_edge + static_cast<EdgeIndex>(i);
+                neighbor_search_task_CppLib<Heuristic, Cost>(open_set, open_set_mutex, scores, network, weights,
+                                            e, e + 1, current_g_score, current_id, goal, stats);
+            }, static_cast<size_t>(std::max(1, NUM_THREADS)));
+            stats.add_time(Phase::PARALLEL_RELAX, relax_start);
+        }
+
+        // Open set empty, goal not reached
+        stats.add_time(Phase::SEARCH, search_start);
+        return {};
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TVector_CppLib(const RoadNetwork &network,
+                                        long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                        Stats &stats)
+    {
+        const std::uint64_t setup_start = stats.start_timer();
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        // Open set setup; its lock belongs to this query, so concurrent queries never contend
+        std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> open_set;
+        std::mutex open_set_mutex;  // Guards open_set while relaxation tasks push into it
+
+        // Shared g/parent table for the relaxation tasks; the context only records, on this
+        // thread, the g each node was expanded with
+        ScoreMap &scores = score_map_for_thread(network);
+        scores.store(start, DataStructure::HashMap::pack_score(0.0f, INVALID_NODE_INDEX));
+        SearchContext &context = SearchContext::for_thread(network);
+
+        // Add start node to the open set
+        open_set.push({start, estimate<Heuristic, Cost>(network, start, goal)});
+        stats.on_push();
+        stats.add_time(Phase::SETUP, setup_start);
+        const std::uint64_t search_start = stats.start_timer();
+
+        while (!open_set.empty()) {
+            AStarNode current = open_set.top();
+            open_set.pop();
+            stats.on_pop();
+            NodeIndex current_id = current.id;
+
+            // Skip stale duplicates: expanded already, and g has not improved since
+            if (context.is_closed(current_id) && shared_g(scores, current_id) >= context.g(current_id)) {
+                stats.on_stale_pop();
+                continue;
+            }
+
+            // Goal reached (same as before)
+            if (current_id == goal) {
+                stats.add_time(Phase::SEARCH, search_start);
+                const std::uint64_t path_start = stats.start_timer();
+                std::vector<long long> path = shared_path_to(network, scores, current_id);
+                stats.add_time(Phase::PATH, path_start);
+                return path;
+            }
+
+            // Get current node g_score (always set if reached via open_set) and close it
+            double current_g_score = shared_g(scores, current_id);
+            if (context.is_closed(current_id)) stats.on_reopen();
+            context.set(current_id, current_g_score, INVALID_NODE_INDEX);
+            context.close(current_id);
+            stats.on_expand();
+ 
+            // Parallel explore over the node's CSR edge block
+            EdgeIndex first_edge = network.edge_begin(current_id);
+            size_t total = network.edge_end(current_id) - first_edge;
+            if (total == 0) continue;  // Node has no outgoing edges
+
+            // Fork-join on the shared pool with a static split: one contiguous slice per
+            // thread, as the former thread-per-slice version did but without creating threads
+            size_t slices = std::min(total, static_cast<size_t>(std::max(1, NUM_THREADS)));
+            size_t chunk_size = (total + slices - 1) / slices;
+            const std::uint64_t relax_start = stats.start_timer();
+            ThreadPool::instance().parallel_for(slices, [&](size_t t) {
+                EdgeIndex begin = first_edge + std::min(t * chunk_size, total);
+                EdgeIndex end = first_edge + std::min((t + 1) * chunk_size, total);
+                neighbor_search_task_CppLib<Heuristic, Cost>(open_set, open_set_mutex, scores, network, weights,
+                                            begin, end, current_g_score, current_id, goal, stats);
+            }, slices);
+            stats.add_time(Phase::PARALLEL_RELAX, relax_start);
+        }
+
+        // Open set empty, goal not reached
+        stats.add_time(Phase::SEARCH, search_start);
+        return {};
+    }
+
+    using PqFineOpenSet = DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<AStarNode, std::greater<AStarNode>>;
+    using MultiQueueOpenSet = DataStructure::PriorityQueue::MultiQueuePQ<AStarNode, std::greater<AStarNode>>;
+
+    // Shared driver for the concurrent open sets. StaticSplit selects the TVector-style
+    // one-slice-per-thread fork instead of the TPool-style per-edge fork.
+    //
+    // Relaxed open sets may pop out of f order, so the goal can first be reached on a
+    // suboptimal path. Instead of returning at the first goal pop, the goal's g becomes
+    // an incumbent, entries with f >= incumbent are dropped, and nodes whose g improves
+    // are re-expanded; the search ends when the open set drains. With an admissible
+    // heuristic that restores the exact result.
+    template <class Heuristic, class Cost, class OpenSet, bool Relaxed, bool StaticSplit, class Stats>
+    std::vector<long long> search_Concurrent(const RoadNetwork& network,
+                                             long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                             Stats& stats) {
+        const std::uint64_t setup_start = stats.start_timer();
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        // Open set setup
+        OpenSet open_set;
+
+        // Shared g/parent table for the relaxation tasks; the context only records, on this
+        // thread, the g each node was expanded with
+        ScoreMap &scores = score_map_for_thread(network);
+        scores.store(start, DataStructure::HashMap::pack_score(0.0f, INVALID_NODE_INDEX));
+        SearchContext &context = SearchContext::for_thread(network);
+
+        // Add start node to the open set
+        open_set.push({start, estimate<Heuristic, Cost>(network, start, goal)});
+        stats.on_push();
+        stats.add_time(Phase::SETUP, setup_start);
+        const std::uint64_t search_start = stats.start_timer();
+
+        // Best goal cost seen so far (relaxed open sets only)
+        double incumbent = SearchContext::INF;
+
+        while (!open_set.empty()) {
+            const std::uint64_t pop_start = stats.start_timer();
+            std::optional<AStarNode> current_opt = open_set.pop();
+            stats.add_time(LockSite::CONCURRENT_OPEN_SET, pop_start);
+            if (!current_opt) break;
+            stats.on_pop();
+            AStarNode current = current_opt.value();
+
+            NodeIndex current_id = current.id;
+
+            // Skip stale duplicates: expanded already, and g has not improved since
+            if (context.is_closed(current_id) && shared_g(scores, current_id) >= context.g(current_id)) {
+                stats.on_stale_pop();
+                continue;
+            }
+
+            if constexpr (Relaxed) {
+                // Cannot lead to a better goal path than the incumbent
+                if (current.f_score >= incumbent) {
+                    stats.on_stale_pop();
+                    continue;
+                }
+
+                // Goal reached: remember it, but keep draining entries that may still beat it
+                if (current_id == goal) {
+                    incumbent = shared_g(scores, goal);
+                    continue;
+                }
+            } else {
+                // Goal reached (same as before)
+                if (current_id == goal) {
+                    stats.add_time(Phase::SEARCH, search_start);
+                    const std::uint64_t path_start = stats.start_timer();
+                    std::vector<long long> path = shared_path_to(network, scores, current_id);
+                    stats.add_time(Phase::PATH, path_start);
+                    return path;
+                }
+            }
+
+            // Get current node g_score (always set if reached via open_set) and close it
+            double current_g_score = shared_g(scores, current_id);
+            if (context.is_closed(current_id)) stats.on_reopen();
+            context.set(current_id, current_g_score, INVALID_NODE_INDEX);
+            context.close(current_id);
+            stats.on_expand();
+
+            // Parallel explore over the node's CSR edge block
+            EdgeIndex first_edge = network.edge_begin(current_id);
+            size_t total = network.edge_end(current_id) - first_edge;
+            if (total == 0) continue;  // Node has no outgoing edges
+
+            const std::uint64_t relax_start = stats.start_timer();
+            if constexpr (StaticSplit) {
+                // Fork-join on the shared pool with a static split: one contiguous slice per
+                // thread, as the former thread-per-slice version did but without creating threads
+                size_t slices = std::min(total, static_cast<size_t>(std::max(1, NUM_THREADS)));
+                size_t chunk_size = (total + slices - 1) / slices;
+                ThreadPool::instance().parallel_for(slices, [&](size_t t) {
+                    EdgeIndex begin = first_edge + std::min(t * chunk_size, total);
+                    EdgeIndex end = first_edge + std::min((t + 1) * chunk_size, total);
+                    neighbor_search_task_Concurrent<Heuristic, Cost>(open_set, scores, network, weights, begin, end,
+                                                    current_g_score, current_id, goal, stats);
+                }, slices);
+            } else {
+                // Fork-join on the shared pool, one edge per task: idle threads pick up
+                // the remaining edges, so uneven relaxation costs balance out
+                ThreadPool::instance().parallel_for(total, [&](size_t i) {
+                    EdgeIndex e = first_edge + static_cast<EdgeIndex>(i);
+                    neighbor_search_task_Concurrent<Heuristic, Cost>(open_set, scores, network, weights, e, e + 1,
+                                                    current_g_score, current_id, goal, stats);
+                }, static_cast<size_t>(std::max(1, NUM_THREADS)));
+            }
+            stats.add_time(Phase::PARALLEL_RELAX, relax_start);
+        }
+        stats.add_time(Phase::SEARCH, search_start);
+
+        if constexpr (Relaxed) {
+            if (incumbent < SearchContext::INF) {
+                const std::uint64_t path_start = stats.start_timer();
+                std::vector<long long> path = shared_path_to(network, scores, goal);
+                stats.add_time(Phase::PATH, path_start);
+                return path;
+            }
+        }
+
+        // Open set empty, goal not reached
+        return {};
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TPool_PqFine(const RoadNetwork& network,
+                                            long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                            Stats& stats) {
+        return search_Concurrent<Heuristic, Cost, PqFineOpenSet, false, false>(network, start_node_id, goal_node_id, NUM_THREADS, stats);
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TVector_PqFine(const RoadNetwork &network,
+                                        long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                        Stats& stats)
+    {
+        return search_Concurrent<Heuristic, Cost, PqFineOpenSet, false, true>(network, start_node_id, goal_node_id, NUM_THREADS, stats);
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TPool_MultiQueue(const RoadNetwork& network,
+                                                long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                                Stats& stats) {
+        return search_Concurrent<Heuristic, Cost, MultiQueueOpenSet, true, false>(network, start_node_id, goal_node_id, NUM_THREADS, stats);
+    }
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_TVector_MultiQueue(const RoadNetwork &network,
+                                                  long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                                  Stats& stats)
+    {
+        return search_Concurrent<Heuristic, Cost, MultiQueueOpenSet, true, true>(network, start_node_id, goal_node_id, NUM_THREADS, stats);
+    }
+
+    // ==========================================================================
+    // Hash-Distributed A* (HDA*)
+    // ==========================================================================
+    //
+    // Every node has one owner worker, picked by hashing its index. Only the owner keeps
+    // the node in its open list and writes its g/parent/closed entries, so the search
+    // state needs no locks. Successors owned by another worker are sent to it through
+    // that worker's mailbox.
+    //
+    // On a network partitioned over several NUMA domains (RoadNetwork::partitioned) the
+    // owner is hashed among the workers running on the node's domain instead, so a node
+    // is expanded next to its CSR slice and its messages stay on that socket. Each worker
+    // reports its domain (from the CPU it runs on; stable with a pinned pool, see
+    // ThreadPool::configure) before the search starts; a domain without workers falls
+    // back to all of them.
+    //
+    // Termination: `work` counts in-flight messages plus active workers. Senders add the
+    // batch size before publishing; an idle worker that absorbs k messages adds 1 - k
+    // (it becomes active in the same step); a worker that runs dry subtracts 1. The
+    // count therefore reaches zero only when no worker holds or can receive work.
+    //
+    // Optimality: the best goal cost found so far (the incumbent) prunes nodes with
+    // f >= incumbent. The search ends only when every open list is empty or pruned, so
+    // with an admissible heuristic the incumbent is optimal.
+
+    struct HdaMessage {
+        NodeIndex node;
+        NodeIndex parent;
+        double g_score;
+    };
+
+    struct HdaBatch {
+        HdaBatch* next = nullptr;
+        std::vector<HdaMessage> messages;
+    };
+
+    // Lock-free MPSC mailbox: producers CAS batches onto a stack, the owner takes the
+    // whole stack with one exchange (so there is no ABA problem)
+    struct alignas(64) HdaMailbox {
+        std::atomic<HdaBatch*> head{ nullptr };
+
+        void push(HdaBatch* batch) {
+            batch->next = head.load(std::memory_order_relaxed);
+            while (!head.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+            }
+        }
+
+        HdaBatch* take_all() { return head.exchange(nullptr, std::memory_order_acquire); }
+
+        // Batches nobody received (the search ended early) are freed with the mailbox
+        ~HdaMailbox() {
+            for (HdaBatch* batch = take_all(); batch != nullptr;) {
+                HdaBatch* next = batch->next;
+                delete batch;
+                batch = next;
+            }
+        }
+    };
+
+    // Per-worker free list of batches: a worker recycles the batches it received for its
+    // own flushes, keeping their message capacity, instead of one new / delete per flush
+    class HdaBatchPool {
+    public:
+        HdaBatchPool() = default;
+        HdaBatchPool(const HdaBatchPool&) = delete;
+        HdaBatchPool& operator=(const HdaBatchPool&) = delete;
+
+        ~HdaBatchPool() {
+            while (free_ != nullptr) delete acquire();
+        }
+
+        HdaBatch* acquire() {
+            if (free_ == nullptr) return new HdaBatch;
+            HdaBatch* batch = free_;
+            free_ = batch->next;
+            batch->next = nullptr;
+            return batch;
+        }
+
+        void release(HdaBatch* batch) {
+            batch->messages.clear();
+            batch->next = free_;
+            free_ = batch;
+        }
+
+    private:
+        HdaBatch* free_ = nullptr;
+    };
+
+    // Messages buffered per destination before a batch is published
+    constexpr size_t HDA_BATCH_SIZE = 32;
+
+    // Expansions between forced flushes, so peers are not starved while a worker is busy
+    constexpr size_t HDA_FLUSH_INTERVAL = 64;
+
+    inline size_t hda_owner(NodeIndex u, size_t num_workers) {
+        // Fibonacci hashing spreads neighboring indices over different workers
+        return static_cast<size_t>((static_cast<std::uint64_t>(u) * 0x9E3779B97F4A7C15ull) >> 32) % num_workers;
+    }
+
+    // Owner of every node: hda_owner() over all workers, or over the workers of the node's
+    // NUMA domain on a partitioned network
+    class HdaOwnership {
+    public:
+        HdaOwnership(const GraphPartition& partition, std::span<const size_t> worker_domains)
+            : partition_(partition), num_workers_(worker_domains.size()) {
+            if (partition.num_domains() <= 1) return;
+            domain_workers_.resize(partition.num_domains());
+            for (size_t worker = 0; worker < worker_domains.size(); ++worker)
+                domain_workers_[worker_domains[worker] % partition.num_domains()].push_back(worker);
+            for (std::vector<size_t>& workers : domain_workers_)
+                if (workers.empty()) {
+                    workers.resize(num_workers_);
+                    std::iota(workers.begin(), workers.end(), size_t(0));
+                }
+        }
+
+        size_t operator()(NodeIndex u) const {
+            if (domain_workers_.empty()) return hda_owner(u, num_workers_);
+            const std::vector<size_t>& workers = domain_workers_[partition_.domain_of(u)];
+            return workers[hda_owner(u, workers.size())];
+        }
+
+    private:
+        const GraphPartition& partition_;
+        size_t num_workers_;
+        std::vector<std::vector<size_t>> domain_workers_;  // Empty: not NUMA-aware
+    };
+
+    template <class Heuristic, class Cost, class Stats>
+    std::vector<long long> search_HDA(const RoadNetwork& network,
+                                      long long start_node_id, long long goal_node_id, int NUM_THREADS,
+                                      Stats& stats) {
+        const std::uint64_t setup_start = stats.start_timer();
+
+        // Translate OSM ids to dense indices once, at the API boundary
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Weights of this query, unaffected by traffic updates published while it runs
+        const WeightSnapshot weights = network.pin_weights();
+
+        // Workers wait on each other, so each needs its own thread
+        ThreadPool& pool = ThreadPool::instance();
+        const size_t num_workers = std::min(static_cast<size_t>(std::max(1, NUM_THREADS)), pool.max_parallelism());
+
+        // Shared dense state; each entry is only ever touched by its node's owner
+        SearchContext& context = SearchContext::for_thread(network);
+        context.set(start, 0.0, INVALID_NODE_INDEX);
+        if (start == goal) return context.path_to(network, goal);
+
+        std::vector<HdaMailbox> mailboxes(num_workers);
+        std::atomic<long long> work{ 1 };  // The start node's owner begins active
+        const bool numa_aware = network.partition().num_domains() > 1;
+        std::vector<size_t> worker_domains(num_workers, 0);
+        std::atomic<size_t> reported{ 0 };
+        std::atomic<bool> done{ false };
+        std::atomic<double> incumbent{ SearchContext::INF };
+
+        // First exception of any worker; it ends the search for all of them (the others
+        // would otherwise wait for its work forever) and is rethrown after the join
+        std::atomic<bool> failed{ false };
+        std::exception_ptr error;
+
+        auto lower_incumbent = [&incumbent](double cost) {
+            double current = incumbent.load(std::memory_order_relaxed);
+            while (cost < current && !incumbent.compare_exchange_weak(current, cost, std::memory_order_relaxed)) {
+            }
+        };
+
+        stats.add_time(Phase::SETUP, setup_start);
+        const std::uint64_t search_start = stats.start_timer();
+
+        pool.parallel_for(num_workers, [&](size_t self) {
+            try {
+                if (numa_aware) {
+                    // Every worker runs on its own thread, so all of them arrive here
+                    worker_domains[self] = NumaTopology::system().current_node();
+                    reported.fetch_add(1, std::memory_order_acq_rel);
+                    while (reported.load(std::memory_order_acquire) < num_workers && !done.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                }
+                const HdaOwnership owner_of(network.partition(), worker_domains);
+
+                std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> open_set;
+                std::vector<std::vector<HdaMessage>> outbox(num_workers);
+                HdaBatchPool batches;
+                bool active = (self == owner_of(start));
+                size_t expansions = 0;
+
+                if (active) {
+                    open_set.push({ start, estimate<Heuristic, Cost>(network, start, goal) });
+                    stats.on_push();
+                }
+
+                // Applies a candidate path to an owned node
+                auto relax = [&](NodeIndex node, NodeIndex parent, double g_score) {
+                    if (g_score >= context.g(node)) return;
+                    if (context.is_closed(node)) stats.on_reopen();
+                    context.set(node, g_score, parent);
+                    context.reopen(node);
+                    if (node == goal) {
+                        // Edges out of the goal cannot shorten the path to it, so it is never expanded
+                        lower_incumbent(g_score);
+                        return;
+                    }
+                    double f_score = g_score + estimate<Heuristic, Cost>(network, node, goal);
+                    if (f_score < incumbent.load(std::memory_order_relaxed)) {
+                        open_set.push({ node, f_score });
+                        stats.on_push();
+                    }
+                };
+
+                auto flush = [&](size_t owner) {
+                    HdaBatch* batch = batches.acquire();
+                    batch->messages.swap(outbox[owner]);
+                    // Count the messages before anyone can receive them
+                    work.fetch_add(static_cast<long long>(batch->messages.size()), std::memory_order_relaxed);
+                    mailboxes[owner].push(batch);
+                };
+
+                auto flush_all = [&]() {
+                    for (size_t owner = 0; owner < num_workers; ++owner)
+                        if (!outbox[owner].empty()) flush(owner);
+                };
+
+                while (!done.load(std::memory_order_acquire)) {
+                    // Absorb incoming candidates
+                    if (HdaBatch* batch = mailboxes[self].take_all()) {
+                        long long received = 0;
+                        for (HdaBatch* b = batch; b != nullptr; b = b->next) received += static_cast<long long>(b->messages.size());
+                        // Become active before the messages stop counting
+                        work.fetch_add((active ? 0 : 1) - received, std::memory_order_relaxed);
+                        active = true;
+                        while (batch != nullptr) {
+                            for (const HdaMessage& message : batch->messages) relax(message.node, message.parent, message.g_score);
+                            HdaBatch* next = batch->next;
+                            batches.release(batch);
+                            batch = next;
+                        }
+                    }
+
+                    if (!active) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    // Drop everything that cannot beat the incumbent (the heap minimum bounds the rest)
+                    if (!open_set.empty() && open_set.top().f_score >= incumbent.load(std::memory_order_relaxed)) {
+                        stats.on_discard(open_set.size());
+                        open_set = {};
+                    }
+
+                    if (open_set.empty()) {
+                        // Out of local work: publish what is buffered, then go idle
+                        flush_all();
+                        active = false;
+                        if (work.fetch_sub(1, std::memory_order_acq_rel) == 1) done.store(true, std::memory_order_release);
+                        continue;
+                    }
+
+                    AStarNode current = open_set.top();
+                    open_set.pop();
+                    stats.on_pop();
+                    NodeIndex current_id = current.id;
+
+                    // Skip stale duplicates of nodes that were already expanded
+                    if (context.is_closed(current_id)) {
+                        stats.on_stale_pop();
+                        continue;
+                    }
+
+                    double current_g_score = context.g(current_id);
+                    context.close(current_id);
+                    stats.on_expand();
+
+                    for (EdgeIndex e = network.edge_begin(current_id); e < network.edge_end(current_id); ++e) {
+                        NodeIndex neighbor_id = network.edge_target(e);
+                        double tentative_g_score = current_g_score + Cost::edge(weights, e);
+                        size_t owner = owner_of(neighbor_id);
+
+                        if (owner == self) {
+                            relax(neighbor_id, current_id, tentative_g_score);
+                        } else {
+                            outbox[owner].push_back({ neighbor_id, current_id, tentative_g_score });
+                            stats.on_message();
+                            if (outbox[owner].size() >= HDA_BATCH_SIZE) flush(owner);
+                        }
+                    }
+
+                    if (++expansions % HDA_FLUSH_INTERVAL == 0) flush_all();
+                }
+            } catch (...) {
+                if (!failed.exchange(true)) error = std::current_exception();
+                done.store(true, std::memory_order_release);
+            }
+        }, num_workers);
+        stats.add_time(Phase::SEARCH, search_start);
+        if (error) std::rethrow_exception(error);
+
+        // The pool join orders every worker's writes before this read
+        if (incumbent.load() == SearchContext::INF) return {};
+        const std::uint64_t path_start = stats.start_timer();
+        std::vector<long long> path = context.path_to(network, goal);
+        stats.add_time(Phase::PATH, path_start);
+        return path;
+    }
+
+}
+
+
+namespace std {
+    template <>
+    class numeric_limits<AStarEngine::AStarNode> {
+    public:
+        static constexpr bool is_specialized = true;
+
+        static constexpr AStarEngine::AStarNode min() noexcept {
+            return { std::numeric_limits<NodeIndex>::min(), std::numeric_limits<double>::lowest() };
+        }
+
+        static constexpr AStarEngine::AStarNode max() noexcept {
+            return { std::numeric_limits<NodeIndex>::max(), std::numeric_limits<double>::max() };
+        }
+
+        static constexpr AStarEngine::AStarNode lowest() noexcept {
+            return { std::numeric_limits<NodeIndex>::lowest(), std::numeric_limits<double>::lowest() };
+        }
+
+        static constexpr bool has_infinity = false;
+        static constexpr bool has_quiet_NaN = false;
+        static constexpr bool has_signaling_NaN = false;
+
+        // Others can remain defaulted or false as appropriate
+    };
+}
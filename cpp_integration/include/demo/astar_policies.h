@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../data_structure/pq_indexed_dary.h"  // Indexed open set with decrease_key
+#include "../graph_types.h"                     // NodeIndex, EdgeIndex
+#include "../road_network.h"                    // RoadNetwork class header
+#include "search_stats.h"                       // Stats policies (NoStats, StatsRecorder)
+#include <algorithm>
+#include <cstddef>
+#include <functional>  // For std::greater
+#include <queue>
+#include <vector>
+
+/**
+ * Compile-time policies of the A* engine (astar_engine.h).
+ *
+ * Every search variant is one template instantiated with a Heuristic, a Cost and (for the
+ * sequential search) an OpenSet policy. All policy members are static or inline, so an
+ * instantiation compiles to the same straight-line relaxation loop a hand-written copy
+ * would, with no indirect calls.
+ *
+ * Heuristic: static double estimate(network, a, b), a lower bound on the cost a -> b in
+ *            edge-weight units, and static void estimate_batch(network, nodes, count,
+ *            goal, out), the same for a block of nodes.
+ * Cost:      static double edge(weights, e), reverse_edge(weights, e), the cost of a
+ *            forward / reverse CSR edge under the WeightSnapshot the query pinned, and
+ *            HEURISTIC_SCALE, the factor that keeps the heuristic a lower bound under
+ *            this cost.
+ * OpenSet:   see IndexedHeapOpenSet and LazyHeapOpenSet.
+ * Focal:     static double priority(network, u, goal, g, h), the expansion order of focal
+ *            search (search_bounded) among the nodes within epsilon of the best f.
+ * Stats:     NoStats or StatsRecorder (search_stats.h), passed by reference to every
+ *            engine function; NoStats compiles to nothing.
+ */
+namespace AStarEngine {
+
+    // ==========================================================================
+    // Heuristic Policies
+    // ==========================================================================
+
+    // Great-circle distance (or network.geo_bound), tightened by the ALT bound when the
+    // network carries landmark tables (Landmarks::preprocess)
+    struct GreatCircleHeuristic {
+        static double estimate(const RoadNetwork &network, NodeIndex a, NodeIndex b) {
+            double result = network.geo().distance_km(a, b);
+            const LandmarkTable &landmarks = network.landmarks();
+            return landmarks.empty() ? result : std::max(result, landmarks.lower_bound(a, b));
+        }
+
+        // Geographic part through the vectorized GeoCoordinates kernel, then ALT per node
+        static void estimate_batch(const RoadNetwork &network, const NodeIndex *nodes, size_t count,
+                                   NodeIndex goal, double *out) {
+            network.geo().distances_km(nodes, count, goal, out);
+            const LandmarkTable &landmarks = network.landmarks();
+            if (!landmarks.empty())
+                for (size_t i = 0; i < count; ++i)
+                    out[i] = std::max(out[i], landmarks.lower_bound(nodes[i], goal));
+        }
+    };
+
+    // Latitude/longitude box (degrees) whose nodes get a fixed heuristic penalty
+    struct PenaltyRegion {
+        double min_lat;
+        double max_lat;
+        double min_lon;
+        double max_lon;
+        double penalty;
+
+        constexpr bool contains(double lat, double lon) const {
+            return lat >= min_lat && lat <= max_lat && lon >= min_lon && lon <= max_lon;
+        }
+    };
+
+    // GreatCircleHeuristic plus Region.penalty for nodes inside Region. The region is a
+    // template argument, so its bounds are constants in the generated code. The penalty
+    // makes the heuristic inadmissible on purpose: searches steer around the region.
+    template <const PenaltyRegion &Region>
+    struct RegionPenaltyHeuristic {
+        static double estimate(const RoadNetwork &network, NodeIndex a, NodeIndex b) {
+            double result = GreatCircleHeuristic::estimate(network, a, b);
+            return Region.contains(network.lat(a), network.lon(a)) ? result + Region.penalty : result;
+        }
+
+        static void estimate_batch(const RoadNetwork &network, const NodeIndex *nodes, size_t count,
+                                   NodeIndex goal, double *out) {
+            GreatCircleHeuristic::estimate_batch(network, nodes, count, goal, out);
+            for (size_t i = 0; i < count; ++i)
+                if (Region.contains(network.lat(nodes[i]), network.lon(nodes[i]))) out[i] += Region.penalty;
+        }
+    };
+
+    // Region of the dynamic-cost demo (AStarEnhancement*)
+    inline constexpr PenaltyRegion DYNAMIC_COST_REGION{35.6895, 60.6950, 119.6900, 139.7050, 1000.0};
+
+    using DynamicCostHeuristic = RegionPenaltyHeuristic<DYNAMIC_COST_REGION>;
+
+    // ==========================================================================
+    // Cost Policies
+    // ==========================================================================
+
+    // Plain (live) edge weights
+    struct EdgeWeightCost {
+        static constexpr double HEURISTIC_SCALE = 1.0;
+
+        static double edge(const WeightSnapshot &weights, EdgeIndex e) { return weights.forward(e); }
+
+        static double reverse_edge(const WeightSnapshot &weights, EdgeIndex e) { return weights.reverse(e); }
+    };
+
+    // Edge weights times Factor; the heuristic is scaled alike, so it stays admissible and
+    // the search finds the same paths as with EdgeWeightCost
+    template <int Factor>
+    struct ScaledCost {
+        static_assert(Factor > 0, "ScaledCost needs a positive factor");
+
+        static constexpr double HEURISTIC_SCALE = Factor;
+
+        static double edge(const WeightSnapshot &weights, EdgeIndex e) { return Factor * weights.forward(e); }
+
+        static double reverse_edge(const WeightSnapshot &weights, EdgeIndex e) { return Factor * weights.reverse(e); }
+    };
+
+    // f-score contribution of the heuristic under a cost policy
+    template <class Heuristic, class Cost>
+    inline double estimate(const RoadNetwork &network, NodeIndex a, NodeIndex b) {
+        return Cost::HEURISTIC_SCALE * Heuristic::estimate(network, a, b);
+    }
+
+    // ==========================================================================
+    // Open Set Policies (sequential engine)
+    // ==========================================================================
+    //
+    // reset(num_nodes), empty(), push_or_decrease(u, f) -> true if it added an entry (false
+    // for an in-place improvement), pop() -> NodeIndex and top_f().
+    // MAY_HOLD_STALE tells the engine whether popped nodes can be outdated duplicates.
+
+    // One entry per node, improved in place by decrease_key (pq_indexed_dary.h)
+    template <size_t Arity>
+    class IndexedHeapOpenSet {
+    public:
+        static constexpr bool MAY_HOLD_STALE = false;
+
+        // Empty, positions sized to the nodes; positions are cleared lazily, so reuse
+        // costs O(leftover entries)
+        void reset(size_t num_nodes) {
+            heap_.clear();
+            heap_.reserve_ids(num_nodes);
+        }
+
+        bool empty() const { return heap_.empty(); }
+
+        bool push_or_decrease(NodeIndex u, double f_score) {
+            const bool added = !heap_.contains(u);
+            heap_.push_or_decrease(u, f_score);
+            return added;
+        }
+
+        NodeIndex pop() { return heap_.pop().first; }
+
+        double top_f() const { return heap_.top().second; }
+
+    private:
+        DataStructure::PriorityQueue::IndexedDaryHeap<Arity, double, std::greater<double>> heap_;
+    };
+
+    // Binary heap with duplicates (std::priority_queue): every improvement pushes a new
+    // entry and outdated ones are skipped when popped
+    class LazyHeapOpenSet {
+    public:
+        static constexpr bool MAY_HOLD_STALE = true;
+
+        void reset(size_t) { heap_ = {}; }
+
+        bool empty() const { return heap_.empty(); }
+
+        bool push_or_decrease(NodeIndex u, double f_score) {
+            heap_.push({f_score, u});
+            return true;
+        }
+
+        NodeIndex pop() {
+            NodeIndex u = heap_.top().second;
+            heap_.pop();
+            return u;
+        }
+
+        double top_f() const { return heap_.top().first; }
+
+    private:
+        using Entry = std::pair<double, NodeIndex>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap_;
+    };
+
+    // 4-ary was fastest of 2/4/8 in pq_benchmark
+    constexpr size_t OPEN_SET_ARITY = 4;
+
+    using DefaultOpenSet = IndexedHeapOpenSet<OPEN_SET_ARITY>;
+
+    // ==========================================================================
+    // Focal Policies (focal search of search_bounded)
+    // ==========================================================================
+    //
+    // Any node of the focal list keeps the epsilon bound, so priority() is free to rank
+    // them by something other than f, lower first: usually an estimate of the search
+    // effort left. h is the scaled heuristic estimate of u, g its current cost.
+
+    // Remaining heuristic distance: expand the focal node that looks closest to the goal,
+    // which walks straight towards it while the bound allows
+    struct DistanceToGoFocal {
+        static double priority(const RoadNetwork &, NodeIndex, NodeIndex, double /*g*/, double h) { return h; }
+    };
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../graph_types.h"
+#include "../road_network.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace BatchSearch {
+
+    /**
+     * @brief Paths of a batch in one flat buffer (CSR style).
+     *
+     * The path of query i is ids[offsets[i], offsets[i + 1]), start first; it is empty
+     * when the goal is unreachable. offsets has one more entry than there are queries.
+     */
+    struct PathBuffer {
+        std::vector<std::int64_t> offsets;
+        std::vector<long long> ids;
+    };
+
+    // Answers starts[i] -> goals[i] for every i with the sequential A* search (AStar::search,
+    // so through the network's path cache if it has one), spreading the queries over the
+    // process-wide ThreadPool (inter-query parallelism). On a network partitioned over NUMA
+    // domains each query preferably runs on a thread of its start node's domain.
+    // num_threads <= 0 uses the whole pool. Throws std::invalid_argument if the arrays differ
+    // in length or an id is unknown.
+    PathBuffer search_many(const RoadNetwork &network, std::span<const long long> starts,
+                           std::span<const long long> goals, int num_threads);
+
+    // Travel cost from every source to every target under the live weights (pinned once for
+    // the whole matrix), row-major: entry [i * targets.size() + j] is sources[i] -> targets[j],
+    // +infinity if unreachable. One Dijkstra per source, spread over the ThreadPool; each
+    // stops as soon as it has settled every target and records no parents, since only costs
+    // are returned; sources are routed to their NUMA domain like in search_many().
+    // num_threads <= 0 uses the whole pool. Throws std::invalid_argument for an unknown id.
+    std::vector<double> distance_matrix(const RoadNetwork &network, std::span<const long long> sources,
+                                        std::span<const long long> targets, int num_threads);
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../graph_types.h"
+#include "../road_network.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CH {
+
+    /**
+     * @brief Contraction Hierarchy over a static RoadNetwork.
+     *
+     * Preprocessing contracts the nodes one importance level at a time: removing a node v
+     * adds a shortcut u -> w for every in/out neighbor pair whose only shortest path runs
+     * through v (checked by a bounded witness Dijkstra). The contraction order is the
+     * node's rank. Each level is an independent set of nodes whose priority (edge
+     * difference + contracted neighbors) is a local minimum; their witness searches run
+     * in parallel on the ThreadPool, since no two of them are adjacent.
+     *
+     * The result is an overlay of two CSR graphs holding original edges and shortcuts:
+     * "up" lists the arcs x -> y with rank(y) > rank(x) at x, "down" lists the arcs
+     * y -> x with rank(y) > rank(x) at x. A query runs Dijkstra upwards from the start
+     * (up) and upwards from the goal over reversed arcs (down); the best meeting node
+     * gives the distance, and shortcuts are unpacked recursively into original edges.
+     *
+     * The hierarchy is built for the network's live weights at build time and stays valid
+     * only while they do not change: queries throw once a traffic update (or a new traffic
+     * time) has been published since. Queries are const and may run concurrently
+     * (per-thread search state).
+     */
+    class ContractionHierarchy {
+    public:
+        // Witness searches give up after settling this many nodes and keep the shortcut:
+        // never wrong, at worst a few superfluous shortcuts
+        static constexpr size_t WITNESS_SETTLE_LIMIT = 500;
+
+        // Cheaper limit for the simulated contractions that only estimate priorities
+        static constexpr size_t SIMULATION_SETTLE_LIMIT = 50;
+
+        // Contracts every node of the network. num_threads <= 0 uses the whole pool.
+        static ContractionHierarchy build(const RoadNetwork &network, int num_threads);
+
+        // Shortest path as OSM ids, start first (empty if unreachable), in the same format
+        // as AStar::search. The network must be the one the hierarchy was built from.
+        std::vector<long long> search(const RoadNetwork &network, long long start_node_id,
+                                      long long goal_node_id) const;
+
+        size_t num_nodes() const { return rank_.size(); }
+
+        // Arcs in the overlay (original edges kept plus shortcuts), and shortcuts alone
+        size_t num_arcs() const { return up_.heads.size() + down_.heads.size(); }
+
+        size_t num_shortcuts() const { return num_shortcuts_; }
+
+        // Contraction order of u: 0 was contracted first, num_nodes() - 1 last
+        NodeIndex rank(NodeIndex u) const { return rank_[u]; }
+
+        // RoadNetwork::weights_version() the hierarchy was built for
+        std::uint64_t weights_version() const { return weights_version_; }
+
+    private:
+        // One direction of the overlay in CSR form. heads[e] is the far end of arc e
+        // (target in up, source in down); middle[e] the contracted node a shortcut
+        // bypasses, INVALID_NODE_INDEX for an original edge.
+        struct Overlay {
+            std::vector<EdgeIndex> offsets;
+            std::vector<NodeIndex> heads;
+            std::vector<double> weights;
+            std::vector<NodeIndex> middle;
+
+            // Arc between x and head stored at x, NO_ARC if there is none
+            EdgeIndex find(NodeIndex x, NodeIndex head) const;
+        };
+
+        static constexpr EdgeIndex NO_ARC = static_cast<EdgeIndex>(-1);
+
+        // Appends the nodes after `from` on the original edges the arc from -> to stands for
+        void unpack(NodeIndex from, NodeIndex to, std::vector<NodeIndex> &out) const;
+
+        std::vector<NodeIndex> rank_;
+        Overlay up_;
+        Overlay down_;
+        size_t num_shortcuts_ = 0;
+        std::uint64_t weights_version_ = 0;
+    };
+
+}
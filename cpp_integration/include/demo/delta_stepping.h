@@ -0,0 +1,58 @@
+#pragma once
+
+#include "../graph_types.h"
+#include "../road_network.h"
+#include <vector>
+
+namespace DeltaStepping {
+
+    /**
+     * @brief Parallel single-source shortest distances (Δ-stepping, Meyer & Sanders).
+     *
+     * Nodes wait in buckets of width Δ by tentative distance. The smallest non-empty
+     * bucket is settled in phases: every node of it relaxes its light edges (weight <= Δ)
+     * in parallel, which may refill the same bucket, until it stays empty; then the nodes
+     * settled in it relax their heavy edges once. Within a phase the frontier is split
+     * into chunks spread over the ThreadPool, distances are lowered with an atomic
+     * compare-and-swap minimum, and each chunk collects its bucket insertions locally, so
+     * the only serial step per phase is merging those lists.
+     *
+     * Δ trades work for parallelism: Δ -> 0 degenerates to Dijkstra (one node per phase),
+     * Δ -> infinity to Bellman-Ford (one bucket, many re-relaxations). The default is a
+     * few mean edge weights, which keeps the phases of road networks wide without much
+     * redundant work.
+     *
+     * There is no goal: the result is the distance to every node, for one-to-many and
+     * isochrone queries, and it serves as the parallel backend of Landmarks::preprocess
+     * when there are fewer landmark runs than threads.
+     */
+
+    // Mean edge weights per bucket when no Δ is given
+    constexpr double DEFAULT_DELTA_FACTOR = 4.0;
+
+    // Frontier nodes handed to one parallel task
+    constexpr size_t CHUNK_SIZE = 256;
+
+    // Edge weights a run relaxes
+    enum class Weights {
+        LIVE,  // Current live weights (pinned for the whole run)
+        BASE   // Free-flow weights (landmark preprocessing)
+    };
+
+    // Distances from source (or, with reverse, to source over the reverse CSR) for every
+    // node index, +infinity where unreachable. Edges of weight +infinity (closed by a
+    // traffic update) are never relaxed. delta <= 0 picks DEFAULT_DELTA_FACTOR mean
+    // edge weights; num_threads <= 0 uses the whole pool.
+    std::vector<double> distances(const RoadNetwork &network, NodeIndex source, bool reverse, Weights weights,
+                                  double delta, int num_threads);
+
+    // Same from an OSM id under the live weights; the result is indexed like
+    // RoadNetwork::node_ids(). Throws std::runtime_error for an unknown id.
+    std::vector<double> distances_from(const RoadNetwork &network, long long source_node_id, double delta,
+                                       int num_threads);
+
+    // Distances of every node to target_node_id (reverse search), indexed like node_ids()
+    std::vector<double> distances_to(const RoadNetwork &network, long long target_node_id, double delta,
+                                     int num_threads);
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../data_structure/pq_indexed_dary.h"  // Open set with update_key / erase
+#include "../graph_types.h"
+#include "../road_network.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // For std::greater
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace DStarLite {
+
+    /**
+     * @brief Incremental shortest-path planner to a fixed goal (D* Lite).
+     *
+     * The search runs backwards from the goal: g(u) is the current estimate of the cost
+     * u -> goal and rhs(u) = min over edges u -> v of c(u, v) + g(v) its one-step
+     * lookahead. Nodes where the two differ are "inconsistent" and sit in the open set,
+     * keyed by [min(g, rhs) + h(start, u) + k_m, min(g, rhs)], h being the A* great-circle
+     * (and ALT, if present) heuristic towards the current start.
+     *
+     * The planner keeps g, rhs and the open set between searches. When the network
+     * publishes new live weights (RoadNetwork::update_traffic, set_traffic_time, ...), the
+     * next search diffs them against the weights it last planned with and only makes the
+     * sources of the changed edges inconsistent; expanding those repairs exactly the part
+     * of the search tree whose costs moved. When the vehicle moves, the new start just
+     * raises k_m by h(previous start, new start) instead of re-keying the open set, so the
+     * old search tree stays valid. A re-query after a few traffic updates along the route
+     * therefore expands a small fraction of the nodes a fresh A* search would.
+     *
+     * Memory is O(nodes + edges) per planner (g, rhs, heap positions and a copy of the
+     * weights planned with); a weights change costs one O(edges) scan to find the changed
+     * edges. The network must outlive the planner. Searches on one planner are serialized;
+     * use one planner per vehicle (or goal) to plan concurrently.
+     */
+    class Planner {
+    public:
+        // Plans towards goal_node_id; throws std::runtime_error for an unknown id
+        Planner(const RoadNetwork &network, long long goal_node_id);
+
+        Planner(const Planner &) = delete;
+        Planner &operator=(const Planner &) = delete;
+
+        // Shortest path start -> goal under the network's current live weights, as OSM ids
+        // start first (empty if the goal is unreachable). The first call searches from
+        // scratch; later calls repair the previous search for the new start and for every
+        // weight change published since.
+        std::vector<long long> search(long long start_node_id);
+
+        long long goal_node() const { return network_.id_of(goal_); }
+
+        // Nodes expanded by the last search (the work a repair saved shows up here)
+        size_t last_expansions() const { return last_expansions_; }
+
+        // Edges whose weight changed between the previous search and the last one
+        size_t last_changed_edges() const { return last_changed_edges_; }
+
+    private:
+        using Key = std::pair<double, double>;  // Lexicographic [k1, k2]
+
+        Key calculate_key(NodeIndex u) const;
+
+        // Puts u in the open set iff it is inconsistent, with its current key
+        void update_vertex(NodeIndex u);
+
+        // rhs(u) from scratch over the outgoing edges of u
+        double lookahead(const WeightSnapshot &weights, NodeIndex u) const;
+
+        // Diffs the pinned weights against known_weights_ and re-evaluates the sources of
+        // the edges that changed
+        void apply_weight_changes(const WeightSnapshot &weights);
+
+        void compute_shortest_path(const WeightSnapshot &weights);
+
+        const RoadNetwork &network_;
+        NodeIndex goal_;
+        NodeIndex start_ = INVALID_NODE_INDEX;  // Start of the last search
+        double k_m_ = 0.0;                      // Sum of h(previous start, next start) so far
+
+        std::vector<double> g_;
+        std::vector<double> rhs_;
+        DataStructure::PriorityQueue::IndexedDaryHeap<4, Key, std::greater<Key>> open_;
+
+        std::vector<double> known_weights_;  // Forward weights the current g/rhs are based on
+        std::uint64_t known_version_ = 0;
+
+        size_t last_expansions_ = 0;
+        size_t last_changed_edges_ = 0;
+        std::mutex mutex_;  // Serializes search()
+    };
+
+}
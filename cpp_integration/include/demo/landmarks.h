@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../graph_types.h"
+#include "../road_network.h"
+#include <cstddef>
+#include <vector>
+
+namespace Landmarks {
+
+    // Upper limit on landmarks per network; every heuristic call loops over all of them
+    constexpr size_t MAX_LANDMARKS = 64;
+
+    // Farthest-point selection: the first landmark is the node farthest from the centroid
+    // of the network, each next one maximizes the distance to its closest chosen landmark.
+    // Only nodes with at least one edge qualify. Distances are geographic (chord length on
+    // the unit sphere), which spreads landmarks around the periphery of the map without
+    // a Dijkstra run per pick. Returns fewer than count nodes on very small networks.
+    std::vector<NodeIndex> select_farthest(const RoadNetwork &network, size_t count);
+
+    // ALT preprocessing: selects count landmarks, computes d(L, v) and d(v, L) for every
+    // node with one forward and one reverse Dijkstra per landmark (2 * count independent
+    // runs spread over the ThreadPool, num_threads <= 0 = whole pool; with fewer runs than
+    // threads each run is a parallel DeltaStepping search instead), and attaches the
+    // tables to the network. From then on AStar::heuristic and the heuristics of all other
+    // search variants take the landmark bound into account, and save_binary() stores the
+    // tables. Distances use the base weights, which live traffic weights never undercut
+    // (see LiveWeights), so the bounds survive traffic updates. Throws
+    // std::invalid_argument unless 1 <= count <= MAX_LANDMARKS.
+    // NOT THREAD-SAFE with searches on the same network.
+    void preprocess(RoadNetwork &network, size_t count, int num_threads);
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../graph_types.h"
+#include "../road_network.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Reusable per-query search state indexed by dense NodeIndex.
+ *
+ * Holds flat g-score / parent / closed arrays sized to the network. Instead of
+ * clearing them between queries, every entry carries the epoch it was written in;
+ * reset() just bumps the epoch, so back-to-back queries only touch the nodes they
+ * actually visit.
+ *
+ * Not thread-safe. Use one context per thread (see for_thread()), or guard shared
+ * access externally as the neighbor-splitting parallel searches do.
+ */
+class SearchContext
+{
+public:
+    static constexpr double INF = std::numeric_limits<double>::max();
+
+    SearchContext() = default;
+
+    SearchContext(const SearchContext &) = delete;
+    SearchContext &operator=(const SearchContext &) = delete;
+
+    // Returns the calling thread's context, reset and sized for the given network.
+    static SearchContext &for_thread(const RoadNetwork &network)
+    {
+        thread_local SearchContext context;
+        context.reset(network.num_nodes());
+        return context;
+    }
+
+    // Starts a new query. O(1) unless the node count grew or the epoch wrapped.
+    void reset(size_t num_nodes)
+    {
+        if (entries_.size() < num_nodes)
+        {
+            entries_.resize(num_nodes);
+            closed_epoch_.resize(num_nodes, 0);
+        }
+        if (++epoch_ == 0)
+        {
+            // Epoch wrapped: stale stamps could alias the new epoch, so clear once
+            for (Entry &entry : entries_)
+                entry.epoch = 0;
+            std::fill(closed_epoch_.begin(), closed_epoch_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    // g-score of u, INF if u has not been reached in this query
+    double g(NodeIndex u) const { return entries_[u].epoch == epoch_ ? entries_[u].g : INF; }
+
+    // Parent of u on the current best path, INVALID_NODE_INDEX for the start/unreached nodes
+    NodeIndex parent(NodeIndex u) const
+    {
+        return entries_[u].epoch == epoch_ ? entries_[u].parent : INVALID_NODE_INDEX;
+    }
+
+    // Records a (better) path to u
+    void set(NodeIndex u, double g, NodeIndex parent) { entries_[u] = {g, parent, epoch_}; }
+
+    bool is_closed(NodeIndex u) const { return closed_epoch_[u] == epoch_; }
+
+    void close(NodeIndex u) { closed_epoch_[u] = epoch_; }
+
+    // Re-opens u after its g-score improved (only happens with inconsistent heuristics)
+    void reopen(NodeIndex u) { closed_epoch_[u] = 0; }
+
+    // Walks parent links back from goal and returns the path as OSM ids, start first
+    std::vector<long long> path_to(const RoadNetwork &network, NodeIndex goal) const
+    {
+        std::vector<long long> path;
+        for (NodeIndex u = goal; u != INVALID_NODE_INDEX; u = parent(u))
+            path.push_back(network.id_of(u));
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+private:
+    // g and parent are read together on every relaxation, so keep them on one line
+    struct Entry
+    {
+        double g = INF;
+        NodeIndex parent = INVALID_NODE_INDEX;
+        std::uint32_t epoch = 0;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<std::uint32_t> closed_epoch_;
+    std::uint32_t epoch_ = 0;
+};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * Per-query instrumentation of the A* engine (the Stats policy of astar_policies.h).
+ *
+ * Every engine function takes its Stats object by reference. NoStats has only empty
+ * inline members and ENABLED = false, so the plain entry points compile to exactly the
+ * code they had before; StatsRecorder counts with relaxed atomics (the parallel variants
+ * record from every worker) and reads the steady clock around phases, lock acquisitions
+ * and concurrent open-set calls. Recording perturbs the timings of the parallel variants
+ * somewhat; the counters are exact.
+ */
+namespace AStarEngine {
+
+    // Mutexes and synchronized structures whose waiting time is reported
+    enum class LockSite : unsigned {
+        OPEN_SET,             // Per-query lock of the std::priority_queue open set (CppLib variants)
+        MEETING_POINT,        // Best-meeting-point lock of bidirectional A*
+        CONCURRENT_OPEN_SET,  // Time inside push/pop of PqFine / MultiQueue (internal locks included)
+        COUNT
+    };
+
+    // Wall-clock phases of a query
+    enum class Phase : unsigned {
+        SETUP,           // Id lookup, weight pin, search-state reset
+        SEARCH,          // Main loop
+        PATH,            // Path reconstruction
+        PARALLEL_RELAX,  // Part of SEARCH spent in fork-join edge relaxation (fork-join variants)
+        COUNT
+    };
+
+    inline constexpr size_t NUM_LOCK_SITES = static_cast<size_t>(LockSite::COUNT);
+    inline constexpr size_t NUM_PHASES = static_cast<size_t>(Phase::COUNT);
+
+    // Counters and timings of one query
+    struct SearchStats {
+        std::uint64_t expanded = 0;       // Nodes whose edges were relaxed
+        std::uint64_t reopened = 0;       // Expanded nodes put back in the open set by a cheaper path
+        std::uint64_t pushes = 0;         // Open-set insertions (in-place key improvements not included)
+        std::uint64_t decrease_keys = 0;  // In-place key improvements of the indexed open sets
+        std::uint64_t pops = 0;           // Open-set removals, stale ones included
+        std::uint64_t stale_pops = 0;     // Pops skipped as outdated duplicates or pruned by a bound
+        std::uint64_t peak_open = 0;      // Largest number of open-set entries at once (all sides/workers)
+        std::uint64_t messages = 0;       // HDA*: successors sent to another worker's mailbox
+
+        std::uint64_t lock_acquisitions[NUM_LOCK_SITES] = {};
+        std::uint64_t lock_wait_ns[NUM_LOCK_SITES] = {};  // Time blocked acquiring (or inside, see LockSite)
+        std::uint64_t phase_ns[NUM_PHASES] = {};
+    };
+
+    // Stats policy that records nothing
+    struct NoStats {
+        static constexpr bool ENABLED = false;
+
+        void on_expand() {}
+        void on_reopen() {}
+        void on_push() {}
+        void on_decrease_key() {}
+        void on_pop() {}
+        void on_stale_pop() {}
+        void on_discard(size_t /*entries*/) {}
+        void on_message() {}
+
+        std::uint64_t start_timer() const { return 0; }
+        void add_time(Phase, std::uint64_t) {}
+        void add_time(LockSite, std::uint64_t) {}
+
+        std::unique_lock<std::mutex> lock(std::mutex &mutex, LockSite) { return std::unique_lock<std::mutex>(mutex); }
+    };
+
+    // Stats policy that records into atomic counters; result() reads them once the query returned
+    class StatsRecorder {
+    public:
+        static constexpr bool ENABLED = true;
+
+        void on_expand() { add(expanded_); }
+
+        void on_reopen() { add(reopened_); }
+
+        void on_push() {
+            add(pushes_);
+            // Signed: a worker may pop an entry before its pusher got here
+            const std::int64_t open = open_.fetch_add(1, std::memory_order_relaxed) + 1;
+            std::int64_t peak = peak_open_.load(std::memory_order_relaxed);
+            while (open > peak && !peak_open_.compare_exchange_weak(peak, open, std::memory_order_relaxed)) {
+            }
+        }
+
+        void on_decrease_key() { add(decrease_keys_); }
+
+        void on_pop() {
+            add(pops_);
+            open_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void on_stale_pop() { add(stale_pops_); }
+
+        // Entries dropped from an open set without being popped
+        void on_discard(size_t entries) {
+            open_.fetch_sub(static_cast<std::int64_t>(entries), std::memory_order_relaxed);
+        }
+
+        void on_message() { add(messages_); }
+
+        std::uint64_t start_timer() const {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count());
+        }
+
+        void add_time(Phase phase, std::uint64_t start) { add(phase_ns_[index(phase)], start_timer() - start); }
+
+        void add_time(LockSite site, std::uint64_t start) {
+            add(lock_acquisitions_[index(site)]);
+            add(lock_wait_ns_[index(site)], start_timer() - start);
+        }
+
+        // Locks mutex, timing the wait only when the lock is contended
+        std::unique_lock<std::mutex> lock(std::mutex &mutex, LockSite site) {
+            std::unique_lock<std::mutex> guard(mutex, std::try_to_lock);
+            if (guard.owns_lock()) {
+                add(lock_acquisitions_[index(site)]);
+            } else {
+                const std::uint64_t start = start_timer();
+                guard.lock();
+                add_time(site, start);
+            }
+            return guard;
+        }
+
+        SearchStats result() const {
+            SearchStats stats;
+            stats.expanded = read(expanded_);
+            stats.reopened = read(reopened_);
+            stats.pushes = read(pushes_);
+            stats.decrease_keys = read(decrease_keys_);
+            stats.pops = read(pops_);
+            stats.stale_pops = read(stale_pops_);
+            stats.peak_open = static_cast<std::uint64_t>(peak_open_.load(std::memory_order_relaxed));
+            stats.messages = read(messages_);
+            for (size_t i = 0; i < NUM_LOCK_SITES; ++i) {
+                stats.lock_acquisitions[i] = read(lock_acquisitions_[i]);
+                stats.lock_wait_ns[i] = read(lock_wait_ns_[i]);
+            }
+            for (size_t i = 0; i < NUM_PHASES; ++i) stats.phase_ns[i] = read(phase_ns_[i]);
+            return stats;
+        }
+
+    private:
+        using Counter = std::atomic<std::uint64_t>;
+
+        template <class E>
+        static constexpr size_t index(E value) { return static_cast<size_t>(value); }
+
+        static void add(Counter &counter, std::uint64_t amount = 1) { counter.fetch_add(amount, std::memory_order_relaxed); }
+
+        static std::uint64_t read(const Counter &counter) { return counter.load(std::memory_order_relaxed); }
+
+        Counter expanded_{0}, reopened_{0}, pushes_{0}, decrease_keys_{0}, pops_{0}, stale_pops_{0};
+        Counter messages_{0};
+        std::atomic<std::int64_t> open_{0}, peak_open_{0};
+        Counter lock_acquisitions_[NUM_LOCK_SITES] = {};
+        Counter lock_wait_ns_[NUM_LOCK_SITES] = {};
+        Counter phase_ns_[NUM_PHASES] = {};
+    };
+
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "graph_types.h"  // NodeIndex
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+
+// The batch kernel picks the widest instruction set the translation unit is compiled for
+// (see ENABLE_NATIVE_ARCH in CMakeLists.txt); every path computes the same bound as the
+// scalar code below, lane by lane.
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Geographic lower bound used by the A* heuristics
+enum class GeoBound : std::uint8_t
+{
+    Haversine,        // Great-circle distance (two sin, one asin per call)
+    Equirectangular,  // Flat-earth bound without trigonometry, slightly looser
+};
+
+/**
+ * @brief Read-only view of node coordinates prepared for heuristic evaluation.
+ *
+ * Latitudes and longitudes are stored in radians next to cos(latitude), as SoA arrays
+ * indexed by NodeIndex, so a heuristic call does no degree conversion and evaluates no
+ * cosines. All distances are in kilometers on a sphere of EARTH_RADIUS_KM.
+ *
+ * Both bounds are admissible, i.e. never above the great-circle distance:
+ *   - Haversine is the great-circle distance itself.
+ *   - Equirectangular is sqrt(y^2 + cos(lat1) cos(lat2) x^2) with the latitude and
+ *     longitude differences y, x shrunk by the factor (1 - d^2 / 24). The usual
+ *     equirectangular formula overestimates paths that bulge towards a pole; the factor
+ *     turns it into a lower bound of the haversine (sin(d/2) >= d/2 (1 - d^2 / 24) and
+ *     asin(s) >= s). At road-network scale it is within 1e-5 of the exact distance.
+ *
+ * The arrays belong to the RoadNetwork (owned or memory-mapped), like LandmarkTable.
+ */
+struct GeoCoordinates
+{
+    static constexpr double EARTH_RADIUS_KM = 6371.0;
+
+    GeoBound bound = GeoBound::Haversine;
+    std::span<const double> lat_rad;  // Latitude of each node, radians
+    std::span<const double> lon_rad;  // Longitude of each node, radians
+    std::span<const double> cos_lat;  // cos(lat_rad[u])
+
+    static double haversine_km(double lat1, double lon1, double cos1, double lat2, double lon2,
+                               double cos2)
+    {
+        const double sin_dlat = std::sin((lat2 - lat1) * 0.5);
+        const double sin_dlon = std::sin((lon2 - lon1) * 0.5);
+        const double a = sin_dlat * sin_dlat + cos1 * cos2 * sin_dlon * sin_dlon;
+        return 2.0 * EARTH_RADIUS_KM * std::asin(std::min(1.0, std::sqrt(a)));
+    }
+
+    static double equirectangular_km(double lat1, double lon1, double cos1, double lat2,
+                                     double lon2, double cos2)
+    {
+        const double dlat = lat2 - lat1;
+        double dlon = std::abs(lon2 - lon1);
+        dlon = std::min(dlon, 2.0 * std::numbers::pi - dlon);  // Shorter way round
+        const double y = dlat * (1.0 - dlat * dlat * (1.0 / 24.0));
+        const double x = dlon * (1.0 - dlon * dlon * (1.0 / 24.0));
+        return EARTH_RADIUS_KM * std::sqrt(y * y + cos1 * cos2 * x * x);
+    }
+
+    // Lower bound on the distance from a to b
+    double distance_km(NodeIndex a, NodeIndex b) const
+    {
+        return bound == GeoBound::Haversine
+                   ? haversine_km(lat_rad[a], lon_rad[a], cos_lat[a], lat_rad[b], lon_rad[b], cos_lat[b])
+                   : equirectangular_km(lat_rad[a], lon_rad[a], cos_lat[a], lat_rad[b], lon_rad[b],
+                                        cos_lat[b]);
+    }
+
+    // out[i] = distance_km(nodes[i], goal) for a whole block of nodes (e.g. the successors
+    // of an expanded node). The equirectangular bound runs 8/4/2 lanes at a time with
+    // AVX-512/AVX2/NEON; trigonometry has no portable vector form, so haversine is scalar.
+    void distances_km(const NodeIndex *nodes, size_t count, NodeIndex goal, double *out) const
+    {
+        if (bound == GeoBound::Haversine)
+        {
+            const double lat_g = lat_rad[goal], lon_g = lon_rad[goal], cos_g = cos_lat[goal];
+            for (size_t i = 0; i < count; ++i)
+            {
+                const NodeIndex u = nodes[i];
+                out[i] = haversine_km(lat_rad[u], lon_rad[u], cos_lat[u], lat_g, lon_g, cos_g);
+            }
+            return;
+        }
+        const size_t done = equirectangular_simd(nodes, count, goal, out);
+        const double lat_g = lat_rad[goal], lon_g = lon_rad[goal], cos_g = cos_lat[goal];
+        for (size_t i = done; i < count; ++i)
+        {
+            const NodeIndex u = nodes[i];
+            out[i] = equirectangular_km(lat_rad[u], lon_rad[u], cos_lat[u], lat_g, lon_g, cos_g);
+        }
+    }
+
+private:
+    // Vector part of distances_km() for the equirectangular bound; returns how many leading
+    // entries it filled, the caller finishes the rest with the scalar formula. Gathers use
+    // signed 32-bit indices, which cover any network that fits in memory (< 2^31 nodes).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+// GCC's intrinsic headers start gathers/min/sqrt from an "undefined" register
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    size_t equirectangular_simd(const NodeIndex *nodes, size_t count, NodeIndex goal,
+                                double *out) const
+    {
+        size_t i = 0;
+#if defined(__AVX512F__)
+        const __m512d lat_g = _mm512_set1_pd(lat_rad[goal]);
+        const __m512d lon_g = _mm512_set1_pd(lon_rad[goal]);
+        const __m512d cos_g = _mm512_set1_pd(cos_lat[goal]);
+        const __m512d one = _mm512_set1_pd(1.0);
+        const __m512d inv24 = _mm512_set1_pd(1.0 / 24.0);
+        const __m512d two_pi = _mm512_set1_pd(2.0 * std::numbers::pi);
+        const __m512d radius = _mm512_set1_pd(EARTH_RADIUS_KM);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(nodes + i));
+            const __m512d lat = _mm512_i32gather_pd(idx, lat_rad.data(), 8);
+            const __m512d lon = _mm512_i32gather_pd(idx, lon_rad.data(), 8);
+            const __m512d cos_u = _mm512_i32gather_pd(idx, cos_lat.data(), 8);
+
+            const __m512d dlat = _mm512_sub_pd(lat_g, lat);
+            __m512d dlon = _mm512_abs_pd(_mm512_sub_pd(lon_g, lon));
+            dlon = _mm512_min_pd(dlon, _mm512_sub_pd(two_pi, dlon));
+            const __m512d y = _mm512_mul_pd(dlat, _mm512_sub_pd(one, _mm512_mul_pd(_mm512_mul_pd(dlat, dlat), inv24)));
+            const __m512d x = _mm512_mul_pd(dlon, _mm512_sub_pd(one, _mm512_mul_pd(_mm512_mul_pd(dlon, dlon), inv24)));
+            const __m512d sum = _mm512_add_pd(_mm512_mul_pd(y, y),
+                                              _mm512_mul_pd(_mm512_mul_pd(cos_u, cos_g), _mm512_mul_pd(x, x)));
+            _mm512_storeu_pd(out + i, _mm512_mul_pd(radius, _mm512_sqrt_pd(sum)));
+        }
+#elif defined(__AVX2__)
+        const __m256d lat_g = _mm256_set1_pd(lat_rad[goal]);
+        const __m256d lon_g = _mm256_set1_pd(lon_rad[goal]);
+        const __m256d cos_g = _mm256_set1_pd(cos_lat[goal]);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d inv24 = _mm256_set1_pd(1.0 / 24.0);
+        const __m256d two_pi = _mm256_set1_pd(2.0 * std::numbers::pi);
+        const __m256d radius = _mm256_set1_pd(EARTH_RADIUS_KM);
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i *>(nodes + i));
+            const __m256d lat = _mm256_i32gather_pd(lat_rad.data(), idx, 8);
+            const __m256d lon = _mm256_i32gather_pd(lon_rad.data(), idx, 8);
+            const __m256d cos_u = _mm256_i32gather_pd(cos_lat.data(), idx, 8);
+
+            const __m256d dlat = _mm256_sub_pd(lat_g, lat);
+            __m256d dlon = _mm256_andnot_pd(sign, _mm256_sub_pd(lon_g, lon));  // |dlon|
+            dlon = _mm256_min_pd(dlon, _mm256_sub_pd(two_pi, dlon));
+            const __m256d y = _mm256_mul_pd(dlat, _mm256_sub_pd(one, _mm256_mul_pd(_mm256_mul_pd(dlat, dlat), inv24)));
+            const __m256d x = _mm256_mul_pd(dlon, _mm256_sub_pd(one, _mm256_mul_pd(_mm256_mul_pd(dlon, dlon), inv24)));
+            const __m256d sum = _mm256_add_pd(_mm256_mul_pd(y, y),
+                                              _mm256_mul_pd(_mm256_mul_pd(cos_u, cos_g), _mm256_mul_pd(x, x)));
+            _mm256_storeu_pd(out + i, _mm256_mul_pd(radius, _mm256_sqrt_pd(sum)));
+        }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+        const float64x2_t lat_g = vdupq_n_f64(lat_rad[goal]);
+        const float64x2_t lon_g = vdupq_n_f64(lon_rad[goal]);
+        const float64x2_t cos_g = vdupq_n_f64(cos_lat[goal]);
+        const float64x2_t one = vdupq_n_f64(1.0);
+        const float64x2_t inv24 = vdupq_n_f64(1.0 / 24.0);
+        const float64x2_t two_pi = vdupq_n_f64(2.0 * std::numbers::pi);
+        const float64x2_t radius = vdupq_n_f64(EARTH_RADIUS_KM);
+        for (; i + 2 <= count; i += 2)
+        {
+            // No gather instruction: load the two lanes of each array separately
+            const NodeIndex u = nodes[i], v = nodes[i + 1];
+            const float64x2_t lat = vsetq_lane_f64(lat_rad[v], vdupq_n_f64(lat_rad[u]), 1);
+            const float64x2_t lon = vsetq_lane_f64(lon_rad[v], vdupq_n_f64(lon_rad[u]), 1);
+            const float64x2_t cos_u = vsetq_lane_f64(cos_lat[v], vdupq_n_f64(cos_lat[u]), 1);
+
+            const float64x2_t dlat = vsubq_f64(lat_g, lat);
+            float64x2_t dlon = vabdq_f64(lon_g, lon);  // |dlon|
+            dlon = vminq_f64(dlon, vsubq_f64(two_pi, dlon));
+            const float64x2_t y = vmulq_f64(dlat, vsubq_f64(one, vmulq_f64(vmulq_f64(dlat, dlat), inv24)));
+            const float64x2_t x = vmulq_f64(dlon, vsubq_f64(one, vmulq_f64(vmulq_f64(dlon, dlon), inv24)));
+            const float64x2_t sum = vaddq_f64(vmulq_f64(y, y), vmulq_f64(vmulq_f64(cos_u, cos_g), vmulq_f64(x, x)));
+            vst1q_f64(out + i, vmulq_f64(radius, vsqrtq_f64(sum)));
+        }
+#else
+        (void)nodes;
+        (void)count;
+        (void)goal;
+        (void)out;
+#endif
+        return i;
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+};
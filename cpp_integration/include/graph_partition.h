@@ -0,0 +1,208 @@
+#pragma once
+
+#include "graph_types.h"  // NodeIndex, EdgeIndex
+#include "node_order.h"   // Hilbert order inside a part
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Contiguous node ranges (parts) of a RoadNetwork and the NUMA domain of each.
+ *
+ * After RoadNetwork::partitioned() the nodes of part p are the dense indices
+ * [part_begin[p], part_begin[p + 1]). Consecutive parts share a domain, so the nodes of
+ * domain d are one range too, [domain_begin[d], domain_begin[d + 1]), which is what
+ * memory placement and work routing go by. An unpartitioned network is one part in one
+ * domain.
+ */
+struct GraphPartition
+{
+    std::vector<NodeIndex> part_begin;    // num_parts + 1 boundaries
+    std::vector<NodeIndex> domain_begin;  // num_domains + 1 boundaries, a subset of part_begin
+
+    size_t num_parts() const { return part_begin.empty() ? 0 : part_begin.size() - 1; }
+
+    size_t num_domains() const { return domain_begin.empty() ? 0 : domain_begin.size() - 1; }
+
+    size_t part_of(NodeIndex u) const
+    {
+        return static_cast<size_t>(std::upper_bound(part_begin.begin() + 1, part_begin.end() - 1, u)
+                                   - (part_begin.begin() + 1));
+    }
+
+    // A handful of domains: a linear scan beats the binary search
+    size_t domain_of(NodeIndex u) const
+    {
+        size_t d = 0;
+        while (d + 2 < domain_begin.size() && u >= domain_begin[d + 1])
+            ++d;
+        return d;
+    }
+};
+
+/**
+ * @brief Balance and cut of a GraphPartition, to tune the number of parts.
+ *
+ * A cut edge runs between two parts; a cross-domain edge between two domains, i.e. a
+ * relaxation that reads the other socket's memory.
+ */
+struct PartitionQuality
+{
+    std::vector<size_t> part_nodes;
+    std::vector<size_t> part_edges;      // Outgoing edges of the part's nodes
+    std::vector<size_t> part_cut_edges;  // Of those, the ones leaving the part
+    size_t cut_edges = 0;
+    size_t cross_domain_edges = 0;
+    double cut_fraction = 0.0;    // cut_edges / all edges
+    double node_imbalance = 1.0;  // Largest part / mean part, in nodes
+    double edge_imbalance = 1.0;  // Same in outgoing edges
+};
+
+/**
+ * @brief Geometric partitioning by recursive coordinate bisection.
+ *
+ * Road networks are nearly planar and their edges short, so cutting the plane cuts few
+ * edges: the nodes are split at the (weighted) median of the longer side of their
+ * bounding box, measured in kilometers, and each half is cut again, until there are
+ * num_parts parts. For a num_parts that is not a power of two a cut divides the nodes in
+ * the ratio of the parts on either side, so the parts are equal to within one node.
+ * Inside each part the nodes keep a Hilbert order (as NodeOrder::Hilbert over the whole
+ * network), so the layout is still cache-friendly within a part. Ties break on the node
+ * index, so the result is deterministic.
+ */
+namespace GraphPartitioning
+{
+
+struct PartitionOrder
+{
+    std::vector<NodeIndex> order;       // order[new index] = current index
+    std::vector<NodeIndex> part_begin;  // num_parts + 1 boundaries in the new indices
+};
+
+inline PartitionOrder bisection_order(std::span<const double> lats, std::span<const double> lons,
+                                      std::span<const long long> node_ids, size_t num_parts)
+{
+    if (num_parts == 0)
+        throw std::invalid_argument("GraphPartitioning: num_parts must be positive.");
+    const size_t n = lats.size();
+    num_parts = std::min(num_parts, std::max<size_t>(n, 1));
+
+    // Bisection coordinates in km; longitude shrinks by cos(latitude) around the mean
+    constexpr double DEG_TO_RAD = std::numbers::pi / 180.0;
+    const double mean_lat = n == 0 ? 0.0 : std::accumulate(lats.begin(), lats.end(), 0.0) / n;
+    const double lon_scale = std::cos(mean_lat * DEG_TO_RAD);
+
+    PartitionOrder result;
+    result.order.resize(n);
+    std::iota(result.order.begin(), result.order.end(), NodeIndex(0));
+    result.part_begin.assign(num_parts + 1, 0);
+    result.part_begin[num_parts] = static_cast<NodeIndex>(n);
+
+    // Explicit stack of (first node, end node, first part, number of parts)
+    struct Range
+    {
+        size_t begin, end, part, parts;
+    };
+    std::vector<Range> stack = {{0, n, 0, num_parts}};
+    while (!stack.empty())
+    {
+        const Range range = stack.back();
+        stack.pop_back();
+        result.part_begin[range.part] = static_cast<NodeIndex>(range.begin);
+        if (range.parts == 1)
+            continue;
+
+        auto first = result.order.begin() + range.begin, last = result.order.begin() + range.end;
+        double min_lat = 90.0, max_lat = -90.0, min_lon = 180.0, max_lon = -180.0;
+        for (auto it = first; it != last; ++it)
+        {
+            min_lat = std::min(min_lat, lats[*it]);
+            max_lat = std::max(max_lat, lats[*it]);
+            min_lon = std::min(min_lon, lons[*it]);
+            max_lon = std::max(max_lon, lons[*it]);
+        }
+        const bool by_lat = (max_lat - min_lat) >= (max_lon - min_lon) * lon_scale;
+        std::span<const double> axis = by_lat ? lats : lons;
+
+        const size_t left_parts = range.parts / 2;
+        const size_t middle = range.begin + (range.end - range.begin) * left_parts / range.parts;
+        std::nth_element(first, result.order.begin() + middle, last,
+                         [&](NodeIndex a, NodeIndex b) { return axis[a] < axis[b] || (axis[a] == axis[b] && a < b); });
+        stack.push_back({middle, range.end, range.part + left_parts, range.parts - left_parts});
+        stack.push_back({range.begin, middle, range.part, left_parts});
+    }
+
+    // Hilbert order within each part
+    const std::vector<NodeIndex> hilbert_rank = NodeOrdering::inverse(NodeOrdering::hilbert_order(lats, lons, node_ids));
+    for (size_t p = 0; p < num_parts; ++p)
+        std::sort(result.order.begin() + result.part_begin[p], result.order.begin() + result.part_begin[p + 1],
+                  [&](NodeIndex a, NodeIndex b) { return hilbert_rank[a] < hilbert_rank[b]; });
+    return result;
+}
+
+// Spreads num_parts consecutive parts over num_domains domains, part p going to
+// p * num_domains / num_parts, and returns the resulting partition
+inline GraphPartition assign_domains(std::vector<NodeIndex> part_begin, size_t num_domains)
+{
+    GraphPartition partition;
+    partition.part_begin = std::move(part_begin);
+    const size_t parts = partition.num_parts();
+    num_domains = std::clamp<size_t>(num_domains, 1, std::max<size_t>(parts, 1));
+    partition.domain_begin.resize(num_domains + 1);
+    for (size_t d = 0; d <= num_domains; ++d)
+        partition.domain_begin[d] = partition.part_begin[(d * parts + num_domains - 1) / num_domains];
+    return partition;
+}
+
+// Node / edge balance and cut edges of partition over the forward CSR
+inline PartitionQuality evaluate(std::span<const EdgeIndex> offsets, std::span<const NodeIndex> targets,
+                                 const GraphPartition &partition)
+{
+    PartitionQuality quality;
+    const size_t parts = partition.num_parts();
+    quality.part_nodes.assign(parts, 0);
+    quality.part_edges.assign(parts, 0);
+    quality.part_cut_edges.assign(parts, 0);
+    for (size_t p = 0; p < parts; ++p)
+    {
+        const NodeIndex begin = partition.part_begin[p], end = partition.part_begin[p + 1];
+        quality.part_nodes[p] = end - begin;
+        quality.part_edges[p] = offsets[end] - offsets[begin];
+        for (NodeIndex u = begin; u < end; ++u)
+        {
+            const size_t domain = partition.domain_of(u);
+            for (EdgeIndex e = offsets[u]; e < offsets[u + 1]; ++e)
+            {
+                const NodeIndex v = targets[e];
+                if (v < begin || v >= end)
+                {
+                    quality.part_cut_edges[p]++;
+                    if (partition.domain_of(v) != domain)
+                        quality.cross_domain_edges++;
+                }
+            }
+        }
+        quality.cut_edges += quality.part_cut_edges[p];
+    }
+
+    auto imbalance = [parts](const std::vector<size_t> &sizes)
+    {
+        const double total = std::accumulate(sizes.begin(), sizes.end(), 0.0);
+        return total > 0.0 ? *std::max_element(sizes.begin(), sizes.end()) * parts / total : 1.0;
+    };
+    if (parts > 0)
+    {
+        quality.node_imbalance = imbalance(quality.part_nodes);
+        quality.edge_imbalance = imbalance(quality.part_edges);
+    }
+    quality.cut_fraction = targets.empty() ? 0.0 : static_cast<double>(quality.cut_edges) / targets.size();
+    return quality;
+}
+
+}  // namespace GraphPartitioning
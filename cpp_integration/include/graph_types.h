@@ -1,8 +1,36 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
+// Dense internal node index used by the CSR layout in RoadNetwork.
+// OSM ids (long long) only appear at the API boundary.
+using NodeIndex = std::uint32_t;
+
+// Index of an edge in the CSR targets/weights arrays
+using EdgeIndex = std::uint32_t;
+
+// Marker for "no such node" (unknown id, no parent, ...)
+inline constexpr NodeIndex INVALID_NODE_INDEX = std::numeric_limits<NodeIndex>::max();
+
+// Number of criteria of a multi-objective cost (CostVector entries)
+inline constexpr std::size_t NUM_CRITERIA = 3;
+
+// Position of each criterion in a CostVector
+namespace CostCriterion
+{
+inline constexpr std::size_t DISTANCE = 0;
+inline constexpr std::size_t TIME = 1;
+inline constexpr std::size_t TOLL = 2;
+}  // namespace CostCriterion
+
+// Cost of an edge or path under every criterion (see AStarEnhancementVectorFunction)
+using CostVector = std::array<double, NUM_CRITERIA>;
+
 // Represents a node in the graph, potentially with coordinates
 struct Node
 {
@@ -22,16 +50,25 @@ struct Node
 struct Edge
 {
     long long target_node_id;
-    double weight;  // Cost to traverse the edge (e.g., distance, time)
+    double weight;     // Cost to traverse the edge (e.g., distance, time)
+    CostVector costs;  // Multi-objective cost; {weight, 0, 0} unless given
 
     // Add a default constructor for convenience if needed by containers
-    Edge() : target_node_id(0), weight(0.0) { }
+    Edge() : target_node_id(0), weight(0.0), costs{} { }
+
+    Edge(long long target_id, double w) : target_node_id(target_id), weight(w), costs{w, 0.0, 0.0} { }
+
+    Edge(long long target_id, double w, const CostVector &c) : target_node_id(target_id), weight(w), costs(c)
+    {
+    }
 
-    Edge(long long target_id, double w) : target_node_id(target_id), weight(w) { }
+    // True if costs carries more than the scalar weight
+    bool has_cost_vector() const { return costs != CostVector{weight, 0.0, 0.0}; }
 };
 
-// Graph representation using an adjacency list: Node ID -> Vector of outgoing Edges
+// Adjacency list keyed by Node ID -> Vector of outgoing Edges.
+// Only used as build input; RoadNetwork freezes it into a CSR layout.
 using Graph = std::unordered_map<long long, std::vector<Edge>>;
 
-// Map from Node ID -> Node details (including coordinates)
+// Map from Node ID -> Node details (including coordinates). Build input only.
 using NodeMap = std::unordered_map<long long, Node>;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "graph_types.h"  // NodeIndex
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+/**
+ * @brief Read-only view of ALT (A*, Landmarks, Triangle inequality) distance tables.
+ *
+ * For every landmark L the tables hold d(L, v) ("from") and d(v, L) ("to") for all
+ * nodes v, in edge-weight units. Both are node-major float arrays: the count distances
+ * of node v are contiguous at [v * count, (v + 1) * count), so one heuristic call reads
+ * a cache line or two per endpoint instead of one per landmark.
+ *
+ * The triangle inequality gives, for each landmark, two lower bounds on d(u, t):
+ *     d(L, t) - d(L, u)   and   d(u, L) - d(t, L)
+ * and lower_bound() returns the largest of them. Unreachable (infinite) entries are
+ * skipped. The arrays belong to the RoadNetwork (owned or memory-mapped), see
+ * Landmarks::preprocess() for how they are built.
+ */
+struct LandmarkTable
+{
+    size_t count = 0;                       // Number of landmarks, 0 = no tables
+    std::span<const NodeIndex> landmarks;   // Dense index of each landmark
+    std::span<const float> from;            // from[v * count + i] = d(landmarks[i], v)
+    std::span<const float> to;              // to[v * count + i] = d(v, landmarks[i])
+
+    bool empty() const { return count == 0; }
+
+    // Admissible lower bound on the shortest-path cost from u to t (0 without tables)
+    double lower_bound(NodeIndex u, NodeIndex t) const
+    {
+        // Entries are rounded to nearest, so each operand may be off by half an ulp. The
+        // slack of one float epsilon per operand keeps the bound admissible.
+        constexpr double SLACK = std::numeric_limits<float>::epsilon();
+        const float *from_u = from.data() + static_cast<size_t>(u) * count;
+        const float *from_t = from.data() + static_cast<size_t>(t) * count;
+        const float *to_u = to.data() + static_cast<size_t>(u) * count;
+        const float *to_t = to.data() + static_cast<size_t>(t) * count;
+
+        double best = 0.0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const double forward = from_t[i] - static_cast<double>(from_u[i]);
+            if (std::isfinite(forward))
+                best = std::max(best, forward - SLACK * (from_t[i] + static_cast<double>(from_u[i])));
+            const double backward = to_u[i] - static_cast<double>(to_t[i]);
+            if (std::isfinite(backward))
+                best = std::max(best, backward - SLACK * (to_u[i] + static_cast<double>(to_t[i])));
+        }
+        return best;
+    }
+};
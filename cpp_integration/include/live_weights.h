@@ -0,0 +1,302 @@
+#pragma once
+
+#include "data_structure/epoch_reclamation.h"  // Grace periods for retired weight sets
+#include "graph_types.h"                       // EdgeIndex, NodeIndex
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>  // For std::move
+#include <vector>
+
+// Index of a TrafficProfiles entry; edges store one each (2 bytes per edge)
+using ProfileId = std::uint16_t;
+
+/**
+ * @brief Time-dependent travel-time factors shared between edges.
+ *
+ * A profile is a periodic piecewise-linear function of the time of day: breakpoints
+ * (time_s, factor) sorted by time within [0, PERIOD_S), interpolated linearly and wrapped
+ * around midnight. An edge's weight at time t is its base weight times the factor of its
+ * profile. Profiles are stored once, CSR-style (breakpoint offsets per profile), and
+ * edges refer to them by ProfileId, so a city with a few hundred road-class/area profiles
+ * costs 2 bytes per edge plus the breakpoints.
+ *
+ * Profile FLAT (id 0) has no breakpoints and a factor of 1 at all times.
+ */
+class TrafficProfiles
+{
+public:
+    static constexpr double PERIOD_S = 86400.0;  // One day
+    static constexpr ProfileId FLAT = 0;
+
+    struct Breakpoint
+    {
+        float time_s;  // Seconds since midnight
+        float factor;  // Multiplier of the base weight
+    };
+
+    // Appends a profile and returns its id. Breakpoints must be non-empty, strictly
+    // increasing in time within [0, PERIOD_S), with finite positive factors.
+    ProfileId add(std::span<const Breakpoint> breakpoints)
+    {
+        if (size() > std::numeric_limits<ProfileId>::max())
+            throw std::length_error("TrafficProfiles: too many profiles.");
+        if (breakpoints.empty())
+            throw std::invalid_argument("TrafficProfiles: a profile needs at least one breakpoint.");
+        for (size_t i = 0; i < breakpoints.size(); ++i)
+        {
+            const Breakpoint &point = breakpoints[i];
+            if (!(point.time_s >= 0.0f && point.time_s < PERIOD_S) || !(point.factor > 0.0f)
+                || !std::isfinite(point.factor) || (i > 0 && point.time_s <= breakpoints[i - 1].time_s))
+                throw std::invalid_argument(
+                    "TrafficProfiles: breakpoints must be increasing times in [0, 86400) with positive factors.");
+        }
+        points_.insert(points_.end(), breakpoints.begin(), breakpoints.end());
+        offsets_.push_back(static_cast<std::uint32_t>(points_.size()));
+        return static_cast<ProfileId>(offsets_.size() - 2);
+    }
+
+    // Number of profiles, FLAT included
+    size_t size() const { return offsets_.size() - 1; }
+
+    // Factor of profile p at time_s (any real time; wrapped into the period)
+    double factor(ProfileId p, double time_s) const
+    {
+        const Breakpoint *first = points_.data() + offsets_[p];
+        const Breakpoint *last = points_.data() + offsets_[p + 1];
+        if (first == last)
+            return 1.0;
+        if (last - first == 1)
+            return first->factor;
+
+        double t = std::fmod(time_s, PERIOD_S);
+        if (t < 0.0)
+            t += PERIOD_S;
+
+        // Segment [before, after] around t; past the last breakpoint it wraps to the first
+        const Breakpoint *next = std::upper_bound(first, last, t, [](double value, const Breakpoint &point)
+                                                  { return value < point.time_s; });
+        const Breakpoint &before = next == first ? *(last - 1) : *(next - 1);
+        const Breakpoint &after = next == last ? *first : *next;
+        double t_before = before.time_s, t_after = after.time_s;
+        if (next == first)
+            t_before -= PERIOD_S;
+        if (next == last)
+            t_after += PERIOD_S;
+        const double alpha = (t - t_before) / (t_after - t_before);
+        return before.factor + alpha * (after.factor - before.factor);
+    }
+
+private:
+    std::vector<std::uint32_t> offsets_{0, 0};  // Breakpoints of profile p: [offsets_[p], offsets_[p + 1])
+    std::vector<Breakpoint> points_;
+};
+
+// One published version of the edge weights (immutable once published)
+struct WeightSet
+{
+    std::uint64_t version = 0;
+    std::span<const double> forward;  // Indexed like RoadNetwork::edge_weight
+    std::span<const double> reverse;  // Indexed like RoadNetwork::rev_edge_weight
+
+    // Backing memory of forward/reverse; empty for version 0, which views the base weights
+    std::vector<double> owned_forward;
+    std::vector<double> owned_reverse;
+};
+
+/**
+ * @brief The weight version one search reads from, pinned for the lifetime of the object.
+ *
+ * Construction pins the calling thread in the EpochDomain, then loads the current
+ * WeightSet: the set cannot be freed while the snapshot exists, however many updates are
+ * published meanwhile. Worker threads of a fork-join search may read through the
+ * snapshot of the thread that created it. Not copyable or movable (the pin belongs to the
+ * creating thread); create it on the stack at the start of a query.
+ */
+class WeightSnapshot
+{
+public:
+    explicit WeightSnapshot(const std::atomic<const WeightSet *> &current)
+        : set_(current.load(std::memory_order_acquire)), forward_(set_->forward.data()),
+          reverse_(set_->reverse.data())
+    {
+    }
+
+    WeightSnapshot(const WeightSnapshot &) = delete;
+    WeightSnapshot &operator=(const WeightSnapshot &) = delete;
+
+    double forward(EdgeIndex e) const { return forward_[e]; }
+
+    double reverse(EdgeIndex e) const { return reverse_[e]; }
+
+    // 0 for the base weights, +1 per published update
+    std::uint64_t version() const { return set_->version; }
+
+private:
+    DataStructure::EpochDomain::Guard guard_;  // Declared first: pinned before the load
+    const WeightSet *set_;
+    const double *forward_;
+    const double *reverse_;
+};
+
+/**
+ * @brief Read-copy-update publication of live and time-dependent edge weights.
+ *
+ * Readers (searches) never lock: they pin the current WeightSet with a WeightSnapshot.
+ * Writers build the next set off to the side, from the base weights, the traffic
+ * profiles at the current traffic time and the live overrides, swap it in with one
+ * atomic exchange and retire the previous set to the EpochDomain, which frees it once no
+ * snapshot can still reach it. Writers are serialized by a mutex. With no search in
+ * flight the previous set is freed right away; otherwise it lives until the last search
+ * that pinned it returns.
+ *
+ * Base weights are taken to be free-flow costs: profile factors below 1 and overrides
+ * below the base weight are clamped to the base weight. Live weights therefore never drop
+ * below the weights the heuristics' lower bounds (geographic, ALT landmarks) were checked
+ * or built against, and every heuristic stays admissible and consistent.
+ */
+class LiveWeights
+{
+public:
+    // Views the base arrays and CSR structure of a RoadNetwork (owned or mapped); they
+    // must outlive this object.
+    LiveWeights(std::span<const double> base, std::span<const double> rev_base,
+                std::span<const EdgeIndex> offsets, std::span<const NodeIndex> targets,
+                std::span<const EdgeIndex> rev_offsets)
+        : base_(base), offsets_(offsets), targets_(targets), rev_offsets_(rev_offsets)
+    {
+        WeightSet *initial = new WeightSet;
+        initial->forward = base;
+        initial->reverse = rev_base;
+        current_.store(initial, std::memory_order_release);
+    }
+
+    LiveWeights(const LiveWeights &) = delete;
+    LiveWeights &operator=(const LiveWeights &) = delete;
+
+    // No search may be running: the current set is freed directly
+    ~LiveWeights() { delete current_.load(std::memory_order_acquire); }
+
+    WeightSnapshot pin() const { return WeightSnapshot(current_); }
+
+    std::uint64_t version() const { return current_.load(std::memory_order_acquire)->version; }
+
+    // Attaches time-dependent profiles: edge_profiles[e] is the profile of forward edge e.
+    // Publishes the weights of the current traffic time.
+    void set_profiles(TrafficProfiles profiles, std::vector<ProfileId> edge_profiles)
+    {
+        if (edge_profiles.size() != base_.size())
+            throw std::invalid_argument("LiveWeights: edge_profiles must hold one profile per edge.");
+        for (ProfileId p : edge_profiles)
+            if (p >= profiles.size())
+                throw std::invalid_argument("LiveWeights: edge profile id out of range.");
+        std::lock_guard<std::mutex> lock(mutex_);
+        profiles_ = std::move(profiles);
+        edge_profiles_ = std::move(edge_profiles);
+        publish();
+    }
+
+    // Re-evaluates the profiles at time_s (seconds; wrapped into the day) and publishes
+    void set_time(double time_s)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        time_s_ = time_s;
+        publish();
+    }
+
+    // Applies a batch of live weights (forward edge indices, absolute weights) and
+    // publishes once for the whole batch. Overrides take precedence over the profiles and
+    // persist until cleared. A weight of +infinity closes the edge: no search crosses it.
+    void update(std::span<const EdgeIndex> edges, std::span<const double> weights)
+    {
+        if (edges.size() != weights.size())
+            throw std::invalid_argument("LiveWeights: edges and weights must have equal length.");
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            if (edges[i] >= base_.size())
+                throw std::invalid_argument("LiveWeights: edge index out of range.");
+            if (!(weights[i] >= 0.0))
+                throw std::invalid_argument("LiveWeights: weights must be non-negative.");
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < edges.size(); ++i)
+            overrides_[edges[i]] = weights[i];
+        publish();
+    }
+
+    // Drops every live override (profiles stay) and publishes
+    void clear_updates()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        overrides_.clear();
+        publish();
+    }
+
+private:
+    // Builds and swaps in the next WeightSet. Caller holds mutex_.
+    void publish()
+    {
+        const size_t m = base_.size();
+        if (reverse_slot_.size() != m)
+            build_reverse_slots();
+
+        auto next = std::make_unique<WeightSet>();
+        next->version = current_.load(std::memory_order_relaxed)->version + 1;
+        next->owned_forward.resize(m);
+        next->owned_reverse.resize(m);
+        for (size_t e = 0; e < m; ++e)
+        {
+            double factor = edge_profiles_.empty() ? 1.0 : profiles_.factor(edge_profiles_[e], time_s_);
+            next->owned_forward[e] = base_[e] * std::max(1.0, factor);
+        }
+        for (const auto &[e, weight] : overrides_)
+            next->owned_forward[e] = std::max(base_[e], weight);
+        for (size_t e = 0; e < m; ++e)
+            next->owned_reverse[reverse_slot_[e]] = next->owned_forward[e];
+        next->forward = next->owned_forward;
+        next->reverse = next->owned_reverse;
+
+        const WeightSet *previous = current_.exchange(next.release(), std::memory_order_acq_rel);
+        DataStructure::EpochDomain &domain = DataStructure::EpochDomain::instance();
+        domain.retire(const_cast<WeightSet *>(previous),
+                      [](void *set) { delete static_cast<WeightSet *>(set); });
+        // Two epoch advances end the grace period when no search is pinned
+        domain.collect();
+        domain.collect();
+    }
+
+    // Forward edge -> reverse CSR slot, in the order RoadNetwork::build_reverse assigns
+    // them (incoming edges by ascending source, then forward edge order)
+    void build_reverse_slots()
+    {
+        const size_t n = offsets_.size() - 1;
+        reverse_slot_.resize(base_.size());
+        std::vector<EdgeIndex> cursor(rev_offsets_.begin(), rev_offsets_.end() - 1);
+        for (NodeIndex u = 0; u < n; ++u)
+            for (EdgeIndex e = offsets_[u]; e < offsets_[u + 1]; ++e)
+                reverse_slot_[e] = cursor[targets_[e]]++;
+    }
+
+    std::span<const double> base_;
+    std::span<const EdgeIndex> offsets_;
+    std::span<const NodeIndex> targets_;
+    std::span<const EdgeIndex> rev_offsets_;
+
+    std::mutex mutex_;  // Serializes writers; readers never take it
+    std::atomic<const WeightSet *> current_{nullptr};
+
+    // Writer state, guarded by mutex_
+    std::vector<EdgeIndex> reverse_slot_;  // Built on the first publish
+    TrafficProfiles profiles_;
+    std::vector<ProfileId> edge_profiles_;  // Empty = every edge FLAT
+    double time_s_ = 0.0;
+    std::unordered_map<EdgeIndex, double> overrides_;
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "graph_types.h"  // NodeIndex, EdgeIndex
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+// Layout of the dense node indices of a RoadNetwork
+enum class NodeOrder : std::uint8_t
+{
+    Id,                  // Ascending OSM id (the input order of most tools, no locality)
+    Hilbert,             // Along a Hilbert curve over (lat, lon)
+    BreadthFirst,        // Breadth-first over the undirected graph
+    ReverseCuthillMcKee  // Bandwidth-reducing breadth-first, reversed
+};
+
+/**
+ * @brief Node permutations that put nodes a search touches together close in memory.
+ *
+ * A* and Dijkstra expand a wavefront of geographically close nodes, but with indices in
+ * OSM id order the neighbours of a node sit anywhere in the arrays, so nearly every edge
+ * relaxation misses the cache for its g-score, parent, coordinates and edge range.
+ * Renumbering the nodes so that neighbours get nearby indices turns those into hits:
+ *   - Hilbert sorts the nodes by their position on a Hilbert curve over the bounding box
+ *     of the coordinates. The curve keeps spatially close points close along it, and it
+ *     needs no adjacency, only (lat, lon).
+ *   - BreadthFirst numbers the nodes in BFS order over the undirected graph, one
+ *     component after the other, so the neighbours of a node are within about one BFS
+ *     level of it.
+ *   - ReverseCuthillMcKee is BFS started from a minimum-degree node that visits the
+ *     neighbours in ascending degree, reversed at the end: the classic heuristic for a
+ *     small adjacency-matrix bandwidth, i.e. small |u - v| over the edges.
+ *
+ * Every function returns order with order[new index] = current index. Ties break on the
+ * current index (Hilbert: on the OSM id), so a permutation is deterministic for a given
+ * network.
+ */
+namespace NodeOrdering
+{
+
+// Bits per coordinate of the Hilbert grid: 2^16 cells per axis, about 2 m across a city
+constexpr unsigned HILBERT_BITS = 16;
+
+// Position of cell (x, y) of the 2^HILBERT_BITS grid along the Hilbert curve
+inline std::uint64_t hilbert_key(std::uint32_t x, std::uint32_t y)
+{
+    constexpr std::uint32_t side = std::uint32_t(1) << HILBERT_BITS;
+    std::uint64_t key = 0;
+    for (std::uint32_t s = side / 2; s > 0; s /= 2)
+    {
+        const std::uint32_t rx = (x & s) ? 1 : 0;
+        const std::uint32_t ry = (y & s) ? 1 : 0;
+        key += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+        // Rotate the quadrant so the sub-curve starts and ends next to its neighbours
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return key;
+}
+
+// Nodes sorted by the Hilbert key of their coordinates scaled onto the grid
+inline std::vector<NodeIndex> hilbert_order(std::span<const double> lats, std::span<const double> lons,
+                                            std::span<const long long> node_ids)
+{
+    const size_t n = lats.size();
+    std::vector<NodeIndex> order(n);
+    std::iota(order.begin(), order.end(), NodeIndex(0));
+    if (n == 0)
+        return order;
+
+    const auto [min_lat, max_lat] = std::minmax_element(lats.begin(), lats.end());
+    const auto [min_lon, max_lon] = std::minmax_element(lons.begin(), lons.end());
+    constexpr double max_cell = double((std::uint32_t(1) << HILBERT_BITS) - 1);
+    auto scale = [max_cell](double low, double high) { return high > low ? max_cell / (high - low) : 0.0; };
+    const double lat_scale = scale(*min_lat, *max_lat), lon_scale = scale(*min_lon, *max_lon);
+
+    std::vector<std::uint64_t> keys(n);
+    for (size_t u = 0; u < n; ++u)
+    {
+        const auto x = static_cast<std::uint32_t>((lons[u] - *min_lon) * lon_scale);
+        const auto y = static_cast<std::uint32_t>((lats[u] - *min_lat) * lat_scale);
+        keys[u] = hilbert_key(std::min(x, std::uint32_t(max_cell)), std::min(y, std::uint32_t(max_cell)));
+    }
+    std::sort(order.begin(), order.end(), [&](NodeIndex a, NodeIndex b)
+              { return keys[a] != keys[b] ? keys[a] < keys[b] : node_ids[a] < node_ids[b]; });
+    return order;
+}
+
+// Breadth-first order over the undirected view of the forward and reverse CSR. Every
+// component starts at its first unvisited node in the start sequence (index order, or
+// ascending degree for Cuthill-McKee), and Cuthill-McKee also enqueues the neighbours of
+// a node by ascending degree; reverse_result then flips the whole sequence.
+inline std::vector<NodeIndex> traversal_order(std::span<const EdgeIndex> offsets, std::span<const NodeIndex> targets,
+                                              std::span<const EdgeIndex> rev_offsets,
+                                              std::span<const NodeIndex> rev_sources, bool cuthill_mckee)
+{
+    const size_t n = offsets.empty() ? 0 : offsets.size() - 1;
+    auto degree = [&](NodeIndex u)
+    { return (offsets[u + 1] - offsets[u]) + (rev_offsets[u + 1] - rev_offsets[u]); };
+    auto by_degree = [&](NodeIndex a, NodeIndex b)
+    { return degree(a) != degree(b) ? degree(a) < degree(b) : a < b; };
+
+    std::vector<NodeIndex> starts(n);
+    std::iota(starts.begin(), starts.end(), NodeIndex(0));
+    if (cuthill_mckee)
+        std::sort(starts.begin(), starts.end(), by_degree);
+
+    // order doubles as the BFS queue: [head, order.size()) are the discovered, unexpanded nodes
+    std::vector<NodeIndex> order;
+    order.reserve(n);
+    std::vector<bool> visited(n, false);
+    for (NodeIndex start : starts)
+    {
+        if (visited[start])
+            continue;
+        visited[start] = true;
+        order.push_back(start);
+        for (size_t head = order.size() - 1; head < order.size(); ++head)
+        {
+            const NodeIndex u = order[head];
+            const size_t level_begin = order.size();
+            auto discover = [&](NodeIndex v)
+            {
+                if (!visited[v])
+                {
+                    visited[v] = true;
+                    order.push_back(v);
+                }
+            };
+            for (EdgeIndex e = offsets[u]; e < offsets[u + 1]; ++e)
+                discover(targets[e]);
+            for (EdgeIndex e = rev_offsets[u]; e < rev_offsets[u + 1]; ++e)
+                discover(rev_sources[e]);
+            if (cuthill_mckee)
+                std::sort(order.begin() + level_begin, order.end(), by_degree);
+        }
+    }
+    if (cuthill_mckee)
+        std::reverse(order.begin(), order.end());
+    return order;
+}
+
+// Ascending OSM id
+inline std::vector<NodeIndex> id_order(std::span<const long long> node_ids)
+{
+    std::vector<NodeIndex> order(node_ids.size());
+    std::iota(order.begin(), order.end(), NodeIndex(0));
+    std::sort(order.begin(), order.end(), [&](NodeIndex a, NodeIndex b) { return node_ids[a] < node_ids[b]; });
+    return order;
+}
+
+// Inverse of a permutation: index[order[i]] = i
+inline std::vector<NodeIndex> inverse(std::span<const NodeIndex> order)
+{
+    std::vector<NodeIndex> index(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        index[order[i]] = static_cast<NodeIndex>(i);
+    return index;
+}
+
+}  // namespace NodeOrdering
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <span>
+#include <sstream>
+#include <stdexcept>  // For std::exception
+#include <string>
+#include <thread>
+#include <utility>  // For std::swap
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief NUMA nodes of the machine and the CPUs on each, read from sysfs.
+ *
+ * No libnuma: the kernel lists the online nodes as /sys/devices/system/node/nodeN, each
+ * with a cpulist file ("0-15,32-47"). Machines (or containers) without that directory,
+ * and non-Linux platforms, get one node holding every CPU, on which all placement below
+ * degenerates to plain allocation.
+ *
+ * Memory is placed by first touch: Linux backs a page on the node of the thread that
+ * first writes it, so an untouched anonymous mapping filled by a thread pinned to node d
+ * lives on node d (see FirstTouchArray).
+ */
+class NumaTopology
+{
+public:
+    // Reads the nodes below root (the sysfs node directory); one node if there are none
+    static NumaTopology from_sysfs(const std::string &root = "/sys/devices/system/node")
+    {
+        NumaTopology topology;
+        for (int node = 0; node < MAX_NODES; ++node)
+        {
+            std::ifstream file(root + "/node" + std::to_string(node) + "/cpulist");
+            if (!file)
+                continue;
+            std::string line;
+            std::getline(file, line);
+            std::vector<int> cpus = parse_cpulist(line);
+            std::sort(cpus.begin(), cpus.end());
+            if (!cpus.empty())
+                topology.node_cpus_.push_back(std::move(cpus));
+        }
+        if (topology.node_cpus_.empty())
+            topology.node_cpus_.push_back(all_cpus());
+        return topology;
+    }
+
+    // Topology of this machine, read once
+    static const NumaTopology &system()
+    {
+        static const NumaTopology topology = from_sysfs();
+        return topology;
+    }
+
+    // "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}; malformed ranges are skipped
+    static std::vector<int> parse_cpulist(const std::string &list)
+    {
+        std::vector<int> cpus;
+        std::stringstream stream(list);
+        std::string range;
+        while (std::getline(stream, range, ','))
+        {
+            int first = 0, last = 0;
+            const size_t dash = range.find('-');
+            try
+            {
+                first = std::stoi(range.substr(0, dash));
+                last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            }
+            catch (const std::exception &)
+            {
+                continue;
+            }
+            for (int cpu = first; cpu <= last && cpu >= 0; ++cpu)
+                cpus.push_back(cpu);
+        }
+        return cpus;
+    }
+
+    size_t num_nodes() const { return node_cpus_.size(); }
+
+    // CPUs of node d, ascending
+    const std::vector<int> &cpus(size_t node) const { return node_cpus_[node]; }
+
+    // Node of a CPU; 0 for a CPU the topology does not list
+    size_t node_of_cpu(int cpu) const
+    {
+        for (size_t node = 0; node < node_cpus_.size(); ++node)
+            if (std::binary_search(node_cpus_[node].begin(), node_cpus_[node].end(), cpu))
+                return node;
+        return 0;
+    }
+
+    // Node the calling thread runs on right now (stable only for a pinned thread)
+    size_t current_node() const
+    {
+#ifdef __linux__
+        if (num_nodes() > 1)
+        {
+            const int cpu = sched_getcpu();
+            if (cpu >= 0)
+                return node_of_cpu(cpu);
+        }
+#endif
+        return 0;
+    }
+
+    // Restricts the calling thread to the CPUs of node; false if that is unsupported
+    bool pin_current_thread([[maybe_unused]] size_t node) const
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : node_cpus_[node])
+            if (cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+private:
+    static constexpr int MAX_NODES = 1024;
+
+    static std::vector<int> all_cpus()
+    {
+        std::vector<int> cpus(std::max(1u, std::thread::hardware_concurrency()));
+        for (size_t i = 0; i < cpus.size(); ++i)
+            cpus[i] = static_cast<int>(i);
+        return cpus;
+    }
+
+    std::vector<std::vector<int>> node_cpus_;
+};
+
+/**
+ * @brief Fixed-size array of trivially copyable T whose pages are first touched slice by
+ * slice on chosen NUMA nodes.
+ *
+ * The memory is an anonymous mapping the constructor does not write, so no page is
+ * backed yet; the owner then fills slice d from a thread pinned to node d (see
+ * run_on_each_node). Without mmap it falls back to ordinary (unplaced) heap memory.
+ */
+template <typename T>
+class FirstTouchArray
+{
+public:
+    FirstTouchArray() = default;
+
+    explicit FirstTouchArray(size_t size) : size_(size)
+    {
+        if (size_ == 0)
+            return;
+#ifdef __linux__
+        void *memory = mmap(nullptr, bytes(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            data_ = static_cast<T *>(memory);
+            mapped_ = true;
+            return;
+        }
+#endif
+        data_ = static_cast<T *>(::operator new(bytes()));
+    }
+
+    ~FirstTouchArray()
+    {
+        if (data_ == nullptr)
+            return;
+#ifdef __linux__
+        if (mapped_)
+        {
+            munmap(data_, bytes());
+            return;
+        }
+#endif
+        ::operator delete(data_);
+    }
+
+    FirstTouchArray(const FirstTouchArray &) = delete;
+    FirstTouchArray &operator=(const FirstTouchArray &) = delete;
+
+    FirstTouchArray(FirstTouchArray &&other) noexcept { swap(other); }
+
+    FirstTouchArray &operator=(FirstTouchArray &&other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    T *data() { return data_; }
+
+    std::span<const T> view() const { return {data_, size_}; }
+
+    size_t size() const { return size_; }
+
+private:
+    size_t bytes() const { return size_ * sizeof(T); }
+
+    void swap(FirstTouchArray &other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(mapped_, other.mapped_);
+    }
+
+    T *data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+};
+
+// Runs task(d) for every node d of topology on its own thread pinned to node d and waits
+// for all of them. With a single node the task runs on the calling thread.
+template <typename Task>
+void run_on_each_node(const NumaTopology &topology, Task &&task)
+{
+    if (topology.num_nodes() <= 1)
+    {
+        task(size_t(0));
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(topology.num_nodes());
+    for (size_t node = 0; node < topology.num_nodes(); ++node)
+        threads.emplace_back(
+            [&topology, &task, node]
+            {
+                topology.pin_current_thread(node);
+                task(node);
+            });
+    for (std::thread &thread : threads)
+        thread.join();
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "graph_types.h"  // NodeIndex
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <utility>  // For std::move
+#include <vector>
+
+/**
+ * @brief Concurrent LRU cache of search results, keyed by (start, goal, weights version).
+ *
+ * Query traffic is skewed: the same origin-destination pairs come back again and again.
+ * The cache keeps the path (dense indices) and cost of recent queries so that a repeat
+ * costs a hash lookup instead of a search.
+ *
+ * The weights version is part of the key, so an entry is only ever returned for the exact
+ * weights it was computed under: a result computed under older weights (e.g. inserted by
+ * a search that was still running when an update was published) can never be returned
+ * for newer ones, and clear() merely frees what can no longer hit.
+ *
+ * Paths are stored compressed: the differences between consecutive indices, zigzag
+ * encoded as LEB128 varints. Neighbours on a road are numbered close together, very much
+ * so after a locality ordering (NodeOrder), so a step costs one or two bytes instead of
+ * the four of a NodeIndex.
+ *
+ * The key space is split over NUM_SHARDS independent LRU lists, each behind its own
+ * mutex, so concurrent queries (batch searches, Python threads) rarely wait on each
+ * other. Each shard holds at most capacity / NUM_SHARDS entries (rounded up). Entries of
+ * unreachable pairs (empty path, cost +infinity) are cached as well.
+ */
+class PathCache
+{
+public:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    struct Stats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t insertions = 0;
+        std::uint64_t evictions = 0;
+        size_t size = 0;      // Entries currently held
+        size_t capacity = 0;  // Maximum number of entries
+    };
+
+    struct Result
+    {
+        std::vector<NodeIndex> path;  // Start first; empty if the goal is unreachable
+        double cost;
+    };
+
+    // Holds at most capacity entries (at least one per shard)
+    explicit PathCache(size_t capacity)
+        : capacity_(std::max(capacity, NUM_SHARDS)), shard_capacity_((capacity_ + NUM_SHARDS - 1) / NUM_SHARDS)
+    {
+    }
+
+    PathCache(const PathCache &) = delete;
+    PathCache &operator=(const PathCache &) = delete;
+
+    size_t capacity() const { return capacity_; }
+
+    // The cached result of start -> goal under weights version, and marks it most recently used
+    std::optional<Result> find(NodeIndex start, NodeIndex goal, std::uint64_t version)
+    {
+        const Key key{start, goal, version};
+        Shard &shard = shard_of(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end())
+        {
+            shard.misses++;
+            return std::nullopt;
+        }
+        shard.hits++;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        const Entry &entry = *it->second;
+        return Result{decode(entry.packed, entry.length), entry.cost};
+    }
+
+    // Stores (or replaces) the result of start -> goal under weights version, evicting the
+    // least recently used entry of its shard when full
+    void insert(NodeIndex start, NodeIndex goal, std::uint64_t version, std::span<const NodeIndex> path,
+                double cost)
+    {
+        const Key key{start, goal, version};
+        std::vector<std::uint8_t> packed = encode(path);  // Outside the lock
+        Shard &shard = shard_of(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.insertions++;
+        auto it = shard.index.find(key);
+        if (it != shard.index.end())
+        {
+            it->second->packed = std::move(packed);
+            it->second->length = static_cast<std::uint32_t>(path.size());
+            it->second->cost = cost;
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            return;
+        }
+        if (shard.lru.size() >= shard_capacity_)
+        {
+            shard.index.erase(shard.lru.back().key);
+            shard.lru.pop_back();
+            shard.evictions++;
+        }
+        shard.lru.push_front({key, std::move(packed), static_cast<std::uint32_t>(path.size()), cost});
+        shard.index.emplace(key, shard.lru.begin());
+    }
+
+    // Drops every entry; the counters are kept
+    void clear()
+    {
+        for (Shard &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.index.clear();
+            shard.lru.clear();
+        }
+    }
+
+    // Counters summed over the shards (each shard read under its lock)
+    Stats stats() const
+    {
+        Stats total;
+        total.capacity = capacity_;
+        for (const Shard &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total.hits += shard.hits;
+            total.misses += shard.misses;
+            total.insertions += shard.insertions;
+            total.evictions += shard.evictions;
+            total.size += shard.lru.size();
+        }
+        return total;
+    }
+
+    // Zigzag-varint deltas of path (the first index is a delta from 0)
+    static std::vector<std::uint8_t> encode(std::span<const NodeIndex> path)
+    {
+        std::vector<std::uint8_t> out;
+        out.reserve(path.size() * 2);
+        std::int64_t previous = 0;
+        for (NodeIndex u : path)
+        {
+            const std::int64_t delta = static_cast<std::int64_t>(u) - previous;
+            previous = u;
+            std::uint64_t zigzag = (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63);
+            while (zigzag >= 0x80)
+            {
+                out.push_back(static_cast<std::uint8_t>(zigzag | 0x80));
+                zigzag >>= 7;
+            }
+            out.push_back(static_cast<std::uint8_t>(zigzag));
+        }
+        return out;
+    }
+
+    // Inverse of encode() for a path of length nodes
+    static std::vector<NodeIndex> decode(std::span<const std::uint8_t> packed, size_t length)
+    {
+        std::vector<NodeIndex> path(length);
+        std::int64_t previous = 0;
+        size_t pos = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            std::uint64_t zigzag = 0;
+            for (int shift = 0;; shift += 7)
+            {
+                const std::uint8_t byte = packed[pos++];
+                zigzag |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                if (byte < 0x80)
+                    break;
+            }
+            previous += static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+            path[i] = static_cast<NodeIndex>(previous);
+        }
+        return path;
+    }
+
+private:
+    struct Key
+    {
+        NodeIndex start;
+        NodeIndex goal;
+        std::uint64_t version;
+
+        bool operator==(const Key &) const = default;
+    };
+
+    // splitmix64 finalizer over the packed key: the shard takes the high bits, the map the low ones
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const
+        {
+            std::uint64_t x = ((static_cast<std::uint64_t>(key.start) << 32) | key.goal)
+                              ^ (key.version * 0x9e3779b97f4a7c15ULL);
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return static_cast<size_t>(x ^ (x >> 31));
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        std::vector<std::uint8_t> packed;  // encode() of the path
+        std::uint32_t length;              // Nodes on the path
+        double cost;
+    };
+
+    // One LRU list (most recent first) with its index; alignas keeps two shard locks off
+    // one cache line
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t insertions = 0;
+        std::uint64_t evictions = 0;
+    };
+
+    Shard &shard_of(const Key &key) { return shards_[(KeyHash{}(key) >> 32) % NUM_SHARDS]; }
+
+    size_t capacity_;
+    size_t shard_capacity_;
+    std::array<Shard, NUM_SHARDS> shards_;
+};
@@ -1,8 +1,33 @@
 #pragma once
 
+#include "binary_format.h"      // On-disk format and MappedFile
+#include "geo_coordinates.h"    // Radian coordinates for the heuristics
+#include "graph_partition.h"    // Geometric partitioning into NUMA domains
 #include "graph_types.h"        // Uses Node, Edge, Graph, NodeMap
+#include "landmark_table.h"     // ALT distance tables
+#include "live_weights.h"       // Time-dependent and live-traffic weights (RCU)
+#include "node_order.h"         // Cache-friendly node renumbering
+#include "numa.h"               // NUMA topology and first-touch placement
+#include "path_cache.h"         // LRU cache of repeated queries
+#include "spatial_index.h"      // Nearest-node snapping
+#include "thread_pool.h"        // Parallel batch snapping
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <optional>
 #include <pybind11/pybind11.h>  // Include for py::dict if needed in constructor/methods
+#include <pybind11/numpy.h>     // Buffer-protocol access for the NumPy constructor
 #include <pybind11/stl.h>       // Needed if constructor directly uses stl converters
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -31,7 +56,8 @@ inline NodeMap convert_py_nodes(const py::dict &py_nodes)
 }
 
 // Helper function (can be here or in a separate .cpp)
-// Converts Python dict {id: [(neighbor_id, weight), ...]} to Graph
+// Converts Python dict {id: [(neighbor_id, weight), ...]} to Graph. A neighbor may also be
+// (neighbor_id, weight, (distance, time, toll)) to give the multi-objective cost vector.
 inline Graph convert_py_graph(const py::dict &py_graph)
 {
     Graph graph;
@@ -51,9 +77,16 @@ inline Graph convert_py_graph(const py::dict &py_graph)
                 double weight = info_tuple[1].cast<double>();
                 edges.emplace_back(v_id, weight);
             }
+            else if (info_tuple.size() == 3)
+            {
+                long long v_id = info_tuple[0].cast<long long>();
+                double weight = info_tuple[1].cast<double>();
+                edges.emplace_back(v_id, weight, info_tuple[2].cast<CostVector>());
+            }
             else
             {
-                throw py::value_error("Neighbor data tuple must contain (target_node_id, weight)");
+                throw py::value_error(
+                    "Neighbor data tuple must contain (target_node_id, weight[, (distance, time, toll)])");
             }
         }
         graph.emplace(u_id, std::move(edges));
@@ -61,14 +94,103 @@ inline Graph convert_py_graph(const py::dict &py_graph)
     return graph;
 }
 
+// C-contiguous NumPy array of T; other dtypes/strides are converted by NumPy itself
+template <typename T>
+using py_array = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+// Views a 1-D NumPy array as a span without copying (the array must outlive the span)
+template <typename T>
+std::span<const T> numpy_span(const py_array<T> &array, const char *name)
+{
+    if (array.ndim() != 1)
+        throw py::value_error(std::string(name) + " must be a 1-D array");
+    return {array.data(), static_cast<size_t>(array.size())};
+}
+
 class RoadNetwork
 {
 public:
     // Constructor taking Python dictionaries directly
-    RoadNetwork(const py::dict &py_graph, const py::dict &py_nodes)
-        : graph_data_(convert_py_graph(py_graph)), node_data_(convert_py_nodes(py_nodes))
+    RoadNetwork(const py::dict &py_graph, const py::dict &py_nodes, NodeOrder order = NodeOrder::Id)
+        : RoadNetwork(convert_py_graph(py_graph), convert_py_nodes(py_nodes), order)
+    {
+    }
+
+    // Freezes an adjacency list + node map into the CSR layout.
+    RoadNetwork(const Graph &graph, const NodeMap &nodes, NodeOrder order = NodeOrder::Id)
+    {
+        std::vector<long long> node_ids, sources, targets;
+        std::vector<double> lats, lons, weights;
+        std::vector<CostVector> costs;
+        bool has_costs = false;
+        node_ids.reserve(nodes.size());
+        lats.reserve(nodes.size());
+        lons.reserve(nodes.size());
+        for (const auto &item : nodes)
+        {
+            node_ids.push_back(item.second.id);
+            lats.push_back(item.second.lat);
+            lons.push_back(item.second.lon);
+        }
+        for (const auto &item : graph)
+        {
+            for (const Edge &edge : item.second)
+            {
+                sources.push_back(item.first);
+                targets.push_back(edge.target_node_id);
+                weights.push_back(edge.weight);
+                costs.push_back(edge.costs);
+                has_costs = has_costs || edge.has_cost_vector();
+            }
+        }
+        // Cost vectors are only stored when some edge has more than its weight
+        build(node_ids, lats, lons, sources, targets, weights,
+              has_costs ? std::span<const CostVector>(costs) : std::span<const CostVector>(), order);
+    }
+
+    // Builds the CSR layout from flat arrays: one (id, lat, lon) entry per node and one
+    // (source id, target id, weight) entry per directed edge.
+    // Node indices follow order (ascending OSM id by default), so the layout is deterministic.
+    // Edges whose endpoints have no coordinate data are dropped (they could never be
+    // scored by the heuristic anyway). Edges keep their input order within each source.
+    // costs is empty or holds one multi-objective cost vector per edge.
+    RoadNetwork(std::span<const long long> node_ids, std::span<const double> lats,
+                std::span<const double> lons, std::span<const long long> sources,
+                std::span<const long long> targets, std::span<const double> weights,
+                std::span<const CostVector> costs = {}, NodeOrder order = NodeOrder::Id)
     {
-        // Optional: Add validation here if needed
+        build(node_ids, lats, lons, sources, targets, weights, costs, order);
+    }
+
+    // Builds from NumPy arrays through the buffer protocol: no per-element Python calls,
+    // and the GIL is released while the CSR arrays are assembled. costs, if given, is a
+    // (num_edges, NUM_CRITERIA) array of multi-objective edge costs.
+    static RoadNetwork from_numpy(const py_array<long long> &node_ids,
+                                  const py_array<double> &lats, const py_array<double> &lons,
+                                  const py_array<long long> &sources,
+                                  const py_array<long long> &targets,
+                                  const py_array<double> &weights,
+                                  const std::optional<py_array<double>> &costs = std::nullopt,
+                                  NodeOrder order = NodeOrder::Id)
+    {
+        auto node_ids_view = numpy_span(node_ids, "node_ids");
+        auto lats_view = numpy_span(lats, "lats");
+        auto lons_view = numpy_span(lons, "lons");
+        auto sources_view = numpy_span(sources, "sources");
+        auto targets_view = numpy_span(targets, "targets");
+        auto weights_view = numpy_span(weights, "weights");
+        std::span<const CostVector> costs_view;
+        if (costs)
+        {
+            if (costs->ndim() != 2 || costs->shape(1) != static_cast<py::ssize_t>(NUM_CRITERIA))
+                throw py::value_error("costs must be a (num_edges, 3) array");
+            costs_view = {reinterpret_cast<const CostVector *>(costs->data()),
+                          static_cast<size_t>(costs->shape(0))};
+        }
+
+        py::gil_scoped_release release;
+        return RoadNetwork(node_ids_view, lats_view, lons_view, sources_view, targets_view,
+                           weights_view, costs_view, order);
     }
 
     // Deleted copy constructor/assignment to prevent accidental copies
@@ -79,26 +201,953 @@ public:
     RoadNetwork(RoadNetwork &&) = default;
     RoadNetwork &operator=(RoadNetwork &&) = default;
 
-    // Accessors for the A* algorithm (const references)
-    const Graph &get_graph() const { return graph_data_; }
+    // --- Binary format (see binary_format.h) ---
+
+    // Memory-maps a file written by save_binary() read-only. The network views the mapped
+    // arrays in place, and processes share the page-cached copy. With verify (the
+    // default) one O(n + m) pass checks that every index in the file is in range (CSR
+    // offsets, edge endpoints, id map, landmarks) and that a stored reverse CSR is the
+    // transposition of the forward one, so a truncated or corrupt file throws
+    // std::runtime_error instead of sending searches out of bounds. verify = false skips
+    // it, which keeps opening O(1), for files this program wrote itself.
+    static RoadNetwork open_mmap(const std::string &path, bool verify = true)
+    {
+        using namespace BinaryFormat;
+        RoadNetwork network;
+        network.mapping_ = std::make_shared<const MappedFile>(path);
+        const MappedFile &file = *network.mapping_;
+        const Header &header = read_header(file, path);
+        if (header.num_nodes >= INVALID_NODE_INDEX || header.num_edges >= std::numeric_limits<EdgeIndex>::max())
+            throw std::runtime_error("'" + path + "' has more nodes or edges than an index can address.");
+        const size_t n = header.num_nodes;
+        const size_t m = header.num_edges;
+
+        network.offsets_ = section_view<EdgeIndex>(file, header, SectionId::Offsets, n + 1);
+        network.targets_ = section_view<NodeIndex>(file, header, SectionId::Targets, m);
+        network.weights_ = section_view<double>(file, header, SectionId::Weights, m);
+        network.lat_ = section_view<double>(file, header, SectionId::Lats, n);
+        network.lon_ = section_view<double>(file, header, SectionId::Lons, n);
+        network.node_ids_ = section_view<long long>(file, header, SectionId::NodeIds, n);
+        network.id_map_ids_ = section_view<long long>(file, header, SectionId::IdMapIds, n);
+        network.id_map_index_ = section_view<NodeIndex>(file, header, SectionId::IdMapIndex, n);
+
+        if (network.offsets_[0] != 0 || network.offsets_[n] != m)
+            throw std::runtime_error("'" + path + "' has inconsistent CSR offsets.");
+        if (verify)
+        {
+            verify_csr(network.offsets_, network.targets_, n, path, "forward");
+            verify_id_map(network, path);
+        }
+
+        // Reverse adjacency is optional in the file; derive it if the writer left it out
+        network.rev_offsets_ = section_view<EdgeIndex>(file, header, SectionId::RevOffsets, n + 1, false);
+        network.rev_sources_ = section_view<NodeIndex>(file, header, SectionId::RevSources, m, false);
+        network.rev_weights_ = section_view<double>(file, header, SectionId::RevWeights, m, false);
+        network.edge_costs_ = section_view<CostVector>(file, header, SectionId::EdgeCosts, m, false);
+        network.rev_edge_costs_ = section_view<CostVector>(file, header, SectionId::RevEdgeCosts, m, false);
+        if (network.rev_offsets_.empty() || network.rev_sources_.size() != m
+            || network.rev_weights_.size() != m || network.rev_offsets_[n] != m
+            || network.rev_edge_costs_.size() != network.edge_costs_.size())
+            network.build_reverse();
+        else if (verify)
+            verify_reverse(network, path);
+
+        // Same for the radian coordinates of the heuristics
+        network.geo_.lat_rad = section_view<double>(file, header, SectionId::LatRad, n, false);
+        network.geo_.lon_rad = section_view<double>(file, header, SectionId::LonRad, n, false);
+        network.geo_.cos_lat = section_view<double>(file, header, SectionId::CosLat, n, false);
+        if (network.geo_.lat_rad.size() != n || network.geo_.lon_rad.size() != n
+            || network.geo_.cos_lat.size() != n)
+            network.build_geo();
+
+        // Landmark tables are optional too; without them searches use the plain heuristic
+        const size_t k = section_length<NodeIndex>(header, SectionId::LandmarkIds);
+        if (k > 0)
+        {
+            if (n == 0 || k > file.size() / n)
+                throw std::runtime_error("'" + path + "' has landmark tables larger than the file.");
+            network.landmarks_.count = k;
+            network.landmarks_.landmarks = section_view<NodeIndex>(file, header, SectionId::LandmarkIds, k);
+            network.landmarks_.from = section_view<float>(file, header, SectionId::LandmarkFrom, n * k);
+            network.landmarks_.to = section_view<float>(file, header, SectionId::LandmarkTo, n * k);
+            if (verify)
+                for (NodeIndex landmark : network.landmarks_.landmarks)
+                    if (landmark >= n)
+                        throw std::runtime_error("'" + path + "' has a landmark index out of range.");
+        }
+        network.init_live_weights();
+        return network;
+    }
+
+    // Writes the network in the versioned binary format
+    void save_binary(const std::string &path) const
+    {
+        using namespace BinaryFormat;
+        Writer writer(num_nodes(), num_edges());
+        writer.add(SectionId::Offsets, offsets_);
+        writer.add(SectionId::Targets, targets_);
+        writer.add(SectionId::Weights, weights_);
+        writer.add(SectionId::Lats, lat_);
+        writer.add(SectionId::Lons, lon_);
+        writer.add(SectionId::NodeIds, node_ids_);
+        writer.add(SectionId::IdMapIds, id_map_ids_);
+        writer.add(SectionId::IdMapIndex, id_map_index_);
+        writer.add(SectionId::RevOffsets, rev_offsets_);
+        writer.add(SectionId::RevSources, rev_sources_);
+        writer.add(SectionId::RevWeights, rev_weights_);
+        if (has_edge_costs())
+        {
+            writer.add(SectionId::EdgeCosts, edge_costs_);
+            writer.add(SectionId::RevEdgeCosts, rev_edge_costs_);
+        }
+        writer.add(SectionId::LatRad, geo_.lat_rad);
+        writer.add(SectionId::LonRad, geo_.lon_rad);
+        writer.add(SectionId::CosLat, geo_.cos_lat);
+        if (!landmarks_.empty())
+        {
+            writer.add(SectionId::LandmarkIds, landmarks_.landmarks);
+            writer.add(SectionId::LandmarkFrom, landmarks_.from);
+            writer.add(SectionId::LandmarkTo, landmarks_.to);
+        }
+        writer.write(path);
+    }
+
+    // --- Node order (see NodeOrdering) ---
+
+    // Copy of the network with its node indices renumbered in the given order, in owned
+    // memory (also from a mapped network; save_binary() keeps the new layout). Node ids,
+    // edges, weights, cost vectors and landmark tables are the same: only dense indices
+    // change, so searches find the same paths (ties between equal-cost paths aside).
+    // The copy starts at the base weights and without a path cache: attach traffic
+    // profiles, updates and the cache after reordering.
+    RoadNetwork reordered(NodeOrder order) const
+    {
+        switch (order)
+        {
+        case NodeOrder::Hilbert:
+            return permuted(NodeOrdering::hilbert_order(lat_, lon_, node_ids_));
+        case NodeOrder::BreadthFirst:
+            return permuted(NodeOrdering::traversal_order(offsets_, targets_, rev_offsets_, rev_sources_, false));
+        case NodeOrder::ReverseCuthillMcKee:
+            return permuted(NodeOrdering::traversal_order(offsets_, targets_, rev_offsets_, rev_sources_, true));
+        case NodeOrder::Id:
+        default:
+            return permuted(NodeOrdering::id_order(node_ids_));
+        }
+    }
+
+    // --- Partitioning and NUMA placement (see GraphPartitioning, NumaTopology) ---
+
+    // Copy of the network renumbered into num_parts geometric parts (contiguous index
+    // ranges, Hilbert order inside each), spread over the NUMA nodes of the machine in
+    // consecutive groups. With place_on_numa (and more than one NUMA node) the CSR,
+    // coordinate and landmark slices of each domain are first touched on its node. The
+    // HDA* search and the batch searches then route work to the workers of the owning
+    // domain. The copy starts at the base weights and without a path cache, like
+    // reordered(); save_binary() keeps the layout but not the partition.
+    RoadNetwork partitioned(size_t num_parts, bool place_on_numa = true) const
+    {
+        GraphPartitioning::PartitionOrder parts =
+            GraphPartitioning::bisection_order(lat_, lon_, node_ids_, num_parts);
+        RoadNetwork network = permuted(parts.order);
+        const NumaTopology &topology = NumaTopology::system();
+        network.partition_ = GraphPartitioning::assign_domains(std::move(parts.part_begin), topology.num_nodes());
+        if (place_on_numa && network.partition_.num_domains() > 1)
+            network.place_on_domains(topology);
+        return network;
+    }
+
+    // Parts and domains of a partitioned() network; empty (no parts) otherwise
+    const GraphPartition &partition() const { return partition_; }
+
+    // Balance and cut edges of the partition (one part for an unpartitioned network)
+    PartitionQuality partition_quality() const
+    {
+        if (partition_.num_parts() > 0)
+            return GraphPartitioning::evaluate(offsets_, targets_, partition_);
+        const NodeIndex n = static_cast<NodeIndex>(num_nodes());
+        return GraphPartitioning::evaluate(offsets_, targets_, GraphPartition{{0, n}, {0, n}});
+    }
+
+    // True if the domain slices were placed on their NUMA nodes
+    bool is_numa_placed() const { return numa_ != nullptr; }
+
+    // True if the arrays view a memory-mapped file rather than owned memory
+    bool is_mapped() const { return mapping_ != nullptr; }
+
+    size_t num_nodes() const { return node_ids_.size(); }
+
+    size_t num_edges() const { return targets_.size(); }
+
+    // --- API boundary: OSM id <-> dense index ---
+
+    // Returns INVALID_NODE_INDEX if the id is unknown. Binary search over the sorted id map,
+    // which works unchanged on a memory-mapped network.
+    NodeIndex index_of(long long node_id) const
+    {
+        auto it = std::lower_bound(id_map_ids_.begin(), id_map_ids_.end(), node_id);
+        if (it == id_map_ids_.end() || *it != node_id)
+            return INVALID_NODE_INDEX;
+        return id_map_index_[it - id_map_ids_.begin()];
+    }
+
+    long long id_of(NodeIndex u) const { return node_ids_[u]; }
+
+    // --- Hot-path accessors (dense index, no hashing) ---
+
+    double lat(NodeIndex u) const { return lat_[u]; }
+
+    double lon(NodeIndex u) const { return lon_[u]; }
+
+    // Outgoing edges of u are [edge_begin(u), edge_end(u)) in targets()/weights().
+    // edge_weight() is the base (free-flow) weight; searches read the live weights through
+    // pin_weights().
+    EdgeIndex edge_begin(NodeIndex u) const { return offsets_[u]; }
+
+    EdgeIndex edge_end(NodeIndex u) const { return offsets_[u + 1]; }
+
+    NodeIndex edge_target(EdgeIndex e) const { return targets_[e]; }
+
+    double edge_weight(EdgeIndex e) const { return weights_[e]; }
+
+    // Incoming edges of v are [rev_edge_begin(v), rev_edge_end(v)): edge (rev_edge_source(e), v)
+    // with weight rev_edge_weight(e). Used by searches that run backwards from the goal.
+    EdgeIndex rev_edge_begin(NodeIndex v) const { return rev_offsets_[v]; }
+
+    EdgeIndex rev_edge_end(NodeIndex v) const { return rev_offsets_[v + 1]; }
+
+    NodeIndex rev_edge_source(EdgeIndex e) const { return rev_sources_[e]; }
+
+    double rev_edge_weight(EdgeIndex e) const { return rev_weights_[e]; }
+
+    // --- Live weights (time-dependent profiles and traffic updates, see LiveWeights) ---
+
+    // Pins the current weight version for one query. Never blocks, also while updates are
+    // being published; the pinned weights stay valid and unchanged until it goes away.
+    WeightSnapshot pin_weights() const { return live_->pin(); }
+
+    // Version of the current weights: 0 = base weights, +1 per published update
+    std::uint64_t weights_version() const { return live_->version(); }
+
+    // Attaches time-dependent profiles, edge_profiles[e] being the profile of forward edge
+    // e, and publishes the weights at the current traffic time. Safe during searches.
+    void set_traffic_profiles(TrafficProfiles profiles, std::vector<ProfileId> edge_profiles)
+    {
+        live_->set_profiles(std::move(profiles), std::move(edge_profiles));
+        clear_path_cache();
+    }
+
+    // Same by OSM ids: every edge sources[i] -> targets[i] (parallel edges included) gets
+    // profile_ids[i], all other edges FLAT. Unknown pairs are skipped.
+    void set_traffic_profiles(TrafficProfiles profiles, std::span<const long long> sources,
+                              std::span<const long long> targets, std::span<const ProfileId> profile_ids)
+    {
+        std::vector<ProfileId> edge_profiles(num_edges(), TrafficProfiles::FLAT);
+        for_each_edge_between(sources, targets, profile_ids.size(),
+                              [&](size_t i, EdgeIndex e) { edge_profiles[e] = profile_ids[i]; });
+        live_->set_profiles(std::move(profiles), std::move(edge_profiles));
+        clear_path_cache();
+    }
+
+    // Publishes the profile weights at time_s (seconds since midnight). Safe during searches.
+    void set_traffic_time(double time_s)
+    {
+        live_->set_time(time_s);
+        clear_path_cache();
+    }
+
+    // Publishes one batch of live weights for forward edges. Safe during searches.
+    void update_traffic(std::span<const EdgeIndex> edges, std::span<const double> weights)
+    {
+        live_->update(edges, weights);
+        clear_path_cache();
+    }
+
+    // Same by OSM ids: every edge source[i] -> target[i] (parallel edges included) gets
+    // weight[i]. Unknown pairs are skipped; returns the number of edges updated.
+    size_t update_traffic(std::span<const long long> sources, std::span<const long long> targets,
+                          std::span<const double> weights)
+    {
+        std::vector<EdgeIndex> edges;
+        std::vector<double> edge_weights;
+        for_each_edge_between(sources, targets, weights.size(),
+                              [&](size_t i, EdgeIndex e)
+                              {
+                                  edges.push_back(e);
+                                  edge_weights.push_back(weights[i]);
+                              });
+        live_->update(edges, edge_weights);
+        clear_path_cache();
+        return edges.size();
+    }
+
+    // NumPy form of update_traffic(); the GIL is released while the batch is published
+    size_t update_traffic_numpy(const py_array<long long> &sources, const py_array<long long> &targets,
+                                const py_array<double> &weights)
+    {
+        auto sources_view = numpy_span(sources, "sources");
+        auto targets_view = numpy_span(targets, "targets");
+        auto weights_view = numpy_span(weights, "weights");
+
+        py::gil_scoped_release release;
+        return update_traffic(sources_view, targets_view, weights_view);
+    }
+
+    // Drops all live updates (profiles stay) and publishes. Safe during searches.
+    void clear_traffic()
+    {
+        live_->clear_updates();
+        clear_path_cache();
+    }
+
+    // --- Query cache (optional, see PathCache) ---
+
+    // Attaches an LRU cache of up to capacity (start, goal) results, used by AStar::search
+    // and the batch searches; 0 detaches it. Publishing new weights empties it. Safe during
+    // searches: the cache is swapped atomically, and a running query keeps the one it took
+    // (see path_cache()) alive until it returns.
+    void set_path_cache(size_t capacity)
+    {
+        std::atomic_store(&path_cache_, capacity > 0 ? std::make_shared<PathCache>(capacity) : nullptr);
+    }
+
+    // The attached cache, or nullptr. Hold the returned pointer for the whole query.
+    std::shared_ptr<PathCache> path_cache() const { return std::atomic_load(&path_cache_); }
+
+    // Drops every cached result (the hit/miss counters stay). Safe during searches.
+    void clear_path_cache()
+    {
+        if (const std::shared_ptr<PathCache> cache = path_cache())
+            cache->clear();
+    }
+
+    // --- Multi-objective costs (optional, see CostVector) ---
+
+    // True if the network was built with per-edge cost vectors
+    bool has_edge_costs() const { return !edge_costs_.empty(); }
+
+    // Cost vector of forward edge e; {weight, 0, 0} when the network has none
+    CostVector edge_costs(EdgeIndex e) const
+    {
+        return has_edge_costs() ? edge_costs_[e] : CostVector{weights_[e], 0.0, 0.0};
+    }
+
+    // Same for reverse edge e (indexed like rev_edge_weight)
+    CostVector rev_edge_costs(EdgeIndex e) const
+    {
+        return has_edge_costs() ? rev_edge_costs_[e] : CostVector{rev_weights_[e], 0.0, 0.0};
+    }
+
+    std::span<const EdgeIndex> offsets() const { return offsets_; }
+
+    std::span<const NodeIndex> targets() const { return targets_; }
+
+    std::span<const double> weights() const { return weights_; }
+
+    std::span<const double> lats() const { return lat_; }
+
+    std::span<const double> lons() const { return lon_; }
 
-    const NodeMap &get_nodes() const { return node_data_; }
+    std::span<const long long> node_ids() const { return node_ids_; }
 
-    // Optional: Method to get node details (could be useful)
-    const Node *get_node(long long node_id) const
+    // --- Heuristic coordinates (radians, cos(lat); see GeoCoordinates) ---
+
+    const GeoCoordinates &geo() const { return geo_; }
+
+    // Selects the geographic bound all heuristics use. NOT THREAD-SAFE: call before
+    // searches start.
+    void set_geo_bound(GeoBound bound) { geo_.bound = bound; }
+
+    // --- ALT landmark tables (optional, see Landmarks::preprocess) ---
+
+    // Empty (count == 0) until tables are attached or loaded from a binary file
+    const LandmarkTable &landmarks() const { return landmarks_; }
+
+    // Attaches landmark tables built for this network (node-major, see LandmarkTable) and
+    // saves them with save_binary(). NOT THREAD-SAFE: call before searches start.
+    void set_landmarks(std::vector<NodeIndex> landmarks, std::vector<float> from,
+                       std::vector<float> to)
+    {
+        const size_t expected = num_nodes() * landmarks.size();
+        if (from.size() != expected || to.size() != expected)
+            throw std::invalid_argument("RoadNetwork: landmark tables must hold num_nodes distances per landmark.");
+        for (NodeIndex landmark : landmarks)
+            if (landmark >= num_nodes())
+                throw std::invalid_argument("RoadNetwork: landmark index out of range.");
+        owned_.landmark_ids = std::move(landmarks);
+        owned_.landmark_from = std::move(from);
+        owned_.landmark_to = std::move(to);
+        landmarks_.count = owned_.landmark_ids.size();
+        landmarks_.landmarks = owned_.landmark_ids;
+        landmarks_.from = owned_.landmark_from;
+        landmarks_.to = owned_.landmark_to;
+    }
+
+    // --- Nearest-node snapping (see SpatialIndex) ---
+
+    // Grid over the node coordinates, built on first use (thread-safe, also on a mapped
+    // network) and kept for the lifetime of the network
+    const SpatialIndex &spatial_index() const
+    {
+        std::call_once(spatial_->built, [this] { spatial_->index = SpatialIndex(lat_, lon_); });
+        return spatial_->index;
+    }
+
+    // OSM id of the node nearest to (lat, lon) in degrees by great-circle distance, or
+    // std::nullopt if the network has no nodes
+    std::optional<long long> nearest_node(double lat, double lon) const
+    {
+        const NodeIndex u = spatial_index().nearest(lat, lon);
+        if (u == INVALID_NODE_INDEX)
+            return std::nullopt;
+        return node_ids_[u];
+    }
+
+    // nearest_node() for every (lats[i], lons[i]), in parallel over the thread pool.
+    // Throws std::invalid_argument if the network has no nodes.
+    std::vector<long long> nearest_nodes(std::span<const double> lats, std::span<const double> lons,
+                                         int num_threads = 0) const
+    {
+        if (lats.size() != lons.size())
+            throw std::invalid_argument("RoadNetwork: lats and lons must have equal length.");
+        const SpatialIndex &index = spatial_index();
+        if (index.empty() && !lats.empty())
+            throw std::invalid_argument("RoadNetwork: no nodes to snap to.");
+
+        constexpr size_t CHUNK = 1024;
+        std::vector<long long> ids(lats.size());
+        const size_t chunks = (lats.size() + CHUNK - 1) / CHUNK;
+        ThreadPool::instance().parallel_for(
+            chunks,
+            [&](size_t chunk)
+            {
+                const size_t end = std::min(lats.size(), (chunk + 1) * CHUNK);
+                for (size_t i = chunk * CHUNK; i < end; ++i)
+                    ids[i] = node_ids_[index.nearest(lats[i], lons[i])];
+            },
+            num_threads > 0 ? static_cast<size_t>(num_threads) : 0);
+        return ids;
+    }
+
+    // --- Inspection helpers (by OSM id, mostly for Python) ---
+
+    // Returns node details, or std::nullopt if the id is unknown
+    std::optional<Node> get_node(long long node_id) const
     {
-        auto it = node_data_.find(node_id);
-        return (it != node_data_.end()) ? &(it->second) : nullptr;
+        NodeIndex u = index_of(node_id);
+        if (u == INVALID_NODE_INDEX)
+            return std::nullopt;
+        return Node(node_id, lat_[u], lon_[u]);
     }
 
-    // Optional: Method to get neighbors (could be useful)
-    const std::vector<Edge> *get_neighbors(long long node_id) const
+    // Materializes the outgoing edges of a node, or std::nullopt if the id is unknown
+    std::optional<std::vector<Edge>> get_neighbors(long long node_id) const
     {
-        auto it = graph_data_.find(node_id);
-        return (it != graph_data_.end()) ? &(it->second) : nullptr;
+        NodeIndex u = index_of(node_id);
+        if (u == INVALID_NODE_INDEX)
+            return std::nullopt;
+        std::vector<Edge> edges;
+        edges.reserve(edge_end(u) - edge_begin(u));
+        const WeightSnapshot weights = pin_weights();
+        for (EdgeIndex e = edge_begin(u); e < edge_end(u); ++e)
+            edges.emplace_back(node_ids_[targets_[e]], weights.forward(e), edge_costs(e));
+        return edges;
     }
 
 private:
-    Graph graph_data_;
-    NodeMap node_data_;
+    RoadNetwork() = default;
+
+    void build(std::span<const long long> node_ids, std::span<const double> lats,
+               std::span<const double> lons, std::span<const long long> sources,
+               std::span<const long long> targets, std::span<const double> weights,
+               std::span<const CostVector> costs, NodeOrder order)
+    {
+        if (lats.size() != node_ids.size() || lons.size() != node_ids.size())
+            throw std::invalid_argument("RoadNetwork: node_ids, lats and lons must have equal length.");
+        if (targets.size() != sources.size() || weights.size() != sources.size())
+            throw std::invalid_argument(
+                "RoadNetwork: sources, targets and weights must have equal length.");
+        if (!costs.empty() && costs.size() != sources.size())
+            throw std::invalid_argument("RoadNetwork: costs must hold one cost vector per edge.");
+        if (node_ids.size() >= INVALID_NODE_INDEX)
+            throw std::length_error("RoadNetwork: too many nodes for 32-bit indices.");
+
+        // Dense index order = ascending OSM id; other orders renumber the result below
+        const size_t n = node_ids.size();
+        const std::vector<NodeIndex> id_order = NodeOrdering::id_order(node_ids);
+
+        Storage &st = owned_;
+        st.node_ids.resize(n);
+        st.lat.resize(n);
+        st.lon.resize(n);
+        for (NodeIndex u = 0; u < n; ++u)
+        {
+            st.node_ids[u] = node_ids[id_order[u]];
+            st.lat[u] = lats[id_order[u]];
+            st.lon[u] = lons[id_order[u]];
+            if (u > 0 && st.node_ids[u] == st.node_ids[u - 1])
+                throw std::invalid_argument("RoadNetwork: duplicate node id "
+                                            + std::to_string(st.node_ids[u]) + ".");
+        }
+
+        // Sorted id map (identity permutation while indices follow id order)
+        st.id_map_ids = st.node_ids;
+        st.id_map_index.resize(n);
+        for (NodeIndex u = 0; u < n; ++u)
+            st.id_map_index[u] = u;
+        id_map_ids_ = st.id_map_ids;
+        id_map_index_ = st.id_map_index;
+
+        // Resolve endpoints once; INVALID marks edges that are dropped
+        const size_t m = sources.size();
+        std::vector<NodeIndex> edge_source(m), edge_target(m);
+        st.offsets.assign(n + 1, 0);
+        for (size_t i = 0; i < m; ++i)
+        {
+            edge_source[i] = index_of(sources[i]);
+            edge_target[i] = index_of(targets[i]);
+            if (edge_source[i] == INVALID_NODE_INDEX || edge_target[i] == INVALID_NODE_INDEX)
+                edge_source[i] = INVALID_NODE_INDEX;
+            else
+                st.offsets[edge_source[i] + 1]++;
+        }
+        for (size_t u = 0; u < n; ++u)
+            st.offsets[u + 1] += st.offsets[u];
+
+        if (st.offsets[n] >= std::numeric_limits<EdgeIndex>::max())
+            throw std::length_error("RoadNetwork: too many edges for 32-bit indices.");
+
+        // Stable counting sort of the edges by source
+        st.targets.resize(st.offsets[n]);
+        st.weights.resize(st.offsets[n]);
+        st.edge_costs.resize(costs.empty() ? 0 : st.offsets[n]);
+        std::vector<EdgeIndex> cursor(st.offsets.begin(), st.offsets.end() - 1);
+        for (size_t i = 0; i < m; ++i)
+        {
+            NodeIndex u = edge_source[i];
+            if (u == INVALID_NODE_INDEX)
+                continue;
+            st.targets[cursor[u]] = edge_target[i];
+            st.weights[cursor[u]] = weights[i];
+            if (!costs.empty())
+                st.edge_costs[cursor[u]] = costs[i];
+            cursor[u]++;
+        }
+
+        offsets_ = st.offsets;
+        targets_ = st.targets;
+        weights_ = st.weights;
+        edge_costs_ = st.edge_costs;
+        lat_ = st.lat;
+        lon_ = st.lon;
+        node_ids_ = st.node_ids;
+
+        build_reverse();
+        build_geo();
+        init_live_weights();
+
+        if (order != NodeOrder::Id)
+            *this = reordered(order);
+    }
+
+    // Copy of the network with node order[i] of this one as node i: the forward CSR is
+    // assembled node by node in the new order (edges keep their order within a source),
+    // the reverse CSR and radian coordinates are derived again
+    RoadNetwork permuted(std::span<const NodeIndex> order) const
+    {
+        const size_t n = num_nodes();
+        const std::vector<NodeIndex> new_index = NodeOrdering::inverse(order);
+        RoadNetwork network;
+        Storage &st = network.owned_;
+
+        st.node_ids.resize(n);
+        st.lat.resize(n);
+        st.lon.resize(n);
+        st.offsets.resize(n + 1);
+        st.offsets[0] = 0;
+        for (NodeIndex u = 0; u < n; ++u)
+        {
+            const NodeIndex old = order[u];
+            st.node_ids[u] = node_ids_[old];
+            st.lat[u] = lat_[old];
+            st.lon[u] = lon_[old];
+            st.offsets[u + 1] = st.offsets[u] + (offsets_[old + 1] - offsets_[old]);
+        }
+
+        // The id map stays sorted by id; only the indices it points to move
+        st.id_map_ids.assign(id_map_ids_.begin(), id_map_ids_.end());
+        st.id_map_index.resize(n);
+        for (size_t i = 0; i < n; ++i)
+            st.id_map_index[i] = new_index[id_map_index_[i]];
+
+        st.targets.resize(num_edges());
+        st.weights.resize(num_edges());
+        st.edge_costs.resize(edge_costs_.size());
+        for (NodeIndex u = 0; u < n; ++u)
+        {
+            EdgeIndex slot = st.offsets[u];
+            for (EdgeIndex e = offsets_[order[u]]; e < offsets_[order[u] + 1]; ++e, ++slot)
+            {
+                st.targets[slot] = new_index[targets_[e]];
+                st.weights[slot] = weights_[e];
+                if (has_edge_costs())
+                    st.edge_costs[slot] = edge_costs_[e];
+            }
+        }
+
+        network.offsets_ = st.offsets;
+        network.targets_ = st.targets;
+        network.weights_ = st.weights;
+        network.edge_costs_ = st.edge_costs;
+        network.lat_ = st.lat;
+        network.lon_ = st.lon;
+        network.node_ids_ = st.node_ids;
+        network.id_map_ids_ = st.id_map_ids;
+        network.id_map_index_ = st.id_map_index;
+
+        network.build_reverse();
+        network.build_geo();
+        network.geo_.bound = geo_.bound;
+        network.init_live_weights();
+
+        // Landmark tables are node-major, so whole rows move with their node
+        if (!landmarks_.empty())
+        {
+            const size_t k = landmarks_.count;
+            std::vector<NodeIndex> landmarks(k);
+            for (size_t i = 0; i < k; ++i)
+                landmarks[i] = new_index[landmarks_.landmarks[i]];
+            std::vector<float> from(n * k), to(n * k);
+            for (NodeIndex u = 0; u < n; ++u)
+            {
+                std::copy_n(landmarks_.from.begin() + static_cast<size_t>(order[u]) * k, k, from.begin() + u * k);
+                std::copy_n(landmarks_.to.begin() + static_cast<size_t>(order[u]) * k, k, to.begin() + u * k);
+            }
+            network.set_landmarks(std::move(landmarks), std::move(from), std::move(to));
+        }
+        return network;
+    }
+
+    // --- open_mmap() verification: throw std::runtime_error naming path ---
+
+    // offsets (n + 1 entries) must run non-decreasing from 0 to heads.size() and every
+    // head must be a node index
+    static void verify_csr(std::span<const EdgeIndex> offsets, std::span<const NodeIndex> heads, size_t n,
+                           const std::string &path, const char *direction)
+    {
+        if (offsets.size() != n + 1 || offsets[0] != 0 || offsets[n] != heads.size())
+            throw std::runtime_error("'" + path + "' has inconsistent " + direction + " CSR offsets.");
+        for (size_t u = 0; u < n; ++u)
+            if (offsets[u] > offsets[u + 1])
+                throw std::runtime_error("'" + path + "' has decreasing " + direction + " CSR offsets.");
+        for (NodeIndex v : heads)
+            if (v >= n)
+                throw std::runtime_error("'" + path + "' has a " + direction + " edge endpoint out of range.");
+    }
+
+    // The id map must list every node once, in strictly ascending id order
+    static void verify_id_map(const RoadNetwork &network, const std::string &path)
+    {
+        const size_t n = network.num_nodes();
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (i > 0 && network.id_map_ids_[i - 1] >= network.id_map_ids_[i])
+                throw std::runtime_error("'" + path + "' has an id map that is not strictly ascending.");
+            const NodeIndex u = network.id_map_index_[i];
+            if (u >= n || network.node_ids_[u] != network.id_map_ids_[i])
+                throw std::runtime_error("'" + path + "' has an id map that does not match the node ids.");
+        }
+    }
+
+    // A stored reverse CSR must be exactly the transposition build_reverse() makes: slot
+    // for slot the same source, weight and cost vector. LiveWeights maps forward edges to
+    // reverse slots in that order, and the backward searches trust the stored weights.
+    static void verify_reverse(const RoadNetwork &network, const std::string &path)
+    {
+        const size_t n = network.num_nodes();
+        verify_csr(network.rev_offsets_, network.rev_sources_, n, path, "reverse");
+        std::vector<EdgeIndex> cursor(n + 1, 0);
+        for (NodeIndex v : network.targets_)
+            cursor[v + 1]++;
+        for (size_t v = 0; v < n; ++v)
+        {
+            cursor[v + 1] += cursor[v];
+            if (network.rev_offsets_[v + 1] != cursor[v + 1])
+                throw std::runtime_error("'" + path + "' has a reverse CSR that does not match the forward one.");
+        }
+        for (NodeIndex u = 0; u < n; ++u)
+        {
+            for (EdgeIndex e = network.offsets_[u]; e < network.offsets_[u + 1]; ++e)
+            {
+                const EdgeIndex slot = cursor[network.targets_[e]]++;
+                if (network.rev_sources_[slot] != u || network.rev_weights_[slot] != network.weights_[e]
+                    || (network.has_edge_costs() && network.rev_edge_costs_[slot] != network.edge_costs_[e]))
+                    throw std::runtime_error("'" + path + "' has a reverse CSR that does not match the forward one.");
+            }
+        }
+    }
+
+    // Transposes the forward CSR into owned reverse arrays (counting sort by target, so
+    // incoming edges keep ascending source order)
+    void build_reverse()
+    {
+        const size_t n = num_nodes();
+        Storage &st = owned_;
+        st.rev_offsets.assign(n + 1, 0);
+        for (NodeIndex v : targets_)
+            st.rev_offsets[v + 1]++;
+        for (size_t v = 0; v < n; ++v)
+            st.rev_offsets[v + 1] += st.rev_offsets[v];
+
+        st.rev_sources.resize(num_edges());
+        st.rev_weights.resize(num_edges());
+        st.rev_edge_costs.resize(edge_costs_.size());
+        std::vector<EdgeIndex> cursor(st.rev_offsets.begin(), st.rev_offsets.end() - 1);
+        for (NodeIndex u = 0; u < n; ++u)
+        {
+            for (EdgeIndex e = offsets_[u]; e < offsets_[u + 1]; ++e)
+            {
+                EdgeIndex slot = cursor[targets_[e]]++;
+                st.rev_sources[slot] = u;
+                st.rev_weights[slot] = weights_[e];
+                if (has_edge_costs())
+                    st.rev_edge_costs[slot] = edge_costs_[e];
+            }
+        }
+
+        rev_offsets_ = st.rev_offsets;
+        rev_sources_ = st.rev_sources;
+        rev_weights_ = st.rev_weights;
+        rev_edge_costs_ = st.rev_edge_costs;
+    }
+
+    // Calls f(i, e) for every edge e from sources[i] to targets[i]; pairs with an unknown
+    // id are skipped. values is the length of the per-pair array that goes with them.
+    template <typename F>
+    void for_each_edge_between(std::span<const long long> sources, std::span<const long long> targets,
+                               size_t values, F &&f) const
+    {
+        if (targets.size() != sources.size() || values != sources.size())
+            throw std::invalid_argument("RoadNetwork: per-edge arrays must have equal length.");
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            const NodeIndex u = index_of(sources[i]), v = index_of(targets[i]);
+            if (u == INVALID_NODE_INDEX || v == INVALID_NODE_INDEX)
+                continue;
+            for (EdgeIndex e = edge_begin(u); e < edge_end(u); ++e)
+                if (targets_[e] == v)
+                    f(i, e);
+        }
+    }
+
+    // Moves the per-node and per-edge arrays into FirstTouchArrays whose slice of domain d
+    // is written by a thread pinned to NUMA node d, so its pages live there. The id map
+    // stays in owned memory: it is only read at the API boundary. Restarts the live
+    // weights, which view the base weights.
+    void place_on_domains(const NumaTopology &topology)
+    {
+        auto placed = std::make_shared<NumaStorage>();
+        NumaStorage &st = *placed;
+        const size_t n = num_nodes(), k = landmarks_.count;
+        st.offsets = FirstTouchArray<EdgeIndex>(n + 1);
+        st.targets = FirstTouchArray<NodeIndex>(num_edges());
+        st.weights = FirstTouchArray<double>(num_edges());
+        st.edge_costs = FirstTouchArray<CostVector>(edge_costs_.size());
+        st.rev_offsets = FirstTouchArray<EdgeIndex>(n + 1);
+        st.rev_sources = FirstTouchArray<NodeIndex>(num_edges());
+        st.rev_weights = FirstTouchArray<double>(num_edges());
+        st.rev_edge_costs = FirstTouchArray<CostVector>(rev_edge_costs_.size());
+        st.lat = FirstTouchArray<double>(n);
+        st.lon = FirstTouchArray<double>(n);
+        st.lat_rad = FirstTouchArray<double>(n);
+        st.lon_rad = FirstTouchArray<double>(n);
+        st.cos_lat = FirstTouchArray<double>(n);
+        st.landmark_from = FirstTouchArray<float>(landmarks_.from.size());
+        st.landmark_to = FirstTouchArray<float>(landmarks_.to.size());
+
+        auto copy = [](auto &to, auto from, size_t begin, size_t end)
+        {
+            if (!from.empty())
+                std::copy(from.begin() + begin, from.begin() + end, to.data() + begin);
+        };
+        const size_t domains = partition_.num_domains();
+        run_on_each_node(topology,
+                         [&](size_t node)
+                         {
+                             // Nodes without a domain (more NUMA nodes than parts) place nothing
+                             for (size_t d = node; d < domains; d += topology.num_nodes())
+                             {
+                                 const NodeIndex begin = partition_.domain_begin[d];
+                                 const NodeIndex end = partition_.domain_begin[d + 1];
+                                 const size_t node_end = d + 1 == domains ? n + 1 : end;  // Last offset too
+                                 copy(st.offsets, offsets_, begin, node_end);
+                                 copy(st.rev_offsets, rev_offsets_, begin, node_end);
+                                 copy(st.targets, targets_, offsets_[begin], offsets_[end]);
+                                 copy(st.weights, weights_, offsets_[begin], offsets_[end]);
+                                 copy(st.edge_costs, edge_costs_, offsets_[begin], offsets_[end]);
+                                 copy(st.rev_sources, rev_sources_, rev_offsets_[begin], rev_offsets_[end]);
+                                 copy(st.rev_weights, rev_weights_, rev_offsets_[begin], rev_offsets_[end]);
+                                 copy(st.rev_edge_costs, rev_edge_costs_, rev_offsets_[begin], rev_offsets_[end]);
+                                 copy(st.lat, lat_, begin, end);
+                                 copy(st.lon, lon_, begin, end);
+                                 copy(st.lat_rad, geo_.lat_rad, begin, end);
+                                 copy(st.lon_rad, geo_.lon_rad, begin, end);
+                                 copy(st.cos_lat, geo_.cos_lat, begin, end);
+                                 copy(st.landmark_from, landmarks_.from, begin * k, end * k);
+                                 copy(st.landmark_to, landmarks_.to, begin * k, end * k);
+                             }
+                         });
+
+        offsets_ = st.offsets.view();
+        targets_ = st.targets.view();
+        weights_ = st.weights.view();
+        edge_costs_ = st.edge_costs.view();
+        rev_offsets_ = st.rev_offsets.view();
+        rev_sources_ = st.rev_sources.view();
+        rev_weights_ = st.rev_weights.view();
+        rev_edge_costs_ = st.rev_edge_costs.view();
+        lat_ = st.lat.view();
+        lon_ = st.lon.view();
+        geo_.lat_rad = st.lat_rad.view();
+        geo_.lon_rad = st.lon_rad.view();
+        geo_.cos_lat = st.cos_lat.view();
+        landmarks_.from = st.landmark_from.view();
+        landmarks_.to = st.landmark_to.view();
+        numa_ = std::move(placed);
+
+        // Free the owned copies the views no longer point to
+        Storage kept;
+        kept.node_ids = std::move(owned_.node_ids);
+        kept.id_map_ids = std::move(owned_.id_map_ids);
+        kept.id_map_index = std::move(owned_.id_map_index);
+        kept.landmark_ids = std::move(owned_.landmark_ids);
+        owned_ = std::move(kept);
+        init_live_weights();
+    }
+
+    // Starts the live weights at version 0, viewing the base weights (once the forward
+    // and reverse CSR are in place)
+    void init_live_weights()
+    {
+        live_ = std::make_unique<LiveWeights>(weights_, rev_weights_, offsets_, targets_, rev_offsets_);
+    }
+
+    // Derives the heuristic coordinates from the degree arrays into owned memory
+    void build_geo()
+    {
+        constexpr double DEG_TO_RAD = std::numbers::pi / 180.0;
+        const size_t n = num_nodes();
+        Storage &st = owned_;
+        st.lat_rad.resize(n);
+        st.lon_rad.resize(n);
+        st.cos_lat.resize(n);
+        for (size_t u = 0; u < n; ++u)
+        {
+            st.lat_rad[u] = lat_[u] * DEG_TO_RAD;
+            st.lon_rad[u] = lon_[u] * DEG_TO_RAD;
+            st.cos_lat[u] = std::cos(st.lat_rad[u]);
+        }
+        geo_.lat_rad = st.lat_rad;
+        geo_.lon_rad = st.lon_rad;
+        geo_.cos_lat = st.cos_lat;
+    }
+
+    // Backing memory when the network was built in memory (empty when mapped).
+    // Moving a vector keeps its buffer, so the views below survive a RoadNetwork move.
+    struct Storage
+    {
+        std::vector<EdgeIndex> offsets;
+        std::vector<NodeIndex> targets;
+        std::vector<double> weights;
+        std::vector<CostVector> edge_costs;
+        std::vector<double> lat;
+        std::vector<double> lon;
+        std::vector<double> lat_rad;
+        std::vector<double> lon_rad;
+        std::vector<double> cos_lat;
+        std::vector<long long> node_ids;
+        std::vector<long long> id_map_ids;
+        std::vector<NodeIndex> id_map_index;
+        std::vector<EdgeIndex> rev_offsets;
+        std::vector<NodeIndex> rev_sources;
+        std::vector<double> rev_weights;
+        std::vector<CostVector> rev_edge_costs;
+        std::vector<NodeIndex> landmark_ids;
+        std::vector<float> landmark_from;
+        std::vector<float> landmark_to;
+    };
+
+    // Backing memory of a NUMA-placed network (see place_on_domains)
+    struct NumaStorage
+    {
+        FirstTouchArray<EdgeIndex> offsets;
+        FirstTouchArray<NodeIndex> targets;
+        FirstTouchArray<double> weights;
+        FirstTouchArray<CostVector> edge_costs;
+        FirstTouchArray<EdgeIndex> rev_offsets;
+        FirstTouchArray<NodeIndex> rev_sources;
+        FirstTouchArray<double> rev_weights;
+        FirstTouchArray<CostVector> rev_edge_costs;
+        FirstTouchArray<double> lat;
+        FirstTouchArray<double> lon;
+        FirstTouchArray<double> lat_rad;
+        FirstTouchArray<double> lon_rad;
+        FirstTouchArray<double> cos_lat;
+        FirstTouchArray<float> landmark_from;
+        FirstTouchArray<float> landmark_to;
+    };
+
+    Storage owned_;
+    std::shared_ptr<const BinaryFormat::MappedFile> mapping_;
+    std::shared_ptr<const NumaStorage> numa_;
+
+    // Every accessor goes through these views, which point into owned_ or mapping_
+
+    // CSR adjacency: edges of u are [offsets_[u], offsets_[u + 1])
+    std::span<const EdgeIndex> offsets_;
+    std::span<const NodeIndex> targets_;
+    std::span<const double> weights_;
+
+    // Reverse CSR: incoming edges of v are [rev_offsets_[v], rev_offsets_[v + 1])
+    std::span<const EdgeIndex> rev_offsets_;
+    std::span<const NodeIndex> rev_sources_;
+    std::span<const double> rev_weights_;
+
+    // Multi-objective edge costs, empty unless the network was built with them
+    std::span<const CostVector> edge_costs_;
+    std::span<const CostVector> rev_edge_costs_;
+
+    // Coordinates (SoA, indexed by NodeIndex)
+    std::span<const double> lat_;
+    std::span<const double> lon_;
+
+    // Same coordinates in radians plus cos(lat), for the heuristics
+    GeoCoordinates geo_;
+
+    // Id map, only consulted at the API boundary
+    std::span<const long long> node_ids_;
+    std::span<const long long> id_map_ids_;
+    std::span<const NodeIndex> id_map_index_;
+
+    // ALT tables, viewing owned_ or mapping_ like the arrays above
+    LandmarkTable landmarks_;
+
+    // Lazily built snapping grid (behind a pointer: once_flag is not movable)
+    struct LazySpatialIndex
+    {
+        std::once_flag built;
+        SpatialIndex index;
+    };
+    std::unique_ptr<LazySpatialIndex> spatial_ = std::make_unique<LazySpatialIndex>();
+
+    // Published weight versions (behind a pointer: it holds atomics and a mutex, and the
+    // network must stay movable)
+    std::unique_ptr<LiveWeights> live_;
+
+    // Query results keyed by (start, goal, weights version); none unless set_path_cache().
+    // Only accessed through std::atomic_load / std::atomic_store.
+    std::shared_ptr<PathCache> path_cache_;
+
+    // Node ranges of the parts and NUMA domains; empty unless partitioned()
+    GraphPartition partition_;
 };
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "geo_coordinates.h"  // Great-circle distance on radians
+#include "graph_types.h"      // NodeIndex
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Static uniform grid over node coordinates for nearest-node snapping.
+ *
+ * The bounding box of the nodes is cut into roughly square cells (in kilometers) holding
+ * NODES_PER_CELL nodes on average. The nodes are stored cell by cell (a CSR over the
+ * cells) with their radian coordinates next to them, so a query reads a few contiguous
+ * runs instead of chasing node indices.
+ *
+ * nearest() scans rings of cells around the cell of the query point (clamped onto the
+ * grid), ring r being the cells at Chebyshev distance r. After each ring it bounds the
+ * great-circle distance to every cell not yet scanned from below, by their latitude gap
+ * and by their longitude gap at the extreme latitude, and stops once the best node found
+ * is closer than that bound. The result is the exact great-circle nearest node; equally
+ * distant nodes resolve to the lowest index. Road networks are dense enough that this
+ * takes one or two rings, i.e. a few dozen distance evaluations.
+ *
+ * Immutable once built: any number of threads may query it at once.
+ */
+class SpatialIndex
+{
+public:
+    // Average nodes per cell: more cells scan fewer nodes, but more (empty) cells per ring
+    static constexpr double NODES_PER_CELL = 2.0;
+
+    SpatialIndex() = default;
+
+    // Indexes node u at (lats[u], lons[u]) in degrees
+    SpatialIndex(std::span<const double> lats, std::span<const double> lons)
+    {
+        constexpr double DEG_TO_RAD = std::numbers::pi / 180.0;
+        const size_t n = lats.size();
+        if (n == 0)
+            return;
+
+        const auto [min_lat, max_lat] = std::minmax_element(lats.begin(), lats.end());
+        const auto [min_lon, max_lon] = std::minmax_element(lons.begin(), lons.end());
+        lat0_ = *min_lat;
+        lon0_ = *min_lon;
+        cos_far_ = std::cos(std::max(std::fabs(*min_lat), std::fabs(*max_lat)) * DEG_TO_RAD);
+
+        // Square cells in kilometers: the longitude extent shrinks by cos(latitude)
+        const double lat_span = *max_lat - *min_lat;
+        const double lon_span = *max_lon - *min_lon;
+        const double lon_scale = std::max(std::cos((*min_lat + *max_lat) * 0.5 * DEG_TO_RAD), 1e-6);
+        const double target_cells = std::max(1.0, static_cast<double>(n) / NODES_PER_CELL);
+        const double area = lat_span * lon_span * lon_scale;
+        double cell = area > 0.0 ? std::sqrt(area / target_cells)
+                                 : std::max(lat_span, lon_span * lon_scale) / target_cells;
+        rows_ = cell > 0.0 ? static_cast<size_t>(std::ceil(lat_span / cell)) : 1;
+        cols_ = cell > 0.0 ? static_cast<size_t>(std::ceil(lon_span * lon_scale / cell)) : 1;
+        rows_ = std::clamp<size_t>(rows_, 1, n);
+        cols_ = std::clamp<size_t>(cols_, 1, n);
+        cell_lat_ = lat_span > 0.0 ? lat_span / rows_ : 1.0;
+        cell_lon_ = lon_span > 0.0 ? lon_span / cols_ : 1.0;
+
+        // Counting sort of the nodes by cell, ascending index within a cell
+        std::vector<size_t> cell_of(n);
+        cell_offsets_.assign(rows_ * cols_ + 1, 0);
+        for (size_t u = 0; u < n; ++u)
+        {
+            cell_of[u] = row_of(lats[u]) * cols_ + col_of(lons[u]);
+            cell_offsets_[cell_of[u] + 1]++;
+        }
+        for (size_t c = 0; c < rows_ * cols_; ++c)
+            cell_offsets_[c + 1] += cell_offsets_[c];
+
+        nodes_.resize(n);
+        lat_rad_.resize(n);
+        lon_rad_.resize(n);
+        cos_lat_.resize(n);
+        std::vector<std::uint32_t> cursor(cell_offsets_.begin(), cell_offsets_.end() - 1);
+        for (size_t u = 0; u < n; ++u)
+        {
+            const std::uint32_t slot = cursor[cell_of[u]]++;
+            nodes_[slot] = static_cast<NodeIndex>(u);
+            lat_rad_[slot] = lats[u] * DEG_TO_RAD;
+            lon_rad_[slot] = lons[u] * DEG_TO_RAD;
+            cos_lat_[slot] = std::cos(lat_rad_[slot]);
+        }
+    }
+
+    bool empty() const { return nodes_.empty(); }
+
+    size_t size() const { return nodes_.size(); }
+
+    // Number of grid cells (rows x columns)
+    size_t num_cells() const { return rows_ * cols_; }
+
+    // Great-circle nearest node to (lat, lon) in degrees; INVALID_NODE_INDEX if empty
+    NodeIndex nearest(double lat, double lon) const
+    {
+        constexpr double DEG_TO_RAD = std::numbers::pi / 180.0;
+        constexpr double INF = std::numeric_limits<double>::infinity();
+        if (empty())
+            return INVALID_NODE_INDEX;
+
+        const double lat_rad = lat * DEG_TO_RAD, lon_rad = lon * DEG_TO_RAD;
+        const double cos_lat = std::cos(lat_rad);
+        const double cos_far = std::min(cos_far_, cos_lat);  // Smallest cos(latitude) of any pair
+        const long row = static_cast<long>(row_of(lat)), col = static_cast<long>(col_of(lon));
+        const long rows = static_cast<long>(rows_), cols = static_cast<long>(cols_);
+        const long last_ring = std::max({row, rows - 1 - row, col, cols - 1 - col});
+
+        double best = INF;
+        NodeIndex best_node = INVALID_NODE_INDEX;
+        auto scan = [&](long r, long c)
+        {
+            const size_t cell = static_cast<size_t>(r) * cols_ + static_cast<size_t>(c);
+            for (std::uint32_t i = cell_offsets_[cell]; i < cell_offsets_[cell + 1]; ++i)
+            {
+                const double d = GeoCoordinates::haversine_km(lat_rad, lon_rad, cos_lat, lat_rad_[i], lon_rad_[i],
+                                                               cos_lat_[i]);
+                if (d < best || (d == best && nodes_[i] < best_node))
+                {
+                    best = d;
+                    best_node = nodes_[i];
+                }
+            }
+        };
+
+        for (long ring = 0; ring <= last_ring; ++ring)
+        {
+            // Cells at Chebyshev distance ring, clipped to the grid
+            for (long r = std::max(0L, row - ring); r <= std::min(rows - 1, row + ring); ++r)
+            {
+                if (r == row - ring || r == row + ring)
+                {
+                    for (long c = std::max(0L, col - ring); c <= std::min(cols - 1, col + ring); ++c)
+                        scan(r, c);
+                }
+                else
+                {
+                    if (col - ring >= 0)
+                        scan(r, col - ring);
+                    if (col + ring < cols)
+                        scan(r, col + ring);
+                }
+            }
+
+            // Every cell left lies beyond one of the four ring edges that still has cells behind it
+            double lat_gap = INF, lon_gap = INF;
+            if (row - ring > 0)
+                lat_gap = std::min(lat_gap, lat - (lat0_ + (row - ring) * cell_lat_));
+            if (row + ring < rows - 1)
+                lat_gap = std::min(lat_gap, lat0_ + (row + ring + 1) * cell_lat_ - lat);
+            if (col - ring > 0)
+                lon_gap = std::min(lon_gap, lon - (lon0_ + (col - ring) * cell_lon_));
+            if (col + ring < cols - 1)
+                lon_gap = std::min(lon_gap, lon0_ + (col + ring + 1) * cell_lon_ - lon);
+
+            double bound = INF;
+            if (lat_gap < INF)
+                bound = std::min(bound, std::max(0.0, lat_gap) * DEG_TO_RAD * GeoCoordinates::EARTH_RADIUS_KM);
+            if (lon_gap < INF)
+            {
+                const double half = std::min(std::max(0.0, lon_gap) * DEG_TO_RAD, std::numbers::pi) * 0.5;
+                bound = std::min(bound, 2.0 * GeoCoordinates::EARTH_RADIUS_KM
+                                            * std::asin(std::min(1.0, cos_far * std::sin(half))));
+            }
+            // The slack absorbs rounding of the cell edges against the stored coordinates
+            if (best < bound * (1.0 - 1e-9))
+                break;
+        }
+        return best_node;
+    }
+
+private:
+    // Row / column of a coordinate, clamped onto the grid
+    size_t row_of(double lat) const
+    {
+        const double r = std::floor((lat - lat0_) / cell_lat_);
+        return r <= 0.0 ? 0 : std::min(rows_ - 1, static_cast<size_t>(r));
+    }
+
+    size_t col_of(double lon) const
+    {
+        const double c = std::floor((lon - lon0_) / cell_lon_);
+        return c <= 0.0 ? 0 : std::min(cols_ - 1, static_cast<size_t>(c));
+    }
+
+    double lat0_ = 0.0, lon0_ = 0.0;          // South-west corner of the grid, degrees
+    double cell_lat_ = 1.0, cell_lon_ = 1.0;  // Cell size, degrees
+    double cos_far_ = 1.0;                     // cos of the largest |latitude| of any node
+    size_t rows_ = 0, cols_ = 0;
+
+    std::vector<std::uint32_t> cell_offsets_;  // Nodes of cell c are [cell_offsets_[c], cell_offsets_[c + 1])
+    std::vector<NodeIndex> nodes_;
+    std::vector<double> lat_rad_;
+    std::vector<double> lon_rad_;
+    std::vector<double> cos_lat_;
+};
@@ -0,0 +1,277 @@
+#pragma once
+
+#include "numa.h"  // CPU order for pinning across NUMA nodes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @brief Persistent pool of worker threads for data-parallel loops.
+ *
+ * Workers are started once and sleep on a condition variable between jobs, so
+ * submitting work costs a wake-up instead of a thread creation. A job is a loop
+ * body plus an iteration count; iterations are handed out one at a time from a shared
+ * atomic counter, which balances uneven work (e.g. queries of different length).
+ * The calling thread takes part in the loop as well.
+ *
+ * parallel_for() doubles as the fork-join primitive of the parallel searches: the job
+ * descriptor lives on the caller's stack and the body is passed by pointer, so a fork
+ * allocates nothing. Idle workers spin for a short while before sleeping, because
+ * per-expansion forks arrive only microseconds apart.
+ *
+ * One job runs at a time; concurrent callers queue up behind it. A parallel_for()
+ * issued from inside a job runs inline on the calling worker, so nesting cannot
+ * deadlock.
+ */
+class ThreadPool
+{
+public:
+    // Iterations an idle worker polls for new work before blocking
+    static constexpr int SPIN_LIMIT = 4000;
+
+    // Starts `num_workers` background threads (the caller acts as one more).
+    // With pin_threads, worker i is bound to entry (i + 1) mod #CPUs of pinning_order(),
+    // leaving the first CPU for the caller; pinning is a no-op on platforms without
+    // thread affinity.
+    explicit ThreadPool(size_t num_workers, bool pin_threads = false)
+    {
+        workers_.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i)
+        {
+            workers_.emplace_back([this, i] { worker_loop(i); });
+            if (pin_threads)
+                pin_to_cpu(workers_.back(), i + 1);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread &worker : workers_)
+            worker.join();
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Process-wide pool, sized to the hardware unless configure() was called first
+    static ThreadPool &instance() { return *global(); }
+
+    // Replaces the process-wide pool with one of `num_threads` threads including the caller
+    // (0 = hardware concurrency). Must not be called while searches are running.
+    static void configure(size_t num_threads, bool pin_threads)
+    {
+        if (num_threads == 0)
+            num_threads = default_threads();
+        global().reset();  // Join the old workers before starting new ones
+        global() = std::make_unique<ThreadPool>(num_threads - 1, pin_threads);
+    }
+
+    // Number of threads a job can use, including the caller
+    size_t concurrency() const { return workers_.size() + 1; }
+
+    // Threads a parallel_for() issued from the calling thread really runs on at once: 1 when
+    // nested inside a job. Bodies that wait on each other must not use more iterations.
+    size_t max_parallelism() const { return current_pool() == this ? 1 : concurrency(); }
+
+    /**
+     * @brief Calls body(i) for every i in [0, count) and returns when all calls finished.
+     * @param max_threads Upper bound on participating threads including the caller
+     *                    (0 = the whole pool).
+     *
+     * The first exception thrown by body stops the hand-out of further iterations and
+     * is rethrown here once the running iterations have drained.
+     */
+    template <typename Body>
+    void parallel_for(size_t count, Body &&body, size_t max_threads = 0)
+    {
+        using BodyType = std::remove_reference_t<Body>;
+
+        if (count == 0)
+            return;
+        size_t threads = (max_threads == 0) ? concurrency() : std::min(max_threads, concurrency());
+        threads = std::min(threads, count);
+        if (threads <= 1 || current_pool() == this)
+        {
+            for (size_t i = 0; i < count; ++i)
+                body(i);
+            return;
+        }
+
+        // The job lives on this stack frame; no allocation per submission
+        Job job;
+        job.count = count;
+        job.helpers = threads - 1;
+        job.context = &body;
+        job.invoke = [](void *context, size_t i) { (*static_cast<BodyType *>(context))(i); };
+
+        std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            generation_.fetch_add(1, std::memory_order_release);
+        }
+        wake_.notify_all();
+
+        // The caller counts as a pool thread while it helps, so nested calls run inline
+        ThreadPool *outer = current_pool();
+        current_pool() = this;
+        run(job);
+        current_pool() = outer;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_ = nullptr;  // Late wakers see no job and go back to sleep
+            done_.wait(lock, [&] { return job.running == 0; });
+        }
+        if (job.error)
+            std::rethrow_exception(job.error);
+    }
+
+private:
+    struct Job
+    {
+        void (*invoke)(void *, size_t) = nullptr;
+        void *context = nullptr;
+        size_t count = 0;
+        size_t helpers = 0;  // Workers with index < helpers may join
+        size_t running = 0;  // Workers currently inside run(), guarded by mutex_
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+    };
+
+    static size_t default_threads() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+    static std::unique_ptr<ThreadPool> &global()
+    {
+        static std::unique_ptr<ThreadPool> pool = std::make_unique<ThreadPool>(default_threads() - 1);
+        return pool;
+    }
+
+    // The CPUs of the NUMA nodes taken in turn (node 0's first, node 1's first, ...), so
+    // that a pool of any size has workers on every node; 0, 1, 2, ... on a single node
+    static const std::vector<int> &pinning_order()
+    {
+        static const std::vector<int> order = []
+        {
+            const NumaTopology &topology = NumaTopology::system();
+            std::vector<int> cpus;
+            for (size_t i = 0; cpus.size() < default_threads(); ++i)
+            {
+                const size_t before = cpus.size();
+                for (size_t node = 0; node < topology.num_nodes(); ++node)
+                    if (i < topology.cpus(node).size())
+                        cpus.push_back(topology.cpus(node)[i]);
+                if (cpus.size() == before)
+                    break;
+            }
+            return cpus;
+        }();
+        return order;
+    }
+
+    static void pin_to_cpu([[maybe_unused]] std::thread &thread, [[maybe_unused]] size_t slot)
+    {
+#ifdef __linux__
+        const std::vector<int> &order = pinning_order();
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(order.empty() ? slot % default_threads() : order[slot % order.size()], &cpus);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);  // Best effort
+#endif
+    }
+
+    static void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // Pool the current thread works for, nullptr outside of pool workers
+    static ThreadPool *&current_pool()
+    {
+        thread_local ThreadPool *pool = nullptr;
+        return pool;
+    }
+
+    static void run(Job &job)
+    {
+        for (size_t i = job.next.fetch_add(1, std::memory_order_relaxed); i < job.count;
+             i = job.next.fetch_add(1, std::memory_order_relaxed))
+        {
+            try
+            {
+                job.invoke(job.context, i);
+            }
+            catch (...)
+            {
+                if (!job.failed.exchange(true))
+                    job.error = std::current_exception();
+                job.next.store(job.count, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void worker_loop(size_t index)
+    {
+        current_pool() = this;
+        std::uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            // Poll without the lock first; sleep only if nothing arrives
+            lock.unlock();
+            for (int spin = 0; spin < SPIN_LIMIT && !stop_.load(std::memory_order_relaxed)
+                               && generation_.load(std::memory_order_acquire) == seen;
+                 ++spin)
+                cpu_relax();
+            lock.lock();
+
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_)
+                return;
+            seen = generation_;
+            Job *job = job_;
+            if (job == nullptr || index >= job->helpers)
+                continue;
+
+            ++job->running;
+            lock.unlock();
+            run(*job);
+            lock.lock();
+            if (--job->running == 0)
+                done_.notify_all();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+
+    std::mutex submit_mutex_;  // Serialises submitters
+    std::mutex mutex_;         // Guards job_, generation_, stop_ and Job::running
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    Job *job_ = nullptr;
+    std::atomic<std::uint64_t> generation_{0};  // Written under mutex_, polled without it
+    std::atomic<bool> stop_{false};
+};
@@ -1,15 +1,129 @@
 #include "demo/astar.h"    // A* algorithm implementation
+#include "demo/batch_search.h"
+#include "demo/contraction_hierarchy.h"
+#include "demo/delta_stepping.h"
+#include "demo/dstar_lite.h"
+#include "demo/landmarks.h"
 #include "demo/aStarWithDynamicCostFunction.h"
+#include "demo/aStarWithVectorFunction.h"
 #include "graph_types.h"   // Node, Edge definitions
 #include "road_network.h"  // RoadNetwork class definition
+#include "thread_pool.h"   // Process-wide worker pool
 
+#include <pybind11/numpy.h>  // NumPy array arguments
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>  // Automatic conversion for STL containers (vector, map)
 
+#include <limits>   // Default cost cap (infinity)
+#include <optional>
 #include <sstream>  // Required for std::ostringstream in __repr__
 
 namespace py = pybind11;
 
+// Policies of the exported A* engine instantiations (astar_engine.h)
+using AStarEngine::DefaultOpenSet;
+using AStarEngine::DynamicCostHeuristic;
+using AStarEngine::EdgeWeightCost;
+using AStarEngine::GreatCircleHeuristic;
+using AStarEngine::StatsRecorder;
+
+// Hands a vector's buffer to NumPy without copying; the capsule owns the vector
+template <typename T>
+py::array_t<T> vector_to_numpy(std::vector<T> &&values)
+{
+    auto *owned = new std::vector<T>(std::move(values));
+    py::capsule owner(owned, [](void *p) { delete static_cast<std::vector<T> *>(p); });
+    return py::array_t<T>(static_cast<py::ssize_t>(owned->size()), owned->data(), owner);
+}
+
+// Same for a row-major rows x cols matrix
+template <typename T>
+py::array_t<T> matrix_to_numpy(std::vector<T> &&values, size_t rows, size_t cols)
+{
+    auto *owned = new std::vector<T>(std::move(values));
+    py::capsule owner(owned, [](void *p) { delete static_cast<std::vector<T> *>(p); });
+    return py::array_t<T>({static_cast<py::ssize_t>(rows), static_cast<py::ssize_t>(cols)}, owned->data(), owner);
+}
+
+// One query's SearchStats as a dict; lock waits and phases in seconds
+py::dict stats_to_dict(const AStarEngine::SearchStats &stats)
+{
+    using AStarEngine::LockSite;
+    using AStarEngine::Phase;
+    auto lock_index = [](LockSite site) { return static_cast<size_t>(site); };
+    auto phase_index = [](Phase phase) { return static_cast<size_t>(phase); };
+
+    py::dict lock_wait, lock_acquisitions, phases;
+    const std::pair<const char *, LockSite> locks[] = {{"open_set", LockSite::OPEN_SET},
+                                                       {"meeting_point", LockSite::MEETING_POINT},
+                                                       {"concurrent_open_set", LockSite::CONCURRENT_OPEN_SET}};
+    for (const auto &[name, site] : locks)
+    {
+        lock_wait[name] = stats.lock_wait_ns[lock_index(site)] * 1e-9;
+        lock_acquisitions[name] = stats.lock_acquisitions[lock_index(site)];
+    }
+    const std::pair<const char *, Phase> timed[] = {{"setup", Phase::SETUP},
+                                                    {"search", Phase::SEARCH},
+                                                    {"path", Phase::PATH},
+                                                    {"parallel_relax", Phase::PARALLEL_RELAX}};
+    for (const auto &[name, phase] : timed)
+        phases[name] = stats.phase_ns[phase_index(phase)] * 1e-9;
+
+    py::dict result;
+    result["expanded"] = stats.expanded;
+    result["reopened"] = stats.reopened;
+    result["pushes"] = stats.pushes;
+    result["decrease_keys"] = stats.decrease_keys;
+    result["pops"] = stats.pops;
+    result["stale_pops"] = stats.stale_pops;
+    result["peak_open"] = stats.peak_open;
+    result["messages"] = stats.messages;
+    result["lock_wait_s"] = lock_wait;
+    result["lock_acquisitions"] = lock_acquisitions;
+    result["phase_s"] = phases;
+    return result;
+}
+
+using SearchWithStats = std::vector<long long> (*)(const RoadNetwork &, long long, long long, StatsRecorder &);
+using ParallelSearchWithStats = std::vector<long long> (*)(const RoadNetwork &, long long, long long, int,
+                                                           StatsRecorder &);
+
+// Binds name(network, start_node, goal_node) -> (path, stats dict) for a StatsRecorder instantiation
+void def_with_stats(py::module_ &module, const char *name, SearchWithStats search, const char *doc)
+{
+    module.def(
+        name,
+        [search](const RoadNetwork &network, long long start_node, long long goal_node)
+        {
+            StatsRecorder stats;
+            std::vector<long long> path;
+            {
+                py::gil_scoped_release release;  // Search runs without the GIL
+                path = search(network, start_node, goal_node, stats);
+            }
+            return py::make_tuple(std::move(path), stats_to_dict(stats.result()));
+        },
+        doc, py::arg("network"), py::arg("start_node"), py::arg("goal_node"));
+}
+
+// Same for the parallel engines, which take num_threads
+void def_with_stats(py::module_ &module, const char *name, ParallelSearchWithStats search, const char *doc)
+{
+    module.def(
+        name,
+        [search](const RoadNetwork &network, long long start_node, long long goal_node, int num_threads)
+        {
+            StatsRecorder stats;
+            std::vector<long long> path;
+            {
+                py::gil_scoped_release release;  // Search runs without the GIL
+                path = search(network, start_node, goal_node, num_threads, stats);
+            }
+            return py::make_tuple(std::move(path), stats_to_dict(stats.result()));
+        },
+        doc, py::arg("network"), py::arg("start_node"), py::arg("goal_node"), py::arg("num_threads"));
+}
+
 // ==============================================================================
 // Module Definition
 // ==============================================================================
@@ -42,9 +156,14 @@ PYBIND11_MODULE(assignment2_cpp, m)
     py::class_<Edge>(m, "Edge", "Represents a directed edge with target node and weight")
         .def(py::init<long long, double>(), py::arg("target_node_id") = 0, py::arg("weight") = 0.0,
              "Edge constructor")
+        .def(py::init<long long, double, const CostVector &>(), py::arg("target_node_id"),
+             py::arg("weight"), py::arg("costs"),
+             "Edge constructor with a (distance, time, toll) cost vector")
         .def_readwrite("target_node_id", &Edge::target_node_id,
                        "ID of the node this edge points to")
         .def_readwrite("weight", &Edge::weight, "Cost associated with traversing this edge")
+        .def_readwrite("costs", &Edge::costs,
+                       "Multi-objective cost (distance, time, toll); (weight, 0, 0) unless given")
         .def(
             "__repr__",
             [](const Edge &e)
@@ -55,25 +174,239 @@ PYBIND11_MODULE(assignment2_cpp, m)
             },
             "String representation of the Edge");
 
+    // ==========================================================================
+    // Heuristic Bound Enum Binding
+    // ==========================================================================
+    py::enum_<GeoBound>(m, "GeoBound", "Geographic lower bound used by the A* heuristics")
+        .value("Haversine", GeoBound::Haversine, "Great-circle distance")
+        .value("Equirectangular", GeoBound::Equirectangular,
+               "Cheaper trigonometry-free bound, slightly below the great-circle distance");
+
+    // ==========================================================================
+    // Node Order Enum Binding
+    // ==========================================================================
+    py::enum_<NodeOrder>(m, "NodeOrder", "Layout of the dense node indices of a RoadNetwork")
+        .value("Id", NodeOrder::Id, "Ascending OSM id")
+        .value("Hilbert", NodeOrder::Hilbert, "Along a Hilbert curve over (lat, lon)")
+        .value("BreadthFirst", NodeOrder::BreadthFirst, "Breadth-first over the undirected graph")
+        .value("ReverseCuthillMcKee", NodeOrder::ReverseCuthillMcKee,
+               "Bandwidth-reducing reverse Cuthill-McKee order");
+
     // ==========================================================================
     // RoadNetwork Class Binding
     // ==========================================================================
     py::class_<RoadNetwork>(m, "RoadNetwork", "Manages the road network graph and node data")
         // Bind the constructor taking Python dictionaries
-        .def(py::init<const py::dict &, const py::dict &>(), py::arg("graph_dict"),
-             py::arg("nodes_dict"),
+        .def(py::init<const py::dict &, const py::dict &, NodeOrder>(), py::arg("graph_dict"),
+             py::arg("nodes_dict"), py::arg("order") = NodeOrder::Id,
              R"(Constructs the RoadNetwork from Python dictionaries.
                 graph_dict format: {node_id: [(neighbor_id, weight), ...]}
-                nodes_dict format: {node_id: (latitude, longitude)})")
+                    or {node_id: [(neighbor_id, weight, (distance, time, toll)), ...]}
+                nodes_dict format: {node_id: (latitude, longitude)}
+                order: NodeOrder of the dense node indices (memory layout only))")
+
+        // Bind the NumPy constructor (buffer protocol, GIL released while building)
+        .def(py::init(&RoadNetwork::from_numpy), py::arg("node_ids"), py::arg("lats"),
+             py::arg("lons"), py::arg("sources"), py::arg("targets"), py::arg("weights"),
+             py::arg("costs") = py::none(), py::arg("order") = NodeOrder::Id,
+             R"(Constructs the RoadNetwork from 1-D NumPy arrays without per-element conversion.
+                node_ids/lats/lons: one entry per node (int64, float64, float64)
+                sources/targets/weights: one entry per directed edge (int64, int64, float64)
+                costs: optional (num_edges, 3) float64 array of (distance, time, toll) costs
+                order: NodeOrder of the dense node indices (memory layout only))")
 
         // Bind accessor methods (useful for inspection from Python)
-        // Use reference_internal policy: Python gets access but C++ (RoadNetwork) owns the memory
-        .def("get_node", &RoadNetwork::get_node, py::return_value_policy::reference_internal,
+        // Nodes/edges live in flat CSR arrays, so these return copies built on demand
+        .def("get_node", &RoadNetwork::get_node,
              "Get Node details by ID, returns None if not found.", py::arg("node_id"))
         .def("get_neighbors", &RoadNetwork::get_neighbors,
-             py::return_value_policy::reference_internal,
              "Get a list of outgoing Edges for a node ID, returns None if node not found.",
-             py::arg("node_id"));
+             py::arg("node_id"))
+        .def_property_readonly("num_nodes", &RoadNetwork::num_nodes, "Number of nodes")
+        .def_property_readonly("num_edges", &RoadNetwork::num_edges, "Number of directed edges")
+        .def_property_readonly(
+            "node_ids",
+            [](py::object self)
+            {
+                std::span<const long long> ids = self.cast<const RoadNetwork &>().node_ids();
+                // Read-only view into the network (mapped file or owned array), which it keeps alive
+                py::array_t<long long> view(static_cast<py::ssize_t>(ids.size()), ids.data(), self);
+                view.attr("setflags")(py::arg("write") = false);
+                return view;
+            },
+            "Node IDs in dense index order (read-only NumPy view); distance arrays are indexed alike")
+        .def_property_readonly("has_edge_costs", &RoadNetwork::has_edge_costs,
+                               "True if edges carry (distance, time, toll) cost vectors")
+        .def("save_binary", &RoadNetwork::save_binary, py::arg("path"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Writes the network in the binary format loaded by open_mmap")
+        .def_static("open_mmap", &RoadNetwork::open_mmap, py::arg("path"), py::arg("verify") = true,
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Memory-maps a network written by save_binary (read-only, zero-copy). verify checks "
+                    "every stored index in one pass and raises RuntimeError for a corrupt file; "
+                    "verify=False opens in O(1) for trusted files.")
+        .def_property_readonly("is_mapped", &RoadNetwork::is_mapped,
+                               "True if the network views a memory-mapped file")
+        .def("nearest_node", &RoadNetwork::nearest_node, py::arg("lat"), py::arg("lon"),
+             "OSM id of the node nearest to (lat, lon) in degrees by great-circle distance, or "
+             "None if the network is empty. The first call builds the spatial grid.")
+        .def(
+            "nearest_nodes",
+            [](const RoadNetwork &network, const py_array<double> &lats, const py_array<double> &lons,
+               int num_threads)
+            {
+                auto lats_view = numpy_span(lats, "lats");
+                auto lons_view = numpy_span(lons, "lons");
+                std::vector<long long> ids;
+                {
+                    py::gil_scoped_release release;
+                    ids = network.nearest_nodes(lats_view, lons_view, num_threads);
+                }
+                return vector_to_numpy(std::move(ids));
+            },
+            py::arg("lats"), py::arg("lons"), py::arg("num_threads") = 0,
+            "Snaps every point (lats[i], lons[i]) (1-D NumPy arrays, degrees) to its nearest node "
+            "in parallel with the GIL released. Returns an int64 NumPy array of OSM ids.")
+        .def("reordered", &RoadNetwork::reordered, py::arg("order"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Copy of the network with its node indices renumbered in `order` (Hilbert, "
+             "BreadthFirst, ...) so that searches touch fewer cache lines. Ids, edges and "
+             "landmarks are unchanged; the copy starts at the base weights.")
+        // Multi-socket servers: geometric parts grouped into NUMA domains
+        .def("partitioned", &RoadNetwork::partitioned, py::arg("num_parts"), py::arg("place_on_numa") = true,
+             py::call_guard<py::gil_scoped_release>(),
+             "Copy of the network split into `num_parts` geometric parts (recursive coordinate "
+             "bisection), grouped into one NUMA domain per socket. With place_on_numa the arrays "
+             "of each domain are first-touched on its node, and HDA* / search_many / "
+             "distance_matrix route work to the workers of the owning socket (pin the pool with "
+             "configure_thread_pool(pin_threads=True)). The copy starts at the base weights.")
+        .def_property_readonly(
+            "partition_quality",
+            [](const RoadNetwork &network)
+            {
+                const PartitionQuality quality = network.partition_quality();
+                py::dict result;
+                result["num_parts"] = quality.part_nodes.size();
+                result["num_domains"] = std::max<size_t>(network.partition().num_domains(), 1);
+                result["part_nodes"] = quality.part_nodes;
+                result["part_edges"] = quality.part_edges;
+                result["part_cut_edges"] = quality.part_cut_edges;
+                result["cut_edges"] = quality.cut_edges;
+                result["cross_domain_edges"] = quality.cross_domain_edges;
+                result["cut_fraction"] = quality.cut_fraction;
+                result["node_imbalance"] = quality.node_imbalance;
+                result["edge_imbalance"] = quality.edge_imbalance;
+                return result;
+            },
+            "Balance and cut of the partition as a dict: per-part nodes / edges / cut edges, total "
+            "cut and cross-domain edges, cut fraction, and largest-to-mean part ratios")
+        .def_property_readonly("is_numa_placed", &RoadNetwork::is_numa_placed,
+                               "True if the partition's domains were first-touched on their NUMA nodes")
+        .def("build_landmarks", &Landmarks::preprocess, py::arg("count") = 16,
+             py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+             "ALT preprocessing: picks `count` far-apart landmarks and stores forward/backward "
+             "distance tables with the network (saved by save_binary). All searches then use "
+             "the tighter landmark heuristic. Call before starting searches.")
+        .def_property_readonly(
+            "num_landmarks", [](const RoadNetwork &network) { return network.landmarks().count; },
+            "Number of ALT landmarks attached to the network (0 = plain heuristic)")
+        // Live traffic: every call publishes a new weight version without blocking searches
+        .def_property_readonly("weights_version", &RoadNetwork::weights_version,
+                               "Version of the live weights (0 = base weights, +1 per update)")
+        .def("update_traffic", &RoadNetwork::update_traffic_numpy, py::arg("sources"),
+             py::arg("targets"), py::arg("weights"),
+             "Publishes live weights for the edges sources[i] -> targets[i] (OSM ids, 1-D NumPy "
+             "arrays) in one batch. Weights below the base weight are clamped to it. Running "
+             "searches keep the weights they started with. Returns the number of edges updated.")
+        .def("clear_traffic", &RoadNetwork::clear_traffic, py::call_guard<py::gil_scoped_release>(),
+             "Drops all live updates (time-dependent profiles stay)")
+        // Query cache: repeated (start, goal) pairs of AStar_search / search_many skip the search
+        .def("set_path_cache", &RoadNetwork::set_path_cache, py::arg("capacity"),
+             "Attaches an LRU cache of up to `capacity` (start, goal) results to the network, "
+             "used by demo.AStar_search and demo.search_many (0 removes it). Every weight update "
+             "empties it. Safe while searches run: they finish with the cache they started with.",
+             py::call_guard<py::gil_scoped_release>())
+        .def("clear_path_cache", &RoadNetwork::clear_path_cache, py::call_guard<py::gil_scoped_release>(),
+             "Drops every cached result; the counters are kept")
+        .def_property_readonly(
+            "path_cache_stats",
+            [](const RoadNetwork &network) -> std::optional<py::dict>
+            {
+                const std::shared_ptr<PathCache> cache = network.path_cache();
+                if (cache == nullptr)
+                    return std::nullopt;
+                const PathCache::Stats stats = cache->stats();
+                py::dict result;
+                result["hits"] = stats.hits;
+                result["misses"] = stats.misses;
+                result["insertions"] = stats.insertions;
+                result["evictions"] = stats.evictions;
+                result["size"] = stats.size;
+                result["capacity"] = stats.capacity;
+                return result;
+            },
+            "Counters of the path cache as a dict (hits, misses, insertions, evictions, size, "
+            "capacity), or None without a cache")
+        .def(
+            "set_traffic_profiles",
+            [](RoadNetwork &network, const std::vector<std::vector<std::pair<float, float>>> &profiles,
+               const py_array<long long> &sources, const py_array<long long> &targets,
+               const py_array<ProfileId> &profile_ids)
+            {
+                TrafficProfiles table;
+                for (const auto &profile : profiles)
+                {
+                    std::vector<TrafficProfiles::Breakpoint> breakpoints;
+                    for (const auto &[time_s, factor] : profile)
+                        breakpoints.push_back({time_s, factor});
+                    table.add(breakpoints);
+                }
+                auto sources_view = numpy_span(sources, "sources");
+                auto targets_view = numpy_span(targets, "targets");
+                auto ids_view = numpy_span(profile_ids, "profile_ids");
+                py::gil_scoped_release release;
+                network.set_traffic_profiles(std::move(table), sources_view, targets_view, ids_view);
+            },
+            py::arg("profiles"), py::arg("sources"), py::arg("targets"), py::arg("profile_ids"),
+            R"(Attaches time-dependent weight profiles.
+                profiles: list of profiles, each a list of (seconds_since_midnight, factor)
+                    breakpoints in increasing time; profile i gets id i + 1 (0 = flat)
+                sources/targets/profile_ids: the profile of each edge (int64, int64, uint16);
+                    other edges stay flat)")
+        .def("set_traffic_time", &RoadNetwork::set_traffic_time, py::arg("time_s"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Publishes the profile weights at time_s (seconds since midnight)")
+        .def_property(
+            "geo_bound", [](const RoadNetwork &network) { return network.geo().bound; },
+            &RoadNetwork::set_geo_bound,
+            "Geographic bound of the heuristics (GeoBound.Haversine by default). Set it before "
+            "starting searches.");
+
+    // ==========================================================================
+    // Thread Pool Configuration
+    // ==========================================================================
+    m.def("configure_thread_pool", &ThreadPool::configure,
+          "Recreate the worker pool shared by all parallel searches. num_threads counts the "
+          "calling thread (0 = hardware concurrency); pin_threads binds workers to CPUs, spread "
+          "over the NUMA nodes in turn. Call "
+          "it before starting searches, not while they run.",
+          py::arg("num_threads") = 0, py::arg("pin_threads") = false,
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("thread_pool_size", []() { return ThreadPool::instance().concurrency(); },
+          "Number of threads (including the caller) available to parallel searches");
+
+    m.def(
+        "numa_nodes",
+        []()
+        {
+            const NumaTopology &topology = NumaTopology::system();
+            std::vector<std::vector<int>> nodes;
+            for (size_t node = 0; node < topology.num_nodes(); ++node)
+                nodes.push_back(topology.cpus(node));
+            return nodes;
+        },
+        "CPUs of each NUMA node as read from sysfs (one node with every CPU if unavailable)");
 
     // ==========================================================================
     // Algorithm Bindings (within a submodule)
@@ -82,105 +415,435 @@ PYBIND11_MODULE(assignment2_cpp, m)
 
     // --- Bind A* search function ---
 
+    // ---- Bounded-suboptimal A* (weighted / focal) with limits ----
+    py::enum_<AStarEngine::BoundedMode>(demo_m, "BoundedMode", "How AStar_search_bounded trades cost for speed")
+        .value("WEIGHTED", AStarEngine::BoundedMode::WEIGHTED, "Weighted A*: expands by g + epsilon * h")
+        .value("FOCAL", AStarEngine::BoundedMode::FOCAL,
+               "Focal search: expands the node closest to the goal among those within epsilon of the best f");
+
+    py::enum_<AStarEngine::SearchStatus>(demo_m, "SearchStatus", "Why AStar_search_bounded returned")
+        .value("FOUND", AStarEngine::SearchStatus::FOUND, "The path reaches the goal")
+        .value("UNREACHABLE", AStarEngine::SearchStatus::UNREACHABLE, "No path exists")
+        .value("EXPANSION_LIMIT", AStarEngine::SearchStatus::EXPANSION_LIMIT, "max_expansions was reached")
+        .value("DEADLINE", AStarEngine::SearchStatus::DEADLINE, "time_limit_s elapsed")
+        .value("COST_CAP", AStarEngine::SearchStatus::COST_CAP, "No path within cost_cap");
+
+    py::class_<AStarEngine::SearchResult>(demo_m, "SearchResult", "Outcome of AStar_search_bounded")
+        .def_readonly("status", &AStarEngine::SearchResult::status, "SearchStatus")
+        .def_readonly("path", &AStarEngine::SearchResult::path,
+                      "Node IDs from the start: to the goal if FOUND, to the expanded node closest to the "
+                      "goal if a limit was hit, empty otherwise")
+        .def_readonly("cost", &AStarEngine::SearchResult::cost, "Cost of path (inf if empty)")
+        .def_readonly("expanded", &AStarEngine::SearchResult::expanded, "Nodes expanded");
+
+    demo_m.def(
+        "AStar_search_bounded",
+        [](const RoadNetwork &network, long long start_node, long long goal_node, double epsilon,
+           AStarEngine::BoundedMode mode, std::uint64_t max_expansions, double time_limit_s, double cost_cap)
+        {
+            AStarEngine::SearchOptions options;
+            options.mode = mode;
+            options.epsilon = epsilon;
+            options.max_expansions = max_expansions;
+            options.time_limit_s = time_limit_s;
+            options.cost_cap = cost_cap;
+            return AStar::search_bounded(network, start_node, goal_node, options);
+        },
+        "Sequential A* that may return a path up to epsilon times the optimal cost (weighted or "
+        "focal search) and stops at max_expansions (0 = none), time_limit_s (0 = none) or "
+        "cost_cap. Returns a SearchResult with the status and the path or best partial path.",
+        py::arg("network"),               // Expects a RoadNetwork object from Python
+        py::arg("start_node"),            // Starting node ID
+        py::arg("goal_node"),             // Goal node ID
+        py::arg("epsilon") = 1.0,         // Suboptimality factor, >= 1
+        py::arg("mode") = AStarEngine::BoundedMode::WEIGHTED,
+        py::arg("max_expansions") = 0,
+        py::arg("time_limit_s") = 0.0,
+        py::arg("cost_cap") = std::numeric_limits<double>::infinity(),
+        py::call_guard<py::gil_scoped_release>()  // Search runs without the GIL
+    );
+
     // ---- Normal A* search function ----
     demo_m.def("AStar_search",
-               &AStar::search,  // The C++ function to bind
-               "Find the shortest path using the A* algorithm (Sequential Implementation). Returns a list of node IDs.",
+               &AStar::search,  // Engine instantiation exported by demo_lib, behind the network's path cache
+               "Find the shortest path using the A* algorithm (Sequential Implementation). Returns a list of node IDs. "
+               "Served from the network's path cache when one is set (RoadNetwork.set_path_cache).",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStar_search_bidirectional",
+               &AStarEngine::search_bidirectional<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using bidirectional A* (forward and backward searches on two threads). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarParallel_search_TPool_CppLib",
-               &AStarParallel::search_TPool_CppLib,  // The C++ function to bind
+               &AStarEngine::search_TPool_CppLib<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread pool and C++ library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarParallel_search_TVector_CppLib",
-               &AStarParallel::search_TVector_CppLib,  // The C++ function to bind
+               &AStarEngine::search_TVector_CppLib<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread vector and C++ library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarParallel_search_TPool_PqFine",
-               &AStarParallel::search_TPool_PqFine,  // The C++ function to bind
+               &AStarEngine::search_TPool_PqFine<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread pool and pq_fine library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarParallel_search_TVector_PqFine",
-               &AStarParallel::search_TVector_PqFine,  // The C++ function to bind
+               &AStarEngine::search_TVector_PqFine<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread vector and pq_fine library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStarParallel_search_TPool_MultiQueue",
+               &AStarEngine::search_TPool_MultiQueue<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using the A* algorithm (Parallel with thread pool and the relaxed MultiQueue open set). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStarParallel_search_TVector_MultiQueue",
+               &AStarEngine::search_TVector_MultiQueue<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using the A* algorithm (Parallel with thread vector and the relaxed MultiQueue open set). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStarParallel_search_HDA",
+               &AStarEngine::search_HDA<GreatCircleHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using Hash-Distributed A* (each thread owns a hash partition of the nodes with its own open list). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     // ---- Dynamic cost function A* search function ----
     demo_m.def("AStarEnhancement_search",
-               &AStarEnhancement::search,  // The C++ function to bind
+               &AStarEngine::search<DynamicCostHeuristic, EdgeWeightCost, DefaultOpenSet>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Sequential Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStarEnhancement_search_bidirectional",
+               &AStarEngine::search_bidirectional<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using bidirectional A* (forward and backward searches on two threads). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarEnhancementParallel_search_TPool_CppLib",
-               &AStarEnhancementParallel::search_TPool_CppLib,  // The C++ function to bind
+               &AStarEngine::search_TPool_CppLib<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread pool and C++ library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarEnhancementParallel_search_TVector_CppLib",
-               &AStarEnhancementParallel::search_TVector_CppLib,  // The C++ function to bind
+               &AStarEngine::search_TVector_CppLib<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread vector and C++ library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarEnhancementParallel_search_TPool_PqFine",
-               &AStarEnhancementParallel::search_TPool_PqFine,  // The C++ function to bind
+               &AStarEngine::search_TPool_PqFine<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread pool and pq_fine library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
 
     demo_m.def("AStarEnhancementParallel_search_TVector_PqFine",
-               &AStarEnhancementParallel::search_TVector_PqFine,  // The C++ function to bind
+               &AStarEngine::search_TVector_PqFine<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
                "Find the shortest path using the A* algorithm (Parallel with thread vector and pq_fine library Implementation). Returns a list of node IDs.",
                py::arg("network"),            // Expects a RoadNetwork object from Python
                py::arg("start_node"),         // Starting node ID
                py::arg("goal_node"),          // Goal node ID
                py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStarEnhancementParallel_search_TPool_MultiQueue",
+               &AStarEngine::search_TPool_MultiQueue<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using the A* algorithm (Parallel with thread pool and the relaxed MultiQueue open set). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    demo_m.def("AStarEnhancementParallel_search_TVector_MultiQueue",
+               &AStarEngine::search_TVector_MultiQueue<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using the A* algorithm (Parallel with thread vector and the relaxed MultiQueue open set). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
                py::return_value_policy::move  // Efficiently move the resulting vector to Python
     );
-    
 
-}
\ No newline at end of file
+    demo_m.def("AStarEnhancementParallel_search_HDA",
+               &AStarEngine::search_HDA<DynamicCostHeuristic, EdgeWeightCost>,  // Engine instantiation exported by demo_lib
+               "Find the shortest path using Hash-Distributed A* (each thread owns a hash partition of the nodes with its own open list). Returns a list of node IDs.",
+               py::arg("network"),            // Expects a RoadNetwork object from Python
+               py::arg("start_node"),         // Starting node ID
+               py::arg("goal_node"),          // Goal node ID
+               py::arg("num_threads"),        // Number of threads
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move  // Efficiently move the resulting vector to Python
+    );
+
+    // ---- Instrumented searches ----
+    // Each *_with_stats function runs the engine of the same name with a StatsRecorder and
+    // returns (path, stats): expanded, reopened, pushes, decrease_keys, pops, stale_pops,
+    // peak_open, messages (HDA*), lock_wait_s / lock_acquisitions per lock site and
+    // phase_s (setup, search, path, parallel_relax). The plain functions record nothing.
+    const char *stats_doc = "Same search as the function without _with_stats. Returns (path, stats dict).";
+    def_with_stats(demo_m, "AStar_search_with_stats",
+                   &AStarEngine::search<GreatCircleHeuristic, EdgeWeightCost, DefaultOpenSet, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStar_search_bidirectional_with_stats",
+                   &AStarEngine::search_bidirectional<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_TPool_CppLib_with_stats",
+                   &AStarEngine::search_TPool_CppLib<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_TVector_CppLib_with_stats",
+                   &AStarEngine::search_TVector_CppLib<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_TPool_PqFine_with_stats",
+                   &AStarEngine::search_TPool_PqFine<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_TVector_PqFine_with_stats",
+                   &AStarEngine::search_TVector_PqFine<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_TPool_MultiQueue_with_stats",
+                   &AStarEngine::search_TPool_MultiQueue<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_TVector_MultiQueue_with_stats",
+                   &AStarEngine::search_TVector_MultiQueue<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarParallel_search_HDA_with_stats",
+                   &AStarEngine::search_HDA<GreatCircleHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+
+    def_with_stats(demo_m, "AStarEnhancement_search_with_stats",
+                   &AStarEngine::search<DynamicCostHeuristic, EdgeWeightCost, DefaultOpenSet, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancement_search_bidirectional_with_stats",
+                   &AStarEngine::search_bidirectional<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_TPool_CppLib_with_stats",
+                   &AStarEngine::search_TPool_CppLib<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_TVector_CppLib_with_stats",
+                   &AStarEngine::search_TVector_CppLib<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_TPool_PqFine_with_stats",
+                   &AStarEngine::search_TPool_PqFine<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_TVector_PqFine_with_stats",
+                   &AStarEngine::search_TVector_PqFine<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_TPool_MultiQueue_with_stats",
+                   &AStarEngine::search_TPool_MultiQueue<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_TVector_MultiQueue_with_stats",
+                   &AStarEngine::search_TVector_MultiQueue<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+    def_with_stats(demo_m, "AStarEnhancementParallel_search_HDA_with_stats",
+                   &AStarEngine::search_HDA<DynamicCostHeuristic, EdgeWeightCost, StatsRecorder>, stats_doc);
+
+    // ---- Batch queries ----
+    demo_m.def(
+        "search_many",
+        [](const RoadNetwork &network, const py_array<long long> &starts,
+           const py_array<long long> &goals, int num_threads)
+        {
+            std::span<const long long> start_ids = numpy_span(starts, "starts");
+            std::span<const long long> goal_ids = numpy_span(goals, "goals");
+            BatchSearch::PathBuffer paths;
+            {
+                py::gil_scoped_release release;
+                paths = BatchSearch::search_many(network, start_ids, goal_ids, num_threads);
+            }
+            return py::make_tuple(vector_to_numpy(std::move(paths.offsets)),
+                                  vector_to_numpy(std::move(paths.ids)));
+        },
+        "Answer many (start, goal) queries in parallel with the sequential A* search, one query per "
+        "pool thread at a time (through the network's path cache if set). Returns (offsets, ids) NumPy "
+        "arrays: the path of query i is ids[offsets[i]:offsets[i + 1]] (empty if unreachable).",
+        py::arg("network"),          // Expects a RoadNetwork object from Python
+        py::arg("starts"),           // 1-D array of start node IDs
+        py::arg("goals"),            // 1-D array of goal node IDs, same length
+        py::arg("num_threads") = 0   // Threads to use, 0 = whole pool
+    );
+
+    demo_m.def(
+        "distance_matrix",
+        [](const RoadNetwork &network, const py_array<long long> &sources,
+           const py_array<long long> &targets, int num_threads)
+        {
+            std::span<const long long> source_ids = numpy_span(sources, "sources");
+            std::span<const long long> target_ids = numpy_span(targets, "targets");
+            std::vector<double> matrix;
+            {
+                py::gil_scoped_release release;
+                matrix = BatchSearch::distance_matrix(network, source_ids, target_ids, num_threads);
+            }
+            return matrix_to_numpy(std::move(matrix), source_ids.size(), target_ids.size());
+        },
+        "Travel cost from every source to every target under the live weights, one Dijkstra per "
+        "source in parallel (no paths are built). Returns a C-contiguous float64 NumPy matrix of "
+        "shape (len(sources), len(targets)), inf where unreachable.",
+        py::arg("network"),          // Expects a RoadNetwork object from Python
+        py::arg("sources"),          // 1-D array of source node IDs (rows)
+        py::arg("targets"),          // 1-D array of target node IDs (columns)
+        py::arg("num_threads") = 0   // Threads to use, 0 = whole pool
+    );
+
+    // ---- One-to-many distances (Δ-stepping) ----
+    demo_m.def(
+        "distances_from",
+        [](const RoadNetwork &network, long long source_node, double delta, int num_threads)
+        {
+            std::vector<double> dist;
+            {
+                py::gil_scoped_release release;
+                dist = DeltaStepping::distances_from(network, source_node, delta, num_threads);
+            }
+            return vector_to_numpy(std::move(dist));
+        },
+        "Shortest distance from source_node to every node under the live weights, with parallel "
+        "delta-stepping. Returns a float64 NumPy array indexed like network.node_ids (inf where "
+        "unreachable). delta <= 0 picks a few mean edge weights.",
+        py::arg("network"),          // Expects a RoadNetwork object from Python
+        py::arg("source_node"),      // Source node ID
+        py::arg("delta") = 0.0,      // Bucket width, 0 = automatic
+        py::arg("num_threads") = 0   // Threads to use, 0 = whole pool
+    );
+
+    demo_m.def(
+        "distances_to",
+        [](const RoadNetwork &network, long long target_node, double delta, int num_threads)
+        {
+            std::vector<double> dist;
+            {
+                py::gil_scoped_release release;
+                dist = DeltaStepping::distances_to(network, target_node, delta, num_threads);
+            }
+            return vector_to_numpy(std::move(dist));
+        },
+        "Shortest distance from every node to target_node (reverse delta-stepping), in the same "
+        "format as distances_from.",
+        py::arg("network"), py::arg("target_node"), py::arg("delta") = 0.0, py::arg("num_threads") = 0);
+
+    // ---- Contraction Hierarchies ----
+    py::class_<CH::ContractionHierarchy>(demo_m, "ContractionHierarchy",
+                                         "Contraction hierarchy preprocessed from a static RoadNetwork")
+        .def_static("build", &CH::ContractionHierarchy::build, py::arg("network"),
+                    py::arg("num_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+                    "Contracts every node of the network (num_threads = 0 uses the whole pool). "
+                    "The hierarchy must be rebuilt if the network's weights change.")
+        .def("search", &CH::ContractionHierarchy::search,
+             "Find the shortest path with a bidirectional upward search in the hierarchy. Returns a "
+             "list of node IDs like AStar_search.",
+             py::arg("network"),     // The RoadNetwork the hierarchy was built from
+             py::arg("start_node"),  // Starting node ID
+             py::arg("goal_node"),   // Goal node ID
+             py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+             py::return_value_policy::move)
+        .def_property_readonly("num_arcs", &CH::ContractionHierarchy::num_arcs,
+                               "Arcs in the upward and downward overlays, shortcuts included")
+        .def_property_readonly("num_shortcuts", &CH::ContractionHierarchy::num_shortcuts,
+                               "Shortcut arcs added by the contraction");
+
+    // ---- Incremental replanning (D* Lite) ----
+    py::class_<DStarLite::Planner>(demo_m, "Planner",
+                                   "Stateful D* Lite planner towards one goal; re-queries repair the previous "
+                                   "search after the vehicle moves or traffic updates are published")
+        .def(py::init<const RoadNetwork &, long long>(), py::arg("network"), py::arg("goal_node"),
+             py::keep_alive<1, 2>())  // The planner reads the network on every search
+        .def("search", &DStarLite::Planner::search,
+             "Find the shortest path from start_node to the goal under the current live weights. Returns a "
+             "list of node IDs like AStar_search. Only the part of the search affected by the new start and "
+             "by weight changes since the last call is recomputed.",
+             py::arg("start_node"),  // Current position of the vehicle
+             py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+             py::return_value_policy::move)
+        .def_property_readonly("goal_node", &DStarLite::Planner::goal_node, "Goal node ID")
+        .def_property_readonly("last_expansions", &DStarLite::Planner::last_expansions,
+                               "Nodes expanded by the last search")
+        .def_property_readonly("last_changed_edges", &DStarLite::Planner::last_changed_edges,
+                               "Edges whose weight changed between the previous search and the last one");
+
+    // --- Multi-objective A* (Pareto front over the edge cost vectors) ---
+    py::class_<AStarEnhancementVectorFunction::ParetoPath>(demo_m, "ParetoPath",
+                                                           "One Pareto-optimal path of a multi-objective search")
+        .def_readonly("cost", &AStarEnhancementVectorFunction::ParetoPath::cost,
+                      "Path cost as (distance, time, toll)")
+        .def_readonly("path", &AStarEnhancementVectorFunction::ParetoPath::path,
+                      "Node IDs, start first");
+
+    demo_m.def("AStarEnhancementVectorFunction_search", &AStarEnhancementVectorFunction::search,
+               "Find every Pareto-optimal path under the (distance, time, toll) edge costs with NAMOA*. "
+               "Returns a list of ParetoPath in lexicographic cost order. max_labels > 0 stops the search "
+               "early after creating that many labels; the paths returned are then still Pareto-optimal "
+               "but the front may be incomplete.",
+               py::arg("network"),             // Expects a RoadNetwork object from Python
+               py::arg("start_node"),          // Starting node ID
+               py::arg("goal_node"),           // Goal node ID
+               py::arg("max_labels") = 0,      // Label budget (0 = unlimited)
+               py::call_guard<py::gil_scoped_release>(),  // Search runs without the GIL
+               py::return_value_policy::move);
+}
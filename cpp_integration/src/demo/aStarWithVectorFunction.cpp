@@ -1,129 +1,197 @@
-#include "demo/astar.h"
+#include "demo/aStarWithVectorFunction.h"
+#include "data_structure/pq_indexed_dary.h"
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <queue>
-#include <stdexcept>  // For runtime_error
-#include <unordered_map>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
-namespace AStarEnhancementVectorFunction
-{
+namespace AStarEnhancementVectorFunction {
 
-struct AStarNode
-{
-    long long id;
-    double f_score;
+    static_assert(NUM_CRITERIA == 3, "The dominance staircase covers exactly the criteria after the first two");
 
-    bool operator>(const AStarNode &other) const { return f_score > other.f_score; }
-};
+    using LabelIndex = std::uint32_t;
 
-std::vector<long long> astar_search(const RoadNetwork &network,  // Accepts RoadNetwork
-                                    long long start_node_id, long long goal_node_id)
-{
-    // Check if start and goal nodes exist in the nodes map
-    const Node *start_node_ptr = network.get_node(start_node_id);
-    const Node *goal_node_ptr = network.get_node(goal_node_id);
+    constexpr LabelIndex NO_LABEL = std::numeric_limits<LabelIndex>::max();
 
-    if (!start_node_ptr)
-    {
-        throw std::runtime_error("Start node ID not found in NodeMap.");
-    }
-    if (!goal_node_ptr)
-    {
-        throw std::runtime_error("Goal node ID not found in NodeMap.");
-    }
-    const Node &start_node_data = *start_node_ptr;
-    const Node &goal_node_data = *goal_node_ptr;
-
-    // Priority queue, g_score, came_from setup (as before)
-    std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>> open_set;
-    std::unordered_map<long long, double> g_score;
-    std::unordered_map<long long, long long> came_from;
-
-    // Initialize g_scores - only need to track nodes encountered
-    // Set start node g_score
-    g_score[start_node_id] = 0.0;
-
-    // Add start node to the open set
-    open_set.push({start_node_id, heuristic(start_node_data, goal_node_data)});
-
-    while (!open_set.empty())
-    {
-        AStarNode current = open_set.top();
-        open_set.pop();
-        long long current_id = current.id;
-
-        // Goal reached (same as before)
-        if (current_id == goal_node_id)
-        {
-            std::vector<long long> path;
-            long long temp = current_id;
-            // Check count using find to avoid creating entry if temp is not found
-            while (came_from.find(temp) != came_from.end())
-            {
-                path.push_back(temp);
-                temp = came_from[temp];
-            }
-            path.push_back(start_node_id);
-            std::reverse(path.begin(), path.end());
-            return path;
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    // One partial path in the label arena; two labels share a cache line
+    struct Label {
+        CostVector g;
+        NodeIndex node;
+        LabelIndex parent;
+    };
+
+    static_assert(sizeof(Label) == 32, "Label should stay half a cache line");
+
+    /**
+     * Pareto staircase of 2-D points (the last two criteria of a cost vector).
+     *
+     * Points are sorted by x ascending with y strictly descending, so no point dominates
+     * another. (x, y) is dominated iff the last point with px <= x has py <= y: one binary
+     * search. Inserting a point removes the run of points it dominates, which starts right
+     * at its insert position.
+     */
+    class Staircase {
+    public:
+        bool empty() const { return points_.empty(); }
+
+        void clear() { points_.clear(); }
+
+        // True if some point is <= (x, y) in both coordinates (equal counts as dominated)
+        bool dominates(double x, double y) const {
+            auto it = std::upper_bound(points_.begin(), points_.end(), x,
+                                       [](double value, const Point &p) { return value < p.x; });
+            return it != points_.begin() && std::prev(it)->y <= y;
         }
 
-        // Get current node g_score, default to infinity if not present (should be present if
-        // reached via open_set)
-        double current_g_score =
-            (g_score.count(current_id)) ? g_score[current_id] : std::numeric_limits<double>::max();
+        // Adds a point that dominates() rejected
+        void insert(double x, double y) {
+            auto first = std::lower_bound(points_.begin(), points_.end(), x,
+                                          [](const Point &p, double value) { return p.x < value; });
+            auto last = first;
+            while (last != points_.end() && last->y >= y) ++last;
+            if (first != last) {
+                *first = {x, y};
+                points_.erase(std::next(first), last);
+            } else {
+                points_.insert(first, {x, y});
+            }
+        }
 
-        // Check if the current node exists in the graph's adjacency list
-        const std::vector<Edge> *neighbors_ptr = network.get_neighbors(current_id);
-        if (!neighbors_ptr)
-        {
-            continue;  // Node has no outgoing edges
+    private:
+        struct Point {
+            double x, y;
+        };
+
+        std::vector<Point> points_;
+    };
+
+    // Per-thread search state, reused across queries so steady-state queries allocate nothing
+    struct ParetoState {
+        std::vector<Label> labels;           // Arena of every label created by the query
+        std::vector<CostVector> ideal;       // h(u): exact per-criterion distance to the goal
+        std::vector<Staircase> closed;       // (g[1], g[2]) of the extracted labels of each node
+        std::vector<NodeIndex> touched;      // Nodes whose staircase is non-empty
+        Staircase solutions;                 // Same for the labels that reached the goal
+        std::vector<LabelIndex> goal_labels;
+
+        using Entry = std::pair<CostVector, LabelIndex>;  // (f, label); std::array orders lexicographically
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+        DataStructure::PriorityQueue::IndexedDaryHeap<4, double, std::greater<double>> heap;
+
+        void reset(size_t num_nodes) {
+            labels.clear();
+            for (NodeIndex u : touched) closed[u].clear();
+            touched.clear();
+            closed.resize(num_nodes);
+            solutions.clear();
+            goal_labels.clear();
+            open = {};
         }
+    };
+
+    // Fills state.ideal with one reverse Dijkstra per criterion from the goal. Exact
+    // distances are a consistent heuristic whatever units the criteria use, which the
+    // dimensionality reduction relies on; INF marks nodes that cannot reach the goal.
+    static void compute_ideal_point(const RoadNetwork &network, NodeIndex goal, ParetoState &state) {
+        const size_t n = network.num_nodes();
+        state.ideal.assign(n, CostVector{INF, INF, INF});
+        state.heap.reserve_ids(n);
+        for (size_t c = 0; c < NUM_CRITERIA; ++c) {
+            state.heap.clear();
+            state.ideal[goal][c] = 0.0;
+            state.heap.push(goal, 0.0);
+            while (!state.heap.empty()) {
+                auto [v, d] = state.heap.pop();
+                for (EdgeIndex e = network.rev_edge_begin(v); e < network.rev_edge_end(v); ++e) {
+                    NodeIndex u = network.rev_edge_source(e);
+                    double candidate = d + network.rev_edge_costs(e)[c];
+                    if (candidate < state.ideal[u][c]) {
+                        state.ideal[u][c] = candidate;
+                        state.heap.push_or_decrease(u, candidate);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<ParetoPath> search(const RoadNetwork &network, long long start_node_id, long long goal_node_id,
+                                   size_t max_labels) {
+        NodeIndex start = network.index_of(start_node_id);
+        NodeIndex goal = network.index_of(goal_node_id);
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+        if (max_labels == 0 || max_labels > NO_LABEL) max_labels = NO_LABEL;
+
+        thread_local ParetoState state;
+        state.reset(network.num_nodes());
+        compute_ideal_point(network, goal, state);
+        std::vector<Label> &labels = state.labels;
+
+        std::vector<ParetoPath> result;
+        if (state.ideal[start][0] == INF) return result;
+
+        labels.push_back({CostVector{}, start, NO_LABEL});
+        state.open.push({state.ideal[start], 0});
+
+        bool label_limit_reached = false;
+        while (!state.open.empty() && !label_limit_reached) {
+            auto [f, index] = state.open.top();
+            state.open.pop();
+            const Label label = labels[index];  // Copy: the arena may grow below
+
+            // Lazy filtering: labels dominated since they were generated die here
+            if (state.solutions.dominates(f[1], f[2])) continue;
+            Staircase &closed = state.closed[label.node];
+            if (closed.dominates(label.g[1], label.g[2])) continue;
+            if (closed.empty()) state.touched.push_back(label.node);
+            closed.insert(label.g[1], label.g[2]);
+
+            if (label.node == goal) {
+                state.solutions.insert(label.g[1], label.g[2]);
+                state.goal_labels.push_back(index);
+                continue;
+            }
 
-        // Explore neighbors
-        for (const Edge &edge : *neighbors_ptr)
-        {
-            long long neighbor_id = edge.target_node_id;
-            double tentative_g_score = current_g_score + edge.weight;
-            tentative_g_score = tentative_g_score + tentative_g_score
-
-            // Get neighbor g_score, default to infinity if not seen before
-            double neighbor_g_score = (g_score.count(neighbor_id))
-                                          ? g_score[neighbor_id]
-                                          : std::numeric_limits<double>::max();
-            neighbor_g_score = neighbor_g_score + neighbor_g_score
-
-            if (tentative_g_score < neighbor_g_score)
-            {
-                // Found a better path
-                came_from[neighbor_id] = current_id;
-                g_score[neighbor_id] = tentative_g_score;  // Update or insert g_score
-
-                const Node *neighbor_node_ptr = network.get_node(neighbor_id);
-                if (neighbor_node_ptr)
-                {  // Check if neighbor node data exists
-                    double h_score = 2*heuristic(*neighbor_node_ptr, goal_node_data);
-                    // Check for potential infinity issues if heuristic returns max()
-                    if (h_score < std::numeric_limits<double>::max())
-                    {
-                        open_set.push({neighbor_id, tentative_g_score + h_score});
-                    }  // else: node is likely unreachable or heuristic failed, don't add
+            for (EdgeIndex e = network.edge_begin(label.node); e < network.edge_end(label.node); ++e) {
+                NodeIndex v = network.edge_target(e);
+                const CostVector &h = state.ideal[v];
+                if (h[0] == INF) continue;  // Dead end
+
+                CostVector g = label.g, f_next;
+                const CostVector costs = network.edge_costs(e);
+                for (size_t c = 0; c < NUM_CRITERIA; ++c) {
+                    g[c] += costs[c];
+                    f_next[c] = g[c] + h[c];
                 }
-                else
-                {
-                    // Node exists in graph edges but not in NodeMap - indicates inconsistent data
-                    // Option: Throw an error, log a warning, or assign max heuristic
-                    // For now, let's skip adding it to open_set if data is missing
-                    // std::cerr << "Warning: Node " << neighbor_id << " missing coordinate data."
-                    // << std::endl;
+                if (state.solutions.dominates(f_next[1], f_next[2])) continue;
+                if (state.closed[v].dominates(g[1], g[2])) continue;
+
+                if (labels.size() >= max_labels) {
+                    label_limit_reached = true;
+                    break;
                 }
+                state.open.push({f_next, static_cast<LabelIndex>(labels.size())});
+                labels.push_back({g, v, index});
             }
         }
+
+        // Goal labels were extracted in lexicographic order, which is the result order
+        result.reserve(state.goal_labels.size());
+        for (LabelIndex index : state.goal_labels) {
+            ParetoPath solution{labels[index].g, {}};
+            for (LabelIndex at = index; at != NO_LABEL; at = labels[at].parent)
+                solution.path.push_back(network.id_of(labels[at].node));
+            std::reverse(solution.path.begin(), solution.path.end());
+            result.push_back(std::move(solution));
+        }
+        return result;
     }
 
-    // Open set empty, goal not reached
-    return {};
 }
-
-}  // namespace Demo
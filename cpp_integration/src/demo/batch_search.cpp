@@ -0,0 +1,177 @@
+#include "demo/batch_search.h"
+#include "data_structure/pq_indexed_dary.h"
+#include "demo/astar.h"
+#include "demo/search_context.h"
+#include "numa.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace BatchSearch {
+
+    namespace {
+
+        // Calls body(i) for every item i over the ThreadPool like parallel_for(). On a
+        // network partitioned over several NUMA domains the items are queued by the domain
+        // of item_nodes[i], and each thread drains the queue of the domain it runs on
+        // before it helps with the others, so most searches start in local memory.
+        template <typename Body>
+        void run_by_domain(const RoadNetwork &network, std::span<const NodeIndex> item_nodes, Body &&body,
+                           int num_threads)
+        {
+            const size_t max_threads = num_threads > 0 ? static_cast<size_t>(num_threads) : 0;
+            const GraphPartition &partition = network.partition();
+            const size_t domains = partition.num_domains();
+            if (domains <= 1)
+            {
+                ThreadPool::instance().parallel_for(item_nodes.size(), body, max_threads);
+                return;
+            }
+
+            std::vector<std::vector<size_t>> queues(domains);
+            for (size_t i = 0; i < item_nodes.size(); ++i)
+                queues[partition.domain_of(item_nodes[i])].push_back(i);
+            std::unique_ptr<std::atomic<size_t>[]> cursors(new std::atomic<size_t>[domains]);
+            for (size_t d = 0; d < domains; ++d)
+                cursors[d].store(0, std::memory_order_relaxed);
+
+            ThreadPool &pool = ThreadPool::instance();
+            const size_t threads = std::min(max_threads == 0 ? pool.concurrency() : max_threads, item_nodes.size());
+            pool.parallel_for(
+                threads,
+                [&](size_t)
+                {
+                    const size_t home = NumaTopology::system().current_node() % domains;
+                    for (size_t k = 0; k < domains; ++k)
+                    {
+                        const size_t d = (home + k) % domains;
+                        for (size_t next = cursors[d].fetch_add(1, std::memory_order_relaxed); next < queues[d].size();
+                             next = cursors[d].fetch_add(1, std::memory_order_relaxed))
+                            body(queues[d][next]);
+                    }
+                },
+                threads);
+        }
+
+    }
+
+    PathBuffer search_many(const RoadNetwork &network, std::span<const long long> starts,
+                           std::span<const long long> goals, int num_threads)
+    {
+        if (starts.size() != goals.size())
+            throw std::invalid_argument("search_many: starts and goals must have the same length.");
+
+        // Validate up front so a bad id fails the call before any worker starts
+        std::vector<NodeIndex> start_nodes(starts.size());
+        for (size_t i = 0; i < starts.size(); ++i)
+        {
+            start_nodes[i] = network.index_of(starts[i]);
+            if (start_nodes[i] == INVALID_NODE_INDEX || network.index_of(goals[i]) == INVALID_NODE_INDEX)
+                throw std::invalid_argument("search_many: unknown node id in query " + std::to_string(i) + ".");
+        }
+
+        // Each query writes only its own slot; AStar::search uses its thread's SearchContext
+        std::vector<std::vector<long long>> paths(starts.size());
+        run_by_domain(
+            network, start_nodes, [&](size_t i) { paths[i] = AStar::search(network, starts[i], goals[i]); },
+            num_threads);
+
+        // Flatten into the offsets + ids buffer
+        PathBuffer result;
+        result.offsets.resize(paths.size() + 1, 0);
+        for (size_t i = 0; i < paths.size(); ++i)
+            result.offsets[i + 1] = result.offsets[i] + static_cast<std::int64_t>(paths[i].size());
+        result.ids.reserve(static_cast<size_t>(result.offsets.back()));
+        for (const std::vector<long long> &path : paths)
+            result.ids.insert(result.ids.end(), path.begin(), path.end());
+        return result;
+    }
+
+    std::vector<double> distance_matrix(const RoadNetwork &network, std::span<const long long> sources,
+                                        std::span<const long long> targets, int num_threads)
+    {
+        constexpr double UNREACHABLE = std::numeric_limits<double>::infinity();
+        constexpr std::uint32_t NOT_A_TARGET = std::numeric_limits<std::uint32_t>::max();
+
+        // Validate up front so a bad id fails the call before any worker starts
+        auto translate = [&](std::span<const long long> ids, const char *what)
+        {
+            std::vector<NodeIndex> indices(ids.size());
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                indices[i] = network.index_of(ids[i]);
+                if (indices[i] == INVALID_NODE_INDEX)
+                    throw std::invalid_argument(std::string("distance_matrix: unknown node id in ") + what + " at "
+                                                + std::to_string(i) + ".");
+            }
+            return indices;
+        };
+        const std::vector<NodeIndex> source_nodes = translate(sources, "sources");
+        const std::vector<NodeIndex> target_nodes = translate(targets, "targets");
+
+        // Each distinct target gets one slot; target_slot marks the nodes a search must settle
+        std::vector<NodeIndex> distinct = target_nodes;
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+        std::vector<std::uint32_t> target_slot(network.num_nodes(), NOT_A_TARGET);
+        for (size_t slot = 0; slot < distinct.size(); ++slot)
+            target_slot[distinct[slot]] = static_cast<std::uint32_t>(slot);
+        std::vector<std::uint32_t> column_slot(target_nodes.size());
+        for (size_t column = 0; column < target_nodes.size(); ++column)
+            column_slot[column] = target_slot[target_nodes[column]];
+
+        const WeightSnapshot weights = network.pin_weights();
+        const size_t columns = targets.size();
+        std::vector<double> matrix(sources.size() * columns, UNREACHABLE);
+
+        // Each source writes only its own row
+        run_by_domain(
+            network, source_nodes,
+            [&](size_t row)
+            {
+                thread_local DataStructure::PriorityQueue::IndexedDaryHeap<4, double, std::greater<double>> heap;
+                thread_local std::vector<double> slot_distance;
+                SearchContext &context = SearchContext::for_thread(network);
+                heap.clear();
+                heap.reserve_ids(network.num_nodes());
+                slot_distance.assign(distinct.size(), UNREACHABLE);
+
+                const NodeIndex source = source_nodes[row];
+                context.set(source, 0.0, INVALID_NODE_INDEX);
+                heap.push(source, 0.0);
+                size_t remaining = distinct.size();
+                while (remaining > 0 && !heap.empty())
+                {
+                    auto [u, d] = heap.pop();
+                    if (target_slot[u] != NOT_A_TARGET)
+                    {
+                        slot_distance[target_slot[u]] = d;
+                        --remaining;
+                    }
+                    for (EdgeIndex e = network.edge_begin(u); e < network.edge_end(u); ++e)
+                    {
+                        NodeIndex v = network.edge_target(e);
+                        double candidate = d + weights.forward(e);
+                        if (candidate < context.g(v))
+                        {
+                            context.set(v, candidate, INVALID_NODE_INDEX);
+                            heap.push_or_decrease(v, candidate);
+                        }
+                    }
+                }
+
+                double *out = matrix.data() + row * columns;
+                for (size_t column = 0; column < columns; ++column)
+                    out[column] = slot_distance[column_slot[column]];
+            },
+            num_threads);
+        return matrix;
+    }
+
+}
@@ -0,0 +1,380 @@
+#include "demo/contraction_hierarchy.h"
+#include "demo/search_context.h"
+#include "data_structure/pq_indexed_dary.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CH {
+
+    // Dijkstra open set of witness searches and queries (indexed 4-ary heap)
+    using DistanceHeap = DataStructure::PriorityQueue::IndexedDaryHeap<4, double, std::greater<double>>;
+
+    namespace {
+
+        // Arc of the graph being contracted: far end, weight, bypassed node (shortcuts)
+        struct Arc {
+            NodeIndex node;
+            double weight;
+            NodeIndex middle;
+        };
+
+        // A shortcut found by contracting a node
+        struct Shortcut {
+            NodeIndex from;
+            NodeIndex to;
+            double weight;
+        };
+
+        enum NodeState : unsigned char { ALIVE, IN_BATCH, CONTRACTED };
+
+        // The graph while nodes are contracted: adjacency lists in both directions with at
+        // most one arc per (u, w) pair, over the nodes not contracted yet.
+        class ContractionGraph {
+        public:
+            // Copies the network's current live weights and records their version
+            explicit ContractionGraph(const RoadNetwork &network)
+                : out(network.num_nodes()), in(network.num_nodes()), state(network.num_nodes(), ALIVE) {
+                const WeightSnapshot weights = network.pin_weights();
+                weights_version = weights.version();
+                for (NodeIndex u = 0; u < network.num_nodes(); ++u)
+                    for (EdgeIndex e = network.edge_begin(u); e < network.edge_end(u); ++e)
+                        if (network.edge_target(e) != u)  // Self loops never lie on shortest paths
+                            add_or_lower(u, network.edge_target(e), weights.forward(e), INVALID_NODE_INDEX);
+            }
+
+            std::uint64_t weights_version = 0;
+            std::vector<std::vector<Arc>> out;
+            std::vector<std::vector<Arc>> in;
+            std::vector<NodeState> state;
+
+            // Inserts u -> w, or lowers its weight if a heavier parallel arc exists
+            void add_or_lower(NodeIndex u, NodeIndex w, double weight, NodeIndex middle) {
+                for (Arc &arc : out[u]) {
+                    if (arc.node != w) continue;
+                    if (weight < arc.weight) {
+                        arc = {w, weight, middle};
+                        for (Arc &back : in[w])
+                            if (back.node == u) back = {u, weight, middle};
+                    }
+                    return;
+                }
+                out[u].push_back({w, weight, middle});
+                in[w].push_back({u, weight, middle});
+            }
+
+            // Unlinks a contracted node from its neighbors and frees its lists
+            void detach(NodeIndex v) {
+                auto drop_v = [v](std::vector<Arc> &arcs) {
+                    arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [v](const Arc &arc) { return arc.node == v; }),
+                               arcs.end());
+                };
+                for (const Arc &arc : out[v]) drop_v(in[arc.node]);
+                for (const Arc &arc : in[v]) drop_v(out[arc.node]);
+                std::vector<Arc>().swap(out[v]);
+                std::vector<Arc>().swap(in[v]);
+            }
+        };
+
+        // Per-thread witness search: Dijkstra from one in-neighbor of the node being
+        // contracted, over alive nodes only, stopped at a cost bound or the settle limit
+        class WitnessSearch {
+        public:
+            // Fills `shortcuts` with the arcs contracting v requires, returns their count.
+            // Nodes that are not ALIVE (v itself is IN_BATCH or treated so) never relay.
+            size_t shortcuts_for(const ContractionGraph &graph, NodeIndex v, size_t settle_limit,
+                                 std::vector<Shortcut> *shortcuts) {
+                size_t count = 0;
+                for (const Arc &in_arc : graph.in[v]) {
+                    NodeIndex u = in_arc.node;
+                    if (graph.state[u] != ALIVE) continue;
+
+                    // Longest path through v that a witness would have to beat. A flag, not
+                    // bound == 0, tells whether v has another out-neighbor: paths through v
+                    // can weigh 0 and still need a shortcut.
+                    double bound = 0.0;
+                    bool has_target = false;
+                    for (const Arc &out_arc : graph.out[v])
+                        if (graph.state[out_arc.node] == ALIVE && out_arc.node != u) {
+                            bound = std::max(bound, in_arc.weight + out_arc.weight);
+                            has_target = true;
+                        }
+                    if (!has_target) continue;
+
+                    run(graph, u, v, bound, settle_limit);
+                    for (const Arc &out_arc : graph.out[v]) {
+                        NodeIndex w = out_arc.node;
+                        if (graph.state[w] != ALIVE || w == u) continue;
+                        double via_v = in_arc.weight + out_arc.weight;
+                        if (context_.g(w) <= via_v) continue;  // Witness path avoids v
+                        ++count;
+                        if (shortcuts) shortcuts->push_back({u, w, via_v});
+                    }
+                }
+                return count;
+            }
+
+        private:
+            void run(const ContractionGraph &graph, NodeIndex source, NodeIndex skip, double bound, size_t settle_limit) {
+                context_.reset(graph.out.size());
+                heap_.clear();
+                heap_.reserve_ids(graph.out.size());
+                context_.set(source, 0.0, INVALID_NODE_INDEX);
+                heap_.push(source, 0.0);
+
+                size_t settled = 0;
+                while (!heap_.empty() && settled < settle_limit) {
+                    auto [u, d] = heap_.pop();
+                    if (d > bound) break;  // Every witness that could matter has been found
+                    ++settled;
+                    for (const Arc &arc : graph.out[u]) {
+                        if (arc.node == skip || graph.state[arc.node] != ALIVE) continue;
+                        double candidate = d + arc.weight;
+                        if (candidate < context_.g(arc.node)) {
+                            context_.set(arc.node, candidate, u);
+                            heap_.push_or_decrease(arc.node, candidate);
+                        }
+                    }
+                }
+            }
+
+            SearchContext context_;
+            DistanceHeap heap_;
+        };
+
+        WitnessSearch &witness_for_thread() {
+            thread_local WitnessSearch search;
+            return search;
+        }
+
+        // Contraction priority: edge difference plus already contracted neighbors (keeps
+        // the hierarchy balanced). Lower is contracted earlier.
+        long long priority(const ContractionGraph &graph, NodeIndex v, const std::vector<unsigned> &deleted_neighbors) {
+            long long degree = 0;
+            for (const Arc &arc : graph.in[v]) degree += graph.state[arc.node] == ALIVE;
+            for (const Arc &arc : graph.out[v]) degree += graph.state[arc.node] == ALIVE;
+            long long shortcuts = static_cast<long long>(witness_for_thread().shortcuts_for(graph, v, ContractionHierarchy::SIMULATION_SETTLE_LIMIT, nullptr));
+            return shortcuts - degree + deleted_neighbors[v];
+        }
+
+    }
+
+    EdgeIndex ContractionHierarchy::Overlay::find(NodeIndex x, NodeIndex head) const {
+        for (EdgeIndex e = offsets[x]; e < offsets[x + 1]; ++e)
+            if (heads[e] == head) return e;
+        return NO_ARC;
+    }
+
+    ContractionHierarchy ContractionHierarchy::build(const RoadNetwork &network, int num_threads) {
+        const size_t n = network.num_nodes();
+        const size_t threads = num_threads > 0 ? static_cast<size_t>(num_threads) : 0;
+        ThreadPool &pool = ThreadPool::instance();
+
+        ContractionGraph graph(network);
+        std::vector<unsigned> deleted_neighbors(n, 0);
+        std::vector<long long> priorities(n);
+        pool.parallel_for(n, [&](size_t v) {
+            priorities[v] = priority(graph, static_cast<NodeIndex>(v), deleted_neighbors);
+        }, threads);
+
+        ContractionHierarchy ch;
+        ch.weights_version_ = graph.weights_version;
+        ch.rank_.assign(n, INVALID_NODE_INDEX);
+        std::vector<std::vector<Arc>> up_arcs(n), down_arcs(n);
+
+        std::vector<NodeIndex> remaining(n);
+        for (NodeIndex v = 0; v < n; ++v) remaining[v] = v;
+        NodeIndex next_rank = 0;
+
+        std::vector<NodeIndex> batch, touched;
+        std::vector<std::vector<Shortcut>> batch_shortcuts;
+        std::vector<char> queued(n, 0);
+        while (!remaining.empty()) {
+            // Independent set: nodes whose (priority, index) beats every alive neighbor
+            auto before = [&](NodeIndex a, NodeIndex b) {
+                return priorities[a] != priorities[b] ? priorities[a] < priorities[b] : a < b;
+            };
+            batch.clear();
+            for (NodeIndex v : remaining) {
+                bool minimal = true;
+                for (const Arc &arc : graph.in[v])
+                    minimal = minimal && (graph.state[arc.node] != ALIVE || before(v, arc.node));
+                for (const Arc &arc : graph.out[v])
+                    minimal = minimal && (graph.state[arc.node] != ALIVE || before(v, arc.node));
+                if (minimal) batch.push_back(v);
+            }
+            for (NodeIndex v : batch) graph.state[v] = IN_BATCH;
+
+            // Witness searches of the batch in parallel; no batch node relays for another,
+            // so each node's shortcuts are decided as if it were contracted alone
+            batch_shortcuts.assign(batch.size(), {});
+            pool.parallel_for(batch.size(), [&](size_t i) {
+                witness_for_thread().shortcuts_for(graph, batch[i], WITNESS_SETTLE_LIMIT, &batch_shortcuts[i]);
+            }, threads);
+
+            // Apply sequentially: record each node's arcs to higher-ranked (still alive)
+            // neighbors, then insert its shortcuts
+            touched.clear();
+            for (size_t i = 0; i < batch.size(); ++i) {
+                NodeIndex v = batch[i];
+                ch.rank_[v] = next_rank++;
+                for (const Arc &arc : graph.out[v])
+                    if (graph.state[arc.node] == ALIVE) up_arcs[v].push_back(arc);
+                for (const Arc &arc : graph.in[v])
+                    if (graph.state[arc.node] == ALIVE) down_arcs[v].push_back(arc);
+                for (const Shortcut &shortcut : batch_shortcuts[i])
+                    graph.add_or_lower(shortcut.from, shortcut.to, shortcut.weight, v);
+
+                for (const std::vector<Arc> *arcs : {&graph.in[v], &graph.out[v]}) {
+                    for (const Arc &arc : *arcs) {
+                        if (graph.state[arc.node] != ALIVE) continue;
+                        deleted_neighbors[arc.node]++;
+                        if (!queued[arc.node]) {
+                            queued[arc.node] = 1;
+                            touched.push_back(arc.node);
+                        }
+                    }
+                }
+            }
+            for (NodeIndex v : batch) {
+                graph.state[v] = CONTRACTED;
+                graph.detach(v);
+            }
+
+            // Only the neighbors' priorities changed
+            pool.parallel_for(touched.size(), [&](size_t i) {
+                priorities[touched[i]] = priority(graph, touched[i], deleted_neighbors);
+            }, threads);
+            for (NodeIndex v : touched) queued[v] = 0;
+
+            remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                           [&](NodeIndex v) { return graph.state[v] == CONTRACTED; }),
+                            remaining.end());
+        }
+
+        // Freeze both directions into CSR
+        auto freeze = [&](std::vector<std::vector<Arc>> &arcs, Overlay &overlay) {
+            overlay.offsets.assign(n + 1, 0);
+            for (size_t v = 0; v < n; ++v) overlay.offsets[v + 1] = overlay.offsets[v] + static_cast<EdgeIndex>(arcs[v].size());
+            overlay.heads.reserve(overlay.offsets[n]);
+            overlay.weights.reserve(overlay.offsets[n]);
+            overlay.middle.reserve(overlay.offsets[n]);
+            for (std::vector<Arc> &list : arcs) {
+                for (const Arc &arc : list) {
+                    overlay.heads.push_back(arc.node);
+                    overlay.weights.push_back(arc.weight);
+                    overlay.middle.push_back(arc.middle);
+                    ch.num_shortcuts_ += arc.middle != INVALID_NODE_INDEX;
+                }
+                std::vector<Arc>().swap(list);
+            }
+        };
+        freeze(up_arcs, ch.up_);
+        freeze(down_arcs, ch.down_);
+        return ch;
+    }
+
+    void ContractionHierarchy::unpack(NodeIndex from, NodeIndex to, std::vector<NodeIndex> &out) const {
+        // Explicit stack of arcs still to expand; appends every node after `from`
+        std::vector<std::pair<NodeIndex, NodeIndex>> stack{{from, to}};
+        while (!stack.empty()) {
+            auto [a, b] = stack.back();
+            stack.pop_back();
+
+            // The arc is stored at its lower-ranked end
+            NodeIndex middle;
+            if (rank_[a] < rank_[b]) middle = up_.middle[up_.find(a, b)];
+            else middle = down_.middle[down_.find(b, a)];
+
+            if (middle == INVALID_NODE_INDEX) {
+                out.push_back(b);
+            } else {
+                // a -> middle first, so push it last
+                stack.push_back({middle, b});
+                stack.push_back({a, middle});
+            }
+        }
+    }
+
+    std::vector<long long> ContractionHierarchy::search(const RoadNetwork &network, long long start_node_id,
+                                                        long long goal_node_id) const {
+        if (network.num_nodes() != num_nodes())
+            throw std::invalid_argument("ContractionHierarchy: network does not match the hierarchy.");
+        if (network.weights_version() != weights_version_)
+            throw std::invalid_argument("ContractionHierarchy: the network's weights changed since the hierarchy was built.");
+
+        const NodeIndex start = network.index_of(start_node_id);
+        const NodeIndex goal = network.index_of(goal_node_id);
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+        if (goal == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+
+        // Per-thread state for both directions, reset in O(1)
+        thread_local SearchContext forward, backward;
+        thread_local DistanceHeap forward_heap, backward_heap;
+        forward.reset(num_nodes());
+        backward.reset(num_nodes());
+        forward_heap.clear();
+        backward_heap.clear();
+        forward_heap.reserve_ids(num_nodes());
+        backward_heap.reserve_ids(num_nodes());
+
+        forward.set(start, 0.0, INVALID_NODE_INDEX);
+        backward.set(goal, 0.0, INVALID_NODE_INDEX);
+        forward_heap.push(start, 0.0);
+        backward_heap.push(goal, 0.0);
+
+        double best = SearchContext::INF;
+        NodeIndex meeting = INVALID_NODE_INDEX;
+        if (start == goal) {
+            best = 0.0;
+            meeting = start;
+        }
+
+        // Alternate the two upward searches; a side stops once its smallest key reaches
+        // the best meeting cost, since both only ever climb in rank
+        auto step = [&](DistanceHeap &heap, SearchContext &own, const SearchContext &other, const Overlay &overlay) {
+            auto [u, d] = heap.pop();
+            if (d >= best) {
+                heap.clear();
+                return;
+            }
+            for (EdgeIndex e = overlay.offsets[u]; e < overlay.offsets[u + 1]; ++e) {
+                NodeIndex v = overlay.heads[e];
+                double candidate = d + overlay.weights[e];
+                if (candidate >= own.g(v)) continue;
+                own.set(v, candidate, u);
+                heap.push_or_decrease(v, candidate);
+                double total = candidate + other.g(v);
+                if (other.g(v) != SearchContext::INF && total < best) {
+                    best = total;
+                    meeting = v;
+                }
+            }
+        };
+        while (!forward_heap.empty() || !backward_heap.empty()) {
+            if (!forward_heap.empty()) step(forward_heap, forward, backward, up_);
+            if (!backward_heap.empty()) step(backward_heap, backward, forward, down_);
+        }
+        if (meeting == INVALID_NODE_INDEX) return {};
+
+        // CH-level path: start .. meeting from the forward parents, then down to the goal
+        std::vector<NodeIndex> hops;
+        for (NodeIndex u = meeting; u != INVALID_NODE_INDEX; u = forward.parent(u)) hops.push_back(u);
+        std::reverse(hops.begin(), hops.end());
+        for (NodeIndex u = backward.parent(meeting); u != INVALID_NODE_INDEX; u = backward.parent(u)) hops.push_back(u);
+
+        // Shortcuts -> original edges
+        std::vector<NodeIndex> nodes{hops.front()};
+        for (size_t i = 0; i + 1 < hops.size(); ++i) unpack(hops[i], hops[i + 1], nodes);
+
+        std::vector<long long> path;
+        path.reserve(nodes.size());
+        for (NodeIndex u : nodes) path.push_back(network.id_of(u));
+        return path;
+    }
+
+}
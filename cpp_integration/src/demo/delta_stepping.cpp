@@ -0,0 +1,169 @@
+#include "demo/delta_stepping.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace DeltaStepping {
+
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    // Buckets kept at once; a smaller Δ is raised to max edge weight / MAX_BUCKETS
+    constexpr size_t MAX_BUCKETS = size_t(1) << 16;
+
+    // A distance a relaxation task lowered, to be filed into its bucket after the phase
+    struct Insertion {
+        NodeIndex node;
+        size_t bucket;
+    };
+
+    // Lowers dist to candidate unless another thread got lower first; true if it did
+    static bool atomic_lower(double &dist, double candidate) {
+        std::atomic_ref<double> slot(dist);
+        double current = slot.load(std::memory_order_relaxed);
+        while (candidate < current)
+            if (slot.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) return true;
+        return false;
+    }
+
+    // Δ-stepping over the forward or the reverse CSR; weight(e) is the weight of edge e of
+    // that CSR
+    template <bool Reverse, class Weight>
+    static std::vector<double> run(const RoadNetwork &network, NodeIndex source, Weight weight, double delta,
+                                   int num_threads) {
+        const size_t n = network.num_nodes();
+        const size_t m = network.num_edges();
+        auto edges_begin = [&](NodeIndex u) { return Reverse ? network.rev_edge_begin(u) : network.edge_begin(u); };
+        auto edges_end = [&](NodeIndex u) { return Reverse ? network.rev_edge_end(u) : network.edge_end(u); };
+        auto edge_head = [&](EdgeIndex e) { return Reverse ? network.rev_edge_source(e) : network.edge_target(e); };
+
+        // A closed edge (weight +infinity) is never relaxed, so it must not size Δ or the buckets
+        double total_weight = 0.0, max_weight = 0.0;
+        size_t open_edges = 0;
+        for (EdgeIndex e = 0; e < m; ++e) {
+            const double w = weight(e);
+            if (!std::isfinite(w)) continue;
+            total_weight += w;
+            max_weight = std::max(max_weight, w);
+            ++open_edges;
+        }
+        if (!(delta > 0.0))
+            delta = open_edges > 0 && total_weight > 0.0 ? DEFAULT_DELTA_FACTOR * total_weight / open_edges : 1.0;
+        delta = std::max(delta, max_weight / MAX_BUCKETS);
+
+        // A relaxation from bucket i lands at most max_weight / Δ buckets further, so a
+        // cyclic array of that many (plus the current one) never mixes two live buckets
+        const size_t num_slots = static_cast<size_t>(max_weight / delta) + 2;
+        std::vector<std::vector<NodeIndex>> slots(num_slots);
+        auto bucket_of = [delta](double d) { return static_cast<size_t>(d / delta); };
+
+        std::vector<double> dist(n, INF);
+        dist[source] = 0.0;
+        slots[0].push_back(source);
+        size_t pending = 1;  // Entries in all slots, stale ones included
+
+        // Phase in which a node was last relaxed / bucket in which it was last settled (+1)
+        std::vector<std::uint32_t> relaxed_in(n, 0);
+        std::vector<size_t> settled_in(n, 0);
+        std::uint32_t phase = 0;
+
+        const size_t max_threads = num_threads > 0 ? static_cast<size_t>(num_threads) : 0;
+        std::vector<std::vector<Insertion>> requests;  // One list per chunk, reused across phases
+
+        // Relaxes the light or the heavy edges of every frontier node in parallel, then files
+        // the lowered distances into their buckets
+        auto relax = [&](const std::vector<NodeIndex> &frontier, bool light) {
+            const size_t chunks = (frontier.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+            if (requests.size() < chunks) requests.resize(chunks);
+            ThreadPool::instance().parallel_for(chunks, [&](size_t c) {
+                std::vector<Insertion> &out = requests[c];
+                out.clear();
+                const size_t end = std::min(frontier.size(), (c + 1) * CHUNK_SIZE);
+                for (size_t i = c * CHUNK_SIZE; i < end; ++i) {
+                    const NodeIndex u = frontier[i];
+                    // Other chunks may lower dist[u] meanwhile; u is then filed again anyway
+                    const double du = std::atomic_ref<double>(dist[u]).load(std::memory_order_relaxed);
+                    for (EdgeIndex e = edges_begin(u); e < edges_end(u); ++e) {
+                        const double w = weight(e);
+                        if (!std::isfinite(w) || (w <= delta) != light) continue;
+                        const double candidate = du + w;
+                        const NodeIndex v = edge_head(e);
+                        if (atomic_lower(dist[v], candidate)) out.push_back({v, bucket_of(candidate)});
+                    }
+                }
+            }, max_threads);
+
+            for (size_t c = 0; c < chunks; ++c) {
+                for (const Insertion &insertion : requests[c]) slots[insertion.bucket % num_slots].push_back(insertion.node);
+                pending += requests[c].size();
+            }
+        };
+
+        std::vector<NodeIndex> frontier, settled;
+        for (size_t bucket = 0; pending > 0; ++bucket) {
+            std::vector<NodeIndex> &slot = slots[bucket % num_slots];
+            if (slot.empty()) continue;
+
+            // Light phases until the bucket stays empty; entries whose distance has moved
+            // to an earlier bucket are stale, and a node relaxes once per phase
+            settled.clear();
+            while (!slot.empty()) {
+                ++phase;
+                frontier.clear();
+                for (NodeIndex u : slot) {
+                    if (bucket_of(dist[u]) != bucket || relaxed_in[u] == phase) continue;
+                    relaxed_in[u] = phase;
+                    frontier.push_back(u);
+                    if (settled_in[u] != bucket + 1) {
+                        settled_in[u] = bucket + 1;
+                        settled.push_back(u);
+                    }
+                }
+                pending -= slot.size();
+                slot.clear();
+                relax(frontier, true);
+            }
+
+            // Heavy edges once per settled node: they all lead past this bucket
+            relax(settled, false);
+        }
+        return dist;
+    }
+
+    std::vector<double> distances(const RoadNetwork &network, NodeIndex source, bool reverse, Weights weights,
+                                  double delta, int num_threads) {
+        if (source >= network.num_nodes()) throw std::invalid_argument("DeltaStepping: source index out of range.");
+
+        if (weights == Weights::BASE) {
+            if (reverse)
+                return run<true>(network, source, [&](EdgeIndex e) { return network.rev_edge_weight(e); }, delta,
+                                 num_threads);
+            return run<false>(network, source, [&](EdgeIndex e) { return network.edge_weight(e); }, delta, num_threads);
+        }
+
+        // Weights of this run, unaffected by traffic updates published while it runs
+        const WeightSnapshot live = network.pin_weights();
+        if (reverse)
+            return run<true>(network, source, [&](EdgeIndex e) { return live.reverse(e); }, delta, num_threads);
+        return run<false>(network, source, [&](EdgeIndex e) { return live.forward(e); }, delta, num_threads);
+    }
+
+    std::vector<double> distances_from(const RoadNetwork &network, long long source_node_id, double delta,
+                                       int num_threads) {
+        const NodeIndex source = network.index_of(source_node_id);
+        if (source == INVALID_NODE_INDEX) throw std::runtime_error("Source node ID not found in NodeMap.");
+        return distances(network, source, false, Weights::LIVE, delta, num_threads);
+    }
+
+    std::vector<double> distances_to(const RoadNetwork &network, long long target_node_id, double delta,
+                                     int num_threads) {
+        const NodeIndex target = network.index_of(target_node_id);
+        if (target == INVALID_NODE_INDEX) throw std::runtime_error("Target node ID not found in NodeMap.");
+        return distances(network, target, true, Weights::LIVE, delta, num_threads);
+    }
+
+}
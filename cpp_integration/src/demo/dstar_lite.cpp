@@ -0,0 +1,149 @@
+#include "demo/dstar_lite.h"
+#include "demo/astar_policies.h"  // GreatCircleHeuristic
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace DStarLite {
+
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    Planner::Planner(const RoadNetwork &network, long long goal_node_id)
+        : network_(network), goal_(network.index_of(goal_node_id)) {
+        if (goal_ == INVALID_NODE_INDEX) throw std::runtime_error("Goal node ID not found in NodeMap.");
+        const size_t n = network.num_nodes();
+        g_.assign(n, INF);
+        rhs_.assign(n, INF);
+        rhs_[goal_] = 0.0;
+        open_.reserve_ids(n);
+
+        const WeightSnapshot weights = network.pin_weights();
+        known_weights_.resize(network.num_edges());
+        for (EdgeIndex e = 0; e < known_weights_.size(); ++e) known_weights_[e] = weights.forward(e);
+        known_version_ = weights.version();
+    }
+
+    Planner::Key Planner::calculate_key(NodeIndex u) const {
+        const double best = std::min(g_[u], rhs_[u]);
+        return {best + AStarEngine::GreatCircleHeuristic::estimate(network_, start_, u) + k_m_, best};
+    }
+
+    void Planner::update_vertex(NodeIndex u) {
+        if (g_[u] != rhs_[u]) {
+            if (open_.contains(u))
+                open_.update_key(u, calculate_key(u));
+            else
+                open_.push(u, calculate_key(u));
+        } else if (open_.contains(u)) {
+            open_.erase(u);
+        }
+    }
+
+    double Planner::lookahead(const WeightSnapshot &weights, NodeIndex u) const {
+        double best = INF;
+        for (EdgeIndex e = network_.edge_begin(u); e < network_.edge_end(u); ++e)
+            best = std::min(best, weights.forward(e) + g_[network_.edge_target(e)]);
+        return best;
+    }
+
+    void Planner::apply_weight_changes(const WeightSnapshot &weights) {
+        const size_t n = network_.num_nodes();
+        for (NodeIndex u = 0; u < n; ++u) {
+            bool changed = false;
+            for (EdgeIndex e = network_.edge_begin(u); e < network_.edge_end(u); ++e) {
+                const double weight = weights.forward(e);
+                if (weight != known_weights_[e]) {
+                    known_weights_[e] = weight;
+                    changed = true;
+                    ++last_changed_edges_;
+                }
+            }
+            // Recomputing rhs over all edges of u covers increases and decreases alike
+            if (changed && u != goal_) {
+                rhs_[u] = lookahead(weights, u);
+                update_vertex(u);
+            }
+        }
+        known_version_ = weights.version();
+    }
+
+    void Planner::compute_shortest_path(const WeightSnapshot &weights) {
+        while (!open_.empty()) {
+            auto [u, k_old] = open_.top();
+            if (!(k_old < calculate_key(start_)) && rhs_[start_] == g_[start_]) break;
+            ++last_expansions_;
+
+            const Key k_new = calculate_key(u);
+            if (k_old < k_new) {
+                // Key went stale (the start moved); re-queue with the current one
+                open_.update_key(u, k_new);
+            } else if (g_[u] > rhs_[u]) {
+                // Overconsistent: settle u and offer it to its predecessors
+                g_[u] = rhs_[u];
+                open_.erase(u);
+                for (EdgeIndex e = network_.rev_edge_begin(u); e < network_.rev_edge_end(u); ++e) {
+                    NodeIndex s = network_.rev_edge_source(e);
+                    if (s == goal_) continue;
+                    rhs_[s] = std::min(rhs_[s], weights.reverse(e) + g_[u]);
+                    update_vertex(s);
+                }
+            } else {
+                // Underconsistent: u got more expensive; predecessors that went through it
+                // look for another way
+                const double g_old = g_[u];
+                g_[u] = INF;
+                for (EdgeIndex e = network_.rev_edge_begin(u); e < network_.rev_edge_end(u); ++e) {
+                    NodeIndex s = network_.rev_edge_source(e);
+                    if (s != goal_ && rhs_[s] == weights.reverse(e) + g_old) rhs_[s] = lookahead(weights, s);
+                    update_vertex(s);
+                }
+                update_vertex(u);
+            }
+        }
+    }
+
+    std::vector<long long> Planner::search(long long start_node_id) {
+        NodeIndex start = network_.index_of(start_node_id);
+        if (start == INVALID_NODE_INDEX) throw std::runtime_error("Start node ID not found in NodeMap.");
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const WeightSnapshot weights = network_.pin_weights();
+        last_expansions_ = 0;
+        last_changed_edges_ = 0;
+
+        if (start_ == INVALID_NODE_INDEX) {
+            start_ = start;
+            open_.push(goal_, calculate_key(goal_));
+        } else if (start != start_) {
+            // Keys already queued stay lower bounds of the ones relative to the new start
+            k_m_ += AStarEngine::GreatCircleHeuristic::estimate(network_, start_, start);
+            start_ = start;
+        }
+        if (weights.version() != known_version_) apply_weight_changes(weights);
+        compute_shortest_path(weights);
+
+        std::vector<long long> path;
+        if (g_[start_] == INF) return path;
+
+        // Greedy descent along c + g from the start, which is consistent now
+        const size_t n = network_.num_nodes();
+        path.push_back(network_.id_of(start_));
+        for (NodeIndex u = start_; u != goal_;) {
+            NodeIndex next = INVALID_NODE_INDEX;
+            double best = INF;
+            for (EdgeIndex e = network_.edge_begin(u); e < network_.edge_end(u); ++e) {
+                const double candidate = weights.forward(e) + g_[network_.edge_target(e)];
+                if (candidate < best) {
+                    best = candidate;
+                    next = network_.edge_target(e);
+                }
+            }
+            if (next == INVALID_NODE_INDEX || path.size() > n)
+                throw std::logic_error("Planner: path extraction did not reach the goal.");
+            path.push_back(network_.id_of(next));
+            u = next;
+        }
+        return path;
+    }
+
+}
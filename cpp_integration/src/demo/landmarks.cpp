@@ -0,0 +1,146 @@
+#include "demo/landmarks.h"
+#include "demo/delta_stepping.h"
+#include "data_structure/pq_indexed_dary.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace Landmarks {
+
+    // Same open set as the sequential A* (indexed 4-ary heap with decrease_key)
+    using DistanceHeap = DataStructure::PriorityQueue::IndexedDaryHeap<4, double, std::greater<double>>;
+
+    // Position of a node on the unit sphere; chord length orders pairs like great-circle distance
+    struct UnitVector {
+        double x, y, z;
+    };
+
+    static UnitVector unit_vector(const RoadNetwork &network, NodeIndex u) {
+        double lat = network.lat(u) * M_PI / 180.0;
+        double lon = network.lon(u) * M_PI / 180.0;
+        return {std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon), std::sin(lat)};
+    }
+
+    static double squared_chord(const UnitVector &a, const UnitVector &b) {
+        double dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    std::vector<NodeIndex> select_farthest(const RoadNetwork &network, size_t count) {
+        const size_t n = network.num_nodes();
+
+        // Candidates: nodes a search can actually pass through
+        std::vector<NodeIndex> candidates;
+        std::vector<UnitVector> points;
+        UnitVector centroid{0.0, 0.0, 0.0};
+        for (NodeIndex u = 0; u < n; ++u) {
+            if (network.edge_begin(u) == network.edge_end(u) && network.rev_edge_begin(u) == network.rev_edge_end(u))
+                continue;
+            candidates.push_back(u);
+            points.push_back(unit_vector(network, u));
+            centroid.x += points.back().x;
+            centroid.y += points.back().y;
+            centroid.z += points.back().z;
+        }
+
+        std::vector<NodeIndex> selected;
+        if (candidates.empty()) return selected;
+        count = std::min(count, candidates.size());
+
+        // Projecting the centroid back onto the sphere gives the "middle" of the map
+        double norm = std::sqrt(centroid.x * centroid.x + centroid.y * centroid.y + centroid.z * centroid.z);
+        if (norm > 0.0) centroid = {centroid.x / norm, centroid.y / norm, centroid.z / norm};
+
+        // The first pick is the candidate farthest from the centroid; after that,
+        // min_distance[c] is the distance of candidate c to its closest landmark
+        std::vector<double> min_distance(candidates.size());
+        for (size_t c = 0; c < candidates.size(); ++c)
+            min_distance[c] = squared_chord(points[c], centroid);
+
+        while (selected.size() < count) {
+            size_t best = static_cast<size_t>(std::max_element(min_distance.begin(), min_distance.end()) - min_distance.begin());
+            if (!selected.empty() && min_distance[best] <= 0.0) break;  // Only copies of chosen points left
+            selected.push_back(candidates[best]);
+
+            const UnitVector chosen = points[best];
+            for (size_t c = 0; c < candidates.size(); ++c) {
+                double distance = squared_chord(points[c], chosen);
+                min_distance[c] = selected.size() == 1 ? distance : std::min(min_distance[c], distance);
+            }
+        }
+        return selected;
+    }
+
+    // Single-source Dijkstra over the forward edges (d(source, v)) or, with reverse, over
+    // the reverse CSR (d(v, source)). dist is resized to the network and INF where unreachable.
+    static void shortest_distances(const RoadNetwork &network, NodeIndex source, bool reverse,
+                                   std::vector<double> &dist, DistanceHeap &heap) {
+        dist.assign(network.num_nodes(), std::numeric_limits<double>::infinity());
+        heap.clear();
+        heap.reserve_ids(network.num_nodes());
+
+        dist[source] = 0.0;
+        heap.push(source, 0.0);
+        while (!heap.empty()) {
+            auto [u, d] = heap.pop();
+            EdgeIndex begin = reverse ? network.rev_edge_begin(u) : network.edge_begin(u);
+            EdgeIndex end = reverse ? network.rev_edge_end(u) : network.edge_end(u);
+            for (EdgeIndex e = begin; e < end; ++e) {
+                NodeIndex v = reverse ? network.rev_edge_source(e) : network.edge_target(e);
+                double candidate = d + (reverse ? network.rev_edge_weight(e) : network.edge_weight(e));
+                if (candidate < dist[v]) {
+                    dist[v] = candidate;
+                    heap.push_or_decrease(v, candidate);
+                }
+            }
+        }
+    }
+
+    void preprocess(RoadNetwork &network, size_t count, int num_threads) {
+        if (count == 0 || count > MAX_LANDMARKS)
+            throw std::invalid_argument("Landmarks::preprocess: count must be between 1 and "
+                                        + std::to_string(MAX_LANDMARKS) + ".");
+
+        std::vector<NodeIndex> landmarks = select_farthest(network, count);
+        const size_t k = landmarks.size();
+        const size_t n = network.num_nodes();
+        if (k == 0) throw std::invalid_argument("Landmarks::preprocess: the network has no edges.");
+
+        // Job 2i fills column i of "from", job 2i + 1 column i of "to". Jobs write disjoint
+        // elements, so the node-major tables are filled in place without locking.
+        std::vector<float> from(n * k), to(n * k);
+        auto fill = [&](size_t job, const std::vector<double> &dist) {
+            std::vector<float> &table = job % 2 == 1 ? to : from;
+            for (size_t v = 0; v < n; ++v)
+                table[v * k + job / 2] = static_cast<float>(dist[v]);
+        };
+
+        const size_t pool_threads = ThreadPool::instance().concurrency();
+        const size_t threads = num_threads > 0 ? std::min(static_cast<size_t>(num_threads), pool_threads) : pool_threads;
+        if (2 * k < threads) {
+            // Too few runs to occupy the pool: run them one after another, each parallel inside
+            for (size_t job = 0; job < 2 * k; ++job)
+                fill(job, DeltaStepping::distances(network, landmarks[job / 2], job % 2 == 1,
+                                                   DeltaStepping::Weights::BASE, 0.0, static_cast<int>(threads)));
+        } else {
+            ThreadPool::instance().parallel_for(2 * k, [&](size_t job) {
+                thread_local std::vector<double> dist;
+                thread_local DistanceHeap heap;
+                shortest_distances(network, landmarks[job / 2], job % 2 == 1, dist, heap);
+                fill(job, dist);
+            }, threads);
+        }
+
+        network.set_landmarks(std::move(landmarks), std::move(from), std::move(to));
+    }
+
+}
@@ -3,6 +3,7 @@ import os
 import time
 import random
 import networkx as nx
+import numpy as np
 import osmnx as ox
 
 # --- Configuration ---
@@ -119,6 +120,32 @@ def prepare_cpp_data(G_nx, weight_attribute):
     return nodes_dict, graph_dict
 
 
+# --- Helper: Prepare NumPy Arrays for C++ Module ---
+def prepare_cpp_arrays(G_nx, weight_attribute):
+    """Converts NetworkX graph data to flat NumPy arrays for the zero-copy RoadNetwork constructor.
+
+    Parallel edges are kept; the shortest one always wins during the search anyway.
+    """
+    print("Preparing NumPy arrays for C++ module...")
+    start_time = time.time()
+    node_rows = [
+        (node, data["y"], data["x"])
+        for node, data in G_nx.nodes(data=True)
+        if "y" in data and "x" in data
+    ]
+    edge_rows = [
+        (u, v, w) for u, v, w in G_nx.edges(data=weight_attribute) if w is not None
+    ]
+    node_ids = np.fromiter((r[0] for r in node_rows), dtype=np.int64, count=len(node_rows))
+    lats = np.fromiter((r[1] for r in node_rows), dtype=np.float64, count=len(node_rows))
+    lons = np.fromiter((r[2] for r in node_rows), dtype=np.float64, count=len(node_rows))
+    sources = np.fromiter((r[0] for r in edge_rows), dtype=np.int64, count=len(edge_rows))
+    targets = np.fromiter((r[1] for r in edge_rows), dtype=np.int64, count=len(edge_rows))
+    weights = np.fromiter((r[2] for r in edge_rows), dtype=np.float64, count=len(edge_rows))
+    print(f"Array preparation finished in {time.time() - start_time:.2f} seconds.")
+    return node_ids, lats, lons, sources, targets, weights
+
+
 # --- Helper: Run C++ A* Search ---
 def run_cpp_astar(cpp_module, cpp_network, start_node, end_node):
     """Runs the C++ A* implementation and returns the path and execution time."""
@@ -241,18 +268,25 @@ def main():
     G_nx = load_graph_from_graphml(GRAPHML_PATH)
 
     # Prepare data structures for C++
-    nodes_dict, graph_dict = prepare_cpp_data(G_nx, WEIGHT_ATTRIBUTE)
+    node_ids, lats, lons, sources, targets, weights = prepare_cpp_arrays(
+        G_nx, WEIGHT_ATTRIBUTE
+    )
 
-    # Create C++ RoadNetwork object
+    # Create C++ RoadNetwork object (NumPy constructor, no per-element conversion)
     try:
-        cpp_road_network = assignment2_cpp.RoadNetwork(graph_dict, nodes_dict)
-        print("C++ RoadNetwork object created successfully.")
+        start_time = time.time()
+        cpp_road_network = assignment2_cpp.RoadNetwork(
+            node_ids, lats, lons, sources, targets, weights
+        )
+        print(
+            f"C++ RoadNetwork object created successfully in {time.time() - start_time:.4f} seconds."
+        )
     except Exception as e:
         print(f"Error creating C++ RoadNetwork object: {e}")
         sys.exit(1)
 
     # Select random start/end nodes
-    node_list = list(nodes_dict.keys())
+    node_list = node_ids.tolist()
     if len(node_list) < 2:
         print(
             "Error: Not enough nodes with coordinates in the graph to test pathfinding."
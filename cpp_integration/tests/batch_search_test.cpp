@@ -0,0 +1,181 @@
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "demo/batch_search.h"
+#include "road_network.h"
+#include "test_networks.h"
+#include "thread_pool.h"
+
+namespace
+{
+
+// Checks that slice i of the buffer is a shortest starts[i] -> goals[i] path
+void expect_shortest_paths(const BatchSearch::PathBuffer &buffer, const TestNetworks::TestGraph &test,
+                           const std::vector<long long> &starts, const std::vector<long long> &goals)
+{
+    ASSERT_EQ(buffer.offsets.size(), starts.size() + 1);
+    EXPECT_EQ(buffer.offsets.front(), 0);
+    EXPECT_EQ(static_cast<size_t>(buffer.offsets.back()), buffer.ids.size());
+    for (size_t i = 0; i < starts.size(); ++i)
+    {
+        ASSERT_LE(buffer.offsets[i], buffer.offsets[i + 1]);
+        const std::vector<long long> path(buffer.ids.begin() + buffer.offsets[i],
+                                          buffer.ids.begin() + buffer.offsets[i + 1]);
+        const double expected = TestNetworks::distance(test.graph, starts[i], goals[i]);
+        if (expected == TestNetworks::INF)
+        {
+            EXPECT_TRUE(path.empty()) << "query " << i;
+            continue;
+        }
+        ASSERT_FALSE(path.empty()) << "query " << i;
+        EXPECT_EQ(path.front(), starts[i]);
+        EXPECT_EQ(path.back(), goals[i]);
+        EXPECT_NEAR(TestNetworks::path_cost(test.graph, path), expected, 1e-9 * (1.0 + expected)) << "query " << i;
+    }
+}
+
+// Grid plus a sink (only incoming edges) and an isolated node, so some pairs are unreachable
+TestNetworks::TestGraph grid_with_dead_ends(unsigned seed)
+{
+    TestNetworks::TestGraph test = TestNetworks::grid(14, 10, seed);
+    const long long sink = 1, isolated = 2;
+    test.nodes.emplace(sink, Node(sink, 51.4991, -0.1));
+    test.nodes.emplace(isolated, Node(isolated, 51.4982, -0.1));
+    test.graph[test.ids.front()].emplace_back(sink, 150.0);
+    test.graph[sink];
+    test.graph[isolated];
+    test.ids.push_back(sink);
+    test.ids.push_back(isolated);
+    return test;
+}
+
+}  // namespace
+
+// Attaching, resizing and detaching the path cache while search_many runs: every query
+// keeps the cache it started with, and the answers stay shortest paths.
+TEST(BatchSearchTest, SwapsPathCacheDuringSearchMany)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::grid(16, 12, 5);
+    RoadNetwork network(test.graph, test.nodes);
+    network.set_path_cache(64);
+
+    // Few distinct pairs, so that queries hit the cache that is being replaced
+    std::vector<long long> starts, goals;
+    for (size_t q = 0; q < 400; ++q)
+    {
+        starts.push_back(test.ids[(q % 13) * 11 % test.ids.size()]);
+        goals.push_back(test.ids[(q % 7) * 29 % test.ids.size()]);
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread swapper(
+        [&]
+        {
+            for (size_t k = 0; !stop.load(); ++k)
+            {
+                network.set_path_cache(k % 3 == 0 ? 0 : 16 * (k % 5 + 1));
+                network.clear_path_cache();
+                (void)network.path_cache();
+            }
+        });
+    for (int round = 0; round < 20; ++round)
+        expect_shortest_paths(BatchSearch::search_many(network, starts, goals, 4), test, starts, goals);
+    stop.store(true);
+    swapper.join();
+}
+
+// Every entry equals the reference Dijkstra distance, with duplicate targets, a source
+// that is also a target and unreachable pairs (+infinity), whatever the thread count.
+TEST(BatchSearchTest, DistanceMatrixMatchesDijkstra)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = grid_with_dead_ends(6);
+    const RoadNetwork network(test.graph, test.nodes);
+    const long long sink = 1, isolated = 2;
+
+    std::vector<long long> sources = {test.ids[0], test.ids[17], sink, isolated, test.ids[17]};
+    std::vector<long long> targets = {test.ids[17], test.ids[3], test.ids[17], sink, isolated, test.ids[0]};
+    for (size_t k = 0; k < 12; ++k)
+    {
+        sources.push_back(test.ids[(k * 23 + 5) % (test.ids.size() - 2)]);
+        targets.push_back(test.ids[(k * 41 + 9) % (test.ids.size() - 2)]);
+    }
+
+    std::vector<double> expected;
+    for (long long source : sources)
+    {
+        const auto dist = TestNetworks::dijkstra(test.graph, source);
+        for (long long target : targets)
+        {
+            auto it = dist.find(target);
+            expected.push_back(it == dist.end() ? TestNetworks::INF : it->second);
+        }
+    }
+    for (int threads : {1, 3, 0})
+    {
+        const std::vector<double> matrix = BatchSearch::distance_matrix(network, sources, targets, threads);
+        ASSERT_EQ(matrix.size(), sources.size() * targets.size());
+        for (size_t i = 0; i < matrix.size(); ++i)
+        {
+            if (expected[i] == TestNetworks::INF)
+                EXPECT_EQ(matrix[i], TestNetworks::INF) << "entry " << i << ", " << threads << " threads";
+            else
+                EXPECT_NEAR(matrix[i], expected[i], 1e-9 * (1.0 + expected[i]))
+                    << "entry " << i << ", " << threads << " threads";
+        }
+    }
+    EXPECT_EQ(BatchSearch::distance_matrix(network, sources, targets, 2)[1 * targets.size() + 0], 0.0);
+
+    const std::vector<long long> none;
+    EXPECT_TRUE(BatchSearch::distance_matrix(network, none, targets, 2).empty());
+    EXPECT_EQ(BatchSearch::distance_matrix(network, sources, none, 2).size(), 0u);
+    const std::vector<long long> unknown = {test.ids[0], 42};
+    EXPECT_THROW(BatchSearch::distance_matrix(network, unknown, targets, 2), std::invalid_argument);
+    EXPECT_THROW(BatchSearch::distance_matrix(network, sources, unknown, 2), std::invalid_argument);
+}
+
+// The offsets + ids buffer has one slice per query holding a shortest path (empty when
+// unreachable), identical for every thread count; bad input throws before any search.
+TEST(BatchSearchTest, SearchManyBuffer)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = grid_with_dead_ends(12);
+    const RoadNetwork network(test.graph, test.nodes);
+    const long long sink = 1, isolated = 2;
+
+    std::vector<long long> starts = {test.ids[0], test.ids[5], sink, test.ids[9], isolated};
+    std::vector<long long> goals = {sink, test.ids[5], test.ids[0], isolated, isolated};
+    for (size_t k = 0; k < 40; ++k)
+    {
+        starts.push_back(test.ids[(k * 37 + 2) % (test.ids.size() - 2)]);
+        goals.push_back(test.ids[(k * 53 + 19) % (test.ids.size() - 2)]);
+    }
+
+    const BatchSearch::PathBuffer reference = BatchSearch::search_many(network, starts, goals, 1);
+    expect_shortest_paths(reference, test, starts, goals);
+    EXPECT_EQ(reference.offsets[2] - reference.offsets[1], 1);  // start == goal
+    EXPECT_EQ(reference.offsets[3], reference.offsets[2]);  // No path out of the sink
+    for (int threads : {2, 4, 0})
+    {
+        const BatchSearch::PathBuffer buffer = BatchSearch::search_many(network, starts, goals, threads);
+        EXPECT_EQ(buffer.offsets, reference.offsets) << threads << " threads";
+        EXPECT_EQ(buffer.ids, reference.ids) << threads << " threads";
+    }
+
+    const std::vector<long long> none;
+    const BatchSearch::PathBuffer empty = BatchSearch::search_many(network, none, none, 2);
+    EXPECT_EQ(empty.offsets, (std::vector<std::int64_t>{0}));
+    EXPECT_TRUE(empty.ids.empty());
+
+    const std::vector<long long> short_goals(goals.begin(), goals.end() - 1);
+    EXPECT_THROW(BatchSearch::search_many(network, starts, short_goals, 2), std::invalid_argument);
+    std::vector<long long> unknown = goals;
+    unknown[7] = 42;
+    EXPECT_THROW(BatchSearch::search_many(network, starts, unknown, 2), std::invalid_argument);
+    EXPECT_THROW(BatchSearch::search_many(network, unknown, starts, 2), std::invalid_argument);
+}
@@ -0,0 +1,169 @@
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>  // For getpid
+#include <utility>
+#include <vector>
+
+#include "binary_format.h"
+#include "demo/astar.h"
+#include "road_network.h"
+#include "test_networks.h"
+
+namespace
+{
+
+using BinaryFormat::Header;
+using BinaryFormat::SectionId;
+
+class BinaryFormatTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        directory_ = std::filesystem::temp_directory_path() / ("binary_format_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(directory_);
+        test_ = TestNetworks::grid(12, 9, 7);
+        RoadNetwork network(test_.graph, test_.nodes);
+        const size_t n = network.num_nodes();
+        network.set_landmarks({0, static_cast<NodeIndex>(n - 1)}, std::vector<float>(2 * n, 0.0f),
+                              std::vector<float>(2 * n, 0.0f));
+        network.save_binary(path("good.rnet"));
+        std::ifstream in(path("good.rnet"), std::ios::binary);
+        bytes_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory_); }
+
+    std::string path(const std::string &name) const { return (directory_ / name).string(); }
+
+    // Writes bytes to name and returns its path
+    std::string write(const std::string &name, const std::vector<char> &bytes) const
+    {
+        std::ofstream out(path(name), std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        return path(name);
+    }
+
+    Header &header(std::vector<char> &bytes) const { return *reinterpret_cast<Header *>(bytes.data()); }
+
+    // Payload of a section in bytes, as T
+    template <typename T>
+    T *section(std::vector<char> &bytes, SectionId id) const
+    {
+        const Header &h = header(bytes);
+        for (std::uint32_t i = 0; i < h.section_count; ++i)
+            if (h.sections[i].id == static_cast<std::uint32_t>(id))
+                return reinterpret_cast<T *>(bytes.data() + h.sections[i].offset);
+        return nullptr;
+    }
+
+    // A copy of the good file with one change applied
+    template <typename Change>
+    std::string corrupt(const std::string &name, Change change) const
+    {
+        std::vector<char> bytes = bytes_;
+        change(bytes);
+        return write(name, bytes);
+    }
+
+    std::filesystem::path directory_;
+    TestNetworks::TestGraph test_;
+    std::vector<char> bytes_;
+};
+
+}  // namespace
+
+// A file written by save_binary() opens with and without verification and answers alike.
+TEST_F(BinaryFormatTest, RoundTrip)
+{
+    const RoadNetwork original(test_.graph, test_.nodes);
+    for (bool verify : {true, false})
+    {
+        const RoadNetwork mapped = RoadNetwork::open_mmap(path("good.rnet"), verify);
+        EXPECT_TRUE(mapped.is_mapped());
+        EXPECT_EQ(mapped.num_nodes(), original.num_nodes());
+        EXPECT_EQ(mapped.num_edges(), original.num_edges());
+        EXPECT_EQ(mapped.landmarks().count, 2u);
+        for (size_t q = 0; q < 20; ++q)
+        {
+            const long long start = test_.ids[(q * 37) % test_.ids.size()];
+            const long long goal = test_.ids[(q * 53 + 11) % test_.ids.size()];
+            EXPECT_EQ(AStar::search(mapped, start, goal), AStar::search(original, start, goal));
+        }
+    }
+}
+
+// Truncated files and section directories pointing outside the file, including offsets
+// and sizes that overflow when added or multiplied.
+TEST_F(BinaryFormatTest, RejectsBadBounds)
+{
+    std::vector<char> truncated(bytes_.begin(), bytes_.begin() + static_cast<std::ptrdiff_t>(bytes_.size() / 2));
+    EXPECT_THROW(RoadNetwork::open_mmap(write("truncated.rnet", truncated)), std::runtime_error);
+
+    EXPECT_THROW(RoadNetwork::open_mmap(corrupt("offset.rnet",
+                                                [&](std::vector<char> &bytes)
+                                                {
+                                                    for (auto &s : header(bytes).sections)
+                                                        if (s.id == static_cast<std::uint32_t>(SectionId::Targets))
+                                                            s.offset = UINT64_MAX - 7;
+                                                })),
+                 std::runtime_error);
+    EXPECT_THROW(RoadNetwork::open_mmap(corrupt("nodes.rnet",
+                                                [&](std::vector<char> &bytes)
+                                                { header(bytes).num_nodes = UINT64_MAX / 8; })),
+                 std::runtime_error);
+    EXPECT_THROW(RoadNetwork::open_mmap(corrupt("landmarks.rnet",
+                                                [&](std::vector<char> &bytes)
+                                                {
+                                                    for (auto &s : header(bytes).sections)
+                                                        if (s.id == static_cast<std::uint32_t>(SectionId::LandmarkIds))
+                                                            s.bytes = UINT64_MAX / 4 * 4;
+                                                })),
+                 std::runtime_error);
+}
+
+// Indices that would send searches out of bounds, and a reverse CSR that is not the
+// transposition of the forward one, are caught by the verification pass.
+TEST_F(BinaryFormatTest, RejectsBadIndices)
+{
+    const std::vector<std::pair<std::string, std::function<void(std::vector<char> &)>>> corruptions = {
+        {"decreasing offsets", [&](std::vector<char> &b) { section<EdgeIndex>(b, SectionId::Offsets)[3] = 1000000; }},
+        {"target out of range", [&](std::vector<char> &b) { section<NodeIndex>(b, SectionId::Targets)[5] = 5000; }},
+        {"reverse source out of range",
+         [&](std::vector<char> &b) { section<NodeIndex>(b, SectionId::RevSources)[2] = 5000; }},
+        {"reverse source in range but wrong",
+         [&](std::vector<char> &b)
+         {
+             NodeIndex *sources = section<NodeIndex>(b, SectionId::RevSources);
+             sources[2] = (sources[2] + 1) % static_cast<NodeIndex>(test_.ids.size());
+         }},
+        {"reverse weight", [&](std::vector<char> &b) { section<double>(b, SectionId::RevWeights)[6] *= 2.0; }},
+        {"reverse degrees",
+         [&](std::vector<char> &b)
+         {
+             EdgeIndex *rev = section<EdgeIndex>(b, SectionId::RevOffsets);
+             rev[4] = rev[3];  // Moves node 3's incoming edges to node 4
+         }},
+        {"unsorted id map",
+         [&](std::vector<char> &b)
+         {
+             long long *ids = section<long long>(b, SectionId::IdMapIds);
+             std::swap(ids[0], ids[1]);
+         }},
+        {"id map index out of range",
+         [&](std::vector<char> &b) { section<NodeIndex>(b, SectionId::IdMapIndex)[7] = 999999; }},
+        {"landmark out of range", [&](std::vector<char> &b) { section<NodeIndex>(b, SectionId::LandmarkIds)[1] = 5000; }},
+    };
+    int k = 0;
+    for (const auto &[name, change] : corruptions)
+    {
+        const std::string file = corrupt("bad" + std::to_string(k++) + ".rnet", change);
+        EXPECT_THROW(RoadNetwork::open_mmap(file), std::runtime_error) << name;
+    }
+}
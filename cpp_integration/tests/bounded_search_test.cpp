@@ -0,0 +1,127 @@
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "demo/astar.h"
+#include "road_network.h"
+#include "test_networks.h"
+
+namespace
+{
+
+using AStarEngine::BoundedMode;
+using AStarEngine::SearchOptions;
+using AStarEngine::SearchResult;
+using AStarEngine::SearchStatus;
+
+// Checks that path starts at start and every step is an edge
+void expect_walk(const Graph &graph, const std::vector<long long> &path, long long start)
+{
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(path.front(), start);
+    EXPECT_FALSE(std::isnan(TestNetworks::path_cost(graph, path))) << "a step is not an edge";
+}
+
+}  // namespace
+
+// Weighted and focal search return a path within epsilon of the optimum, and report the
+// cost of the path they return.
+TEST(BoundedSearchTest, WithinEpsilonOfOptimum)
+{
+    const TestNetworks::TestGraph test = TestNetworks::grid(24, 18, 21, 0.1);
+    const RoadNetwork network(test.graph, test.nodes);
+    for (BoundedMode mode : {BoundedMode::WEIGHTED, BoundedMode::FOCAL})
+        for (double epsilon : {1.0, 1.1, 1.5, 3.0})
+            for (size_t q = 0; q < 20; ++q)
+            {
+                const long long start = test.ids[(q * 131 + 7) % test.ids.size()];
+                const long long goal = test.ids[(q * 61 + 200) % test.ids.size()];
+                const double optimum = TestNetworks::distance(test.graph, start, goal);
+                SearchOptions options;
+                options.mode = mode;
+                options.epsilon = epsilon;
+                const SearchResult result = AStar::search_bounded(network, start, goal, options);
+                if (optimum == TestNetworks::INF)
+                {
+                    EXPECT_EQ(result.status, SearchStatus::UNREACHABLE);
+                    EXPECT_TRUE(result.path.empty());
+                    continue;
+                }
+                ASSERT_EQ(result.status, SearchStatus::FOUND);
+                expect_walk(test.graph, result.path, start);
+                EXPECT_EQ(result.path.back(), goal);
+                EXPECT_GT(result.expanded, 0u);
+                const double cost = TestNetworks::path_cost(test.graph, result.path);
+                EXPECT_NEAR(result.cost, cost, 1e-9 * (1.0 + cost));
+                EXPECT_LE(cost, epsilon * optimum * (1.0 + 1e-9))
+                    << (mode == BoundedMode::FOCAL ? "focal" : "weighted") << ", epsilon " << epsilon;
+            }
+}
+
+// A cost cap below the optimum gives COST_CAP without a path; a cap at the optimum
+// still finds it.
+TEST(BoundedSearchTest, CostCap)
+{
+    const TestNetworks::TestGraph test = TestNetworks::grid(16, 12, 9);
+    const RoadNetwork network(test.graph, test.nodes);
+    const long long start = test.ids.front(), goal = test.ids.back();
+    const double optimum = TestNetworks::distance(test.graph, start, goal);
+    ASSERT_NE(optimum, TestNetworks::INF);
+    for (BoundedMode mode : {BoundedMode::WEIGHTED, BoundedMode::FOCAL})
+    {
+        SearchOptions options;
+        options.mode = mode;
+        options.epsilon = 1.2;
+        for (double fraction : {0.0, 0.5, 0.99})
+        {
+            options.cost_cap = fraction * optimum;
+            const SearchResult result = AStar::search_bounded(network, start, goal, options);
+            EXPECT_EQ(result.status, SearchStatus::COST_CAP) << fraction;
+            EXPECT_TRUE(result.path.empty());
+        }
+        options.epsilon = 1.0;
+        options.cost_cap = optimum * (1.0 + 1e-9);
+        const SearchResult result = AStar::search_bounded(network, start, goal, options);
+        EXPECT_EQ(result.status, SearchStatus::FOUND);
+        EXPECT_NEAR(result.cost, optimum, 1e-9 * optimum);
+    }
+}
+
+// Expansion and time limits stop the search with the best partial path, which starts at
+// the start; epsilon below 1 is rejected.
+TEST(BoundedSearchTest, LimitsAndInvalidOptions)
+{
+    const TestNetworks::TestGraph test = TestNetworks::grid(16, 12, 9);
+    const RoadNetwork network(test.graph, test.nodes);
+    const long long start = test.ids.front(), goal = test.ids.back();
+    for (BoundedMode mode : {BoundedMode::WEIGHTED, BoundedMode::FOCAL})
+    {
+        SearchOptions options;
+        options.mode = mode;
+        for (std::uint64_t limit : {1, 5, 20})
+        {
+            options.max_expansions = limit;
+            const SearchResult result = AStar::search_bounded(network, start, goal, options);
+            EXPECT_EQ(result.status, SearchStatus::EXPANSION_LIMIT) << limit;
+            EXPECT_LE(result.expanded, limit);
+            expect_walk(test.graph, result.path, start);
+            EXPECT_NE(result.path.back(), goal);
+            EXPECT_NEAR(result.cost, TestNetworks::path_cost(test.graph, result.path), 1e-9 * (1.0 + result.cost));
+        }
+
+        options.max_expansions = 0;
+        options.time_limit_s = 1e-12;
+        const SearchResult result = AStar::search_bounded(network, start, goal, options);
+        EXPECT_EQ(result.status, SearchStatus::DEADLINE);
+        expect_walk(test.graph, result.path, start);
+
+        options.time_limit_s = 0.0;
+        for (double epsilon : {0.999, 0.0, -1.0})
+        {
+            options.epsilon = epsilon;
+            EXPECT_THROW(AStar::search_bounded(network, start, goal, options), std::invalid_argument);
+        }
+    }
+}
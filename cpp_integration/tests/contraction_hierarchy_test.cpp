@@ -0,0 +1,78 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "demo/contraction_hierarchy.h"
+#include "road_network.h"
+#include "test_networks.h"
+#include "thread_pool.h"
+
+namespace
+{
+
+// Checks ch.search against Dijkstra for queries spread over the test graph
+void expect_shortest_paths(const TestNetworks::TestGraph &test, const RoadNetwork &network,
+                           const CH::ContractionHierarchy &ch, size_t queries)
+{
+    for (size_t q = 0; q < queries; ++q)
+    {
+        const long long start = test.ids[(q * 7919) % test.ids.size()];
+        const long long goal = test.ids[(q * 104729 + 13) % test.ids.size()];
+        const double expected = TestNetworks::distance(test.graph, start, goal);
+        const std::vector<long long> path = ch.search(network, start, goal);
+        if (expected == TestNetworks::INF)
+        {
+            EXPECT_TRUE(path.empty()) << start << " -> " << goal;
+            continue;
+        }
+        ASSERT_FALSE(path.empty()) << start << " -> " << goal;
+        EXPECT_EQ(path.front(), start);
+        EXPECT_EQ(path.back(), goal);
+        EXPECT_NEAR(TestNetworks::path_cost(test.graph, path), expected, 1e-9 * (1.0 + expected))
+            << start << " -> " << goal;
+    }
+}
+
+}  // namespace
+
+// A chain of 0-weight edges: contracting the middle node must keep the 0-weight shortcut.
+TEST(ContractionHierarchyTest, ZeroWeightChain)
+{
+    const TestNetworks::TestGraph test = TestNetworks::from_edges(
+        {{51.5, -0.1}, {51.5, -0.1}, {51.5, -0.1}}, {{0, 1, 0.0}, {1, 2, 0.0}});
+    const RoadNetwork network(test.graph, test.nodes);
+    const CH::ContractionHierarchy ch = CH::ContractionHierarchy::build(network, 1);
+    EXPECT_EQ(ch.search(network, 0, 2), (std::vector<long long>{0, 1, 2}));
+    EXPECT_EQ(ch.search(network, 2, 0), std::vector<long long>{});
+    EXPECT_EQ(ch.search(network, 1, 1), std::vector<long long>{1});
+}
+
+// Shortest paths on grids, with and without zero-length edges, for several thread counts.
+TEST(ContractionHierarchyTest, MatchesDijkstra)
+{
+    ThreadPool::configure(4, false);
+    for (double zero_fraction : {0.0, 0.1, 0.3})
+    {
+        const TestNetworks::TestGraph test = TestNetworks::grid(20, 15, 3, zero_fraction);
+        const RoadNetwork network(test.graph, test.nodes);
+        for (int threads : {1, 4})
+        {
+            const CH::ContractionHierarchy ch = CH::ContractionHierarchy::build(network, threads);
+            EXPECT_EQ(ch.num_nodes(), network.num_nodes());
+            expect_shortest_paths(test, network, ch, 120);
+        }
+    }
+}
+
+// Queries refuse a network whose weights changed after the build.
+TEST(ContractionHierarchyTest, RejectsChangedWeights)
+{
+    const TestNetworks::TestGraph test = TestNetworks::grid(6, 5, 1);
+    RoadNetwork network(test.graph, test.nodes);
+    const CH::ContractionHierarchy ch = CH::ContractionHierarchy::build(network, 1);
+    const std::array<EdgeIndex, 1> edges = {0};
+    const std::array<double, 1> weights = {1.0e6};
+    network.update_traffic(edges, weights);
+    EXPECT_THROW(ch.search(network, test.ids[0], test.ids[1]), std::invalid_argument);
+}
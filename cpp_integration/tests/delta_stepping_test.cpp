@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "demo/astar.h"
+#include "demo/delta_stepping.h"
+#include "road_network.h"
+#include "test_networks.h"
+#include "thread_pool.h"
+
+namespace
+{
+
+// Δ-stepping distances (indexed like node_ids()) against Dijkstra on graph
+void expect_distances(const RoadNetwork &network, const Graph &graph, long long source,
+                      const std::vector<double> &dist)
+{
+    const std::unordered_map<long long, double> expected = TestNetworks::dijkstra(graph, source);
+    ASSERT_EQ(dist.size(), network.num_nodes());
+    for (NodeIndex u = 0; u < network.num_nodes(); ++u)
+    {
+        auto it = expected.find(network.id_of(u));
+        const double reference = it == expected.end() ? TestNetworks::INF : it->second;
+        if (reference == TestNetworks::INF)
+            EXPECT_EQ(dist[u], TestNetworks::INF) << network.id_of(u);
+        else
+            EXPECT_NEAR(dist[u], reference, 1e-9 * (1.0 + reference)) << network.id_of(u);
+    }
+}
+
+// graph with every edge reversed
+Graph reversed(const Graph &graph)
+{
+    Graph reverse;
+    for (const auto &[u, edges] : graph)
+    {
+        reverse[u];
+        for (const Edge &edge : edges)
+            reverse[edge.target_node_id].emplace_back(u, edge.weight);
+    }
+    return reverse;
+}
+
+}  // namespace
+
+// Distances from and to a node for automatic, tiny, large and infinite Δ and several
+// thread counts, on a grid with zero-length edges.
+TEST(DeltaSteppingTest, MatchesDijkstra)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::grid(30, 20, 5, 0.1);
+    const RoadNetwork network(test.graph, test.nodes);
+    const Graph reverse = reversed(test.graph);
+    for (double delta : {0.0, 1.0, 500.0, std::numeric_limits<double>::infinity()})
+        for (int threads : {1, 4})
+        {
+            const long long source = test.ids[(threads * 131) % test.ids.size()];
+            expect_distances(network, test.graph, source,
+                             DeltaStepping::distances_from(network, source, delta, threads));
+            expect_distances(network, reverse, source, DeltaStepping::distances_to(network, source, delta, threads));
+        }
+}
+
+// An edge closed by a +infinity traffic update is skipped instead of sizing Δ and the
+// buckets (which used to overflow the bucket array).
+TEST(DeltaSteppingTest, ClosedEdges)
+{
+    const TestNetworks::TestGraph chain = TestNetworks::from_edges(
+        {{51.5, -0.1}, {51.5, -0.099}, {51.5, -0.098}, {51.5, -0.097}},
+        {{0, 1, 100.0}, {1, 2, 100.0}, {2, 3, 100.0}, {0, 2, 500.0}});
+    RoadNetwork network(chain.graph, chain.nodes);
+    const std::vector<long long> sources = {1}, targets = {2};
+    const std::vector<double> closed = {std::numeric_limits<double>::infinity()};
+    ASSERT_EQ(network.update_traffic(sources, targets, closed), 1u);
+
+    for (int threads : {1, 2})
+    {
+        const std::vector<double> dist = DeltaStepping::distances_from(network, 0, 0.0, threads);
+        ASSERT_EQ(dist.size(), 4u);
+        EXPECT_EQ(dist[network.index_of(1)], 100.0);
+        EXPECT_EQ(dist[network.index_of(2)], 500.0);  // Around the closed edge
+        EXPECT_EQ(dist[network.index_of(3)], 600.0);
+        EXPECT_EQ(DeltaStepping::distances_from(network, 1, 0.0, threads)[network.index_of(2)], TestNetworks::INF);
+    }
+    EXPECT_EQ(AStar::search(network, 0, 3), (std::vector<long long>{0, 2, 3}));
+
+    // Closing many edges of a grid: same as Dijkstra without them
+    ThreadPool::configure(4, false);
+    TestNetworks::TestGraph test = TestNetworks::grid(20, 15, 9);
+    RoadNetwork grid(test.graph, test.nodes);
+    std::vector<long long> from, to;
+    std::vector<double> weights;
+    for (size_t k = 0; k < test.ids.size(); k += 5)
+        for (Edge &edge : test.graph[test.ids[k]])
+        {
+            from.push_back(test.ids[k]);
+            to.push_back(edge.target_node_id);
+            weights.push_back(std::numeric_limits<double>::infinity());
+            edge.weight = std::numeric_limits<double>::infinity();
+        }
+    grid.update_traffic(from, to, weights);
+    expect_distances(grid, test.graph, test.ids[1], DeltaStepping::distances_from(grid, test.ids[1], 0.0, 4));
+}
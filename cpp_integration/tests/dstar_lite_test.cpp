@@ -0,0 +1,132 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>  // For std::mt19937
+#include <vector>
+
+#include "demo/dstar_lite.h"
+#include "road_network.h"
+#include "test_networks.h"
+
+namespace
+{
+
+// The planner's route from start must be a path of the reference graph to goal costing
+// what Dijkstra says under the current weights
+void expect_shortest(DStarLite::Planner &planner, const Graph &graph, long long start, long long goal)
+{
+    const std::vector<long long> route = planner.search(start);
+    const double expected = TestNetworks::distance(graph, start, goal);
+    if (expected == TestNetworks::INF)
+    {
+        EXPECT_TRUE(route.empty()) << start << " -> " << goal;
+        return;
+    }
+    ASSERT_FALSE(route.empty()) << start << " -> " << goal;
+    EXPECT_EQ(route.front(), start);
+    EXPECT_EQ(route.back(), goal);
+    EXPECT_NEAR(TestNetworks::path_cost(graph, route), expected, 1e-9 * (1.0 + expected)) << start << " -> " << goal;
+}
+
+}  // namespace
+
+// Random moves of the start, weight increases, decreases, closures and clears between
+// searches: every repaired search (k_m bookkeeping, over- and underconsistent updates)
+// returns a shortest path under the weights published at the time.
+TEST(DStarLiteTest, RepairsMatchDijkstra)
+{
+    for (unsigned seed : {1u, 2u, 3u})
+    {
+        TestNetworks::TestGraph test = TestNetworks::grid(18, 14, seed);
+        const Graph base = test.graph;
+        RoadNetwork network(test.graph, test.nodes);
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<size_t> pick(0, test.ids.size() - 1);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+        const long long goal = test.ids[pick(gen)];
+        long long start = test.ids[pick(gen)];
+        DStarLite::Planner planner(network, goal);
+        expect_shortest(planner, test.graph, start, goal);
+
+        for (int round = 0; round < 40; ++round)
+        {
+            // Move: one step along the current route, or a jump
+            const std::vector<long long> route = planner.search(start);
+            if (route.size() > 1 && unit(gen) < 0.7)
+                start = route[1];
+            else
+                start = test.ids[pick(gen)];
+
+            if (round % 10 == 9)
+            {
+                network.clear_traffic();
+                test.graph = base;
+            }
+            else
+            {
+                // A batch of updates, some on the current route so they matter
+                std::vector<long long> from, to;
+                std::vector<double> weights;
+                for (int k = 0; k < 12; ++k)
+                {
+                    const long long u = k < 4 && route.size() > 2 ? route[1 + k % (route.size() - 1)] : test.ids[pick(gen)];
+                    std::vector<Edge> &edges = test.graph[u];
+                    if (edges.empty())
+                        continue;
+                    const size_t i = gen() % edges.size();
+                    Edge &edge = edges[i];
+                    // Live weights never drop below the base weight, so a decrease goes back
+                    // to (near) free flow
+                    const double free_flow = base.at(u)[i].weight;
+                    const double roll = unit(gen);
+                    const double weight = roll < 0.1   ? std::numeric_limits<double>::infinity()
+                                          : roll < 0.5 ? free_flow * (1.0 + 0.2 * unit(gen))
+                                                       : free_flow * (1.5 + 4.0 * unit(gen));
+                    edge.weight = weight;
+                    from.push_back(u);
+                    to.push_back(edge.target_node_id);
+                    weights.push_back(weight);
+                }
+                network.update_traffic(from, to, weights);
+            }
+            expect_shortest(planner, test.graph, start, goal);
+        }
+    }
+}
+
+// Without changes a repeated search expands nothing; the changed edges are counted once,
+// and planning resumes after the goal is cut off and reconnected.
+TEST(DStarLiteTest, CountsChangesAndRecovers)
+{
+    TestNetworks::TestGraph test = TestNetworks::grid(10, 8, 4);
+    RoadNetwork network(test.graph, test.nodes);
+    const long long start = test.ids.front(), goal = test.ids.back();
+    DStarLite::Planner planner(network, goal);
+    ASSERT_FALSE(planner.search(start).empty());
+    EXPECT_GT(planner.last_expansions(), 0u);
+    planner.search(start);
+    EXPECT_EQ(planner.last_expansions(), 0u);
+    EXPECT_EQ(planner.last_changed_edges(), 0u);
+
+    // Close every edge into the goal
+    std::vector<long long> from, to;
+    std::vector<double> closed;
+    for (const auto &[u, edges] : test.graph)
+        for (const Edge &edge : edges)
+            if (edge.target_node_id == goal)
+            {
+                from.push_back(u);
+                to.push_back(goal);
+                closed.push_back(std::numeric_limits<double>::infinity());
+            }
+    ASSERT_FALSE(from.empty());
+    network.update_traffic(from, to, closed);
+    EXPECT_TRUE(planner.search(start).empty());
+    EXPECT_EQ(planner.last_changed_edges(), from.size());
+
+    network.clear_traffic();
+    const std::vector<long long> route = planner.search(start);
+    EXPECT_EQ(planner.last_changed_edges(), from.size());
+    EXPECT_NEAR(TestNetworks::path_cost(test.graph, route), TestNetworks::distance(test.graph, start, goal), 1e-6);
+}
@@ -0,0 +1,148 @@
+#include <atomic>  // For std::atomic
+#include <gtest/gtest.h>
+#include <thread>  // For std::thread
+#include <vector>
+
+#include "data_structure/epoch_reclamation.h"
+#include "data_structure/set_lazy.h"
+
+using DataStructure::EpochDomain;
+
+namespace
+{
+
+// Counts deleter calls so tests can observe when retired objects are freed
+std::atomic<int> freed_count{0};
+
+struct Tracked
+{
+    int value;
+};
+
+void destroy_tracked(Tracked *object)
+{
+    delete object;
+    freed_count.fetch_add(1);
+}
+
+// Collects enough times for the epoch to move well past the current one
+void drive_epochs()
+{
+    for (int round = 0; round < 8; ++round)
+    {
+        EpochDomain::instance().collect();
+    }
+}
+
+}  // namespace
+
+// A retired object must survive as long as some thread is pinned in an older epoch.
+TEST(EpochReclamationTest, PinnedReaderDelaysReclamation)
+{
+    freed_count = 0;
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+
+    std::thread reader(
+        [&]
+        {
+            EpochDomain::Guard guard;
+            pinned = true;
+            while (!release)
+            {
+                std::this_thread::yield();
+            }
+        });
+    while (!pinned)
+    {
+        std::this_thread::yield();
+    }
+
+    EpochDomain::instance().retire<Tracked, &destroy_tracked>(new Tracked{42});
+    drive_epochs();
+    EXPECT_EQ(freed_count.load(), 0);  // Reader may still hold a pointer
+
+    release = true;
+    reader.join();
+    drive_epochs();
+    EXPECT_EQ(freed_count.load(), 1);
+}
+
+// Guards nest; only the outermost one unpins.
+TEST(EpochReclamationTest, NestedGuardsKeepThreadPinned)
+{
+    freed_count = 0;
+    {
+        EpochDomain::Guard outer;
+        {
+            EpochDomain::Guard inner;
+        }
+        EpochDomain::instance().retire<Tracked, &destroy_tracked>(new Tracked{7});
+        drive_epochs();
+        EXPECT_EQ(freed_count.load(), 0);  // Still pinned by the outer guard
+    }
+    drive_epochs();
+    EXPECT_EQ(freed_count.load(), 1);
+}
+
+// Objects left in the limbo list of an exited thread are adopted and freed later.
+TEST(EpochReclamationTest, ExitedThreadLimboIsReclaimed)
+{
+    freed_count = 0;
+    std::thread retirer(
+        [] { EpochDomain::instance().retire<Tracked, &destroy_tracked>(new Tracked{1}); });
+    retirer.join();
+
+    drive_epochs();
+    EXPECT_EQ(freed_count.load(), 1);
+}
+
+// Wait-free readers race with writers that unlink and retire nodes; run under ASan/TSan
+// this catches use-after-free in the lazy list.
+TEST(EpochReclamationTest, LazySetReadersDuringRemovals)
+{
+    DataStructure::Set::SortedLinkedList_Lazy<int> set;
+    const int range = 512;
+    std::atomic<bool> stop{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r)
+    {
+        readers.emplace_back(
+            [&]
+            {
+                while (!stop)
+                {
+                    for (int v = 0; v < range; ++v)
+                    {
+                        set.contains(v);
+                    }
+                }
+            });
+    }
+
+    std::thread writer(
+        [&]
+        {
+            for (int round = 0; round < 50; ++round)
+            {
+                for (int v = 0; v < range; ++v)
+                {
+                    set.add(v);
+                }
+                for (int v = 0; v < range; ++v)
+                {
+                    set.remove(v);
+                }
+            }
+        });
+
+    writer.join();
+    stop = true;
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+    EXPECT_EQ(set.size(), 0u);
+    ASSERT_TRUE(set.check_invariants());
+}
@@ -0,0 +1,127 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+#include <random>  // For std::mt19937
+#include <vector>
+
+#include "geo_coordinates.h"
+
+namespace
+{
+
+// Coordinates in degrees, converted the way RoadNetwork prepares them
+struct Coordinates
+{
+    std::vector<double> lat_rad, lon_rad, cos_lat;
+
+    void add(double lat_deg, double lon_deg)
+    {
+        lat_rad.push_back(lat_deg * std::numbers::pi / 180.0);
+        lon_rad.push_back(lon_deg * std::numbers::pi / 180.0);
+        cos_lat.push_back(std::cos(lat_rad.back()));
+    }
+
+    GeoCoordinates view(GeoBound bound) const { return {bound, lat_rad, lon_rad, cos_lat}; }
+};
+
+// Textbook haversine on degrees (the formula the heuristics used before)
+double reference_haversine_km(double lat1, double lon1, double lat2, double lon2)
+{
+    const double to_rad = std::numbers::pi / 180.0;
+    const double dlat = (lat2 - lat1) * to_rad, dlon = (lon2 - lon1) * to_rad;
+    const double a = std::pow(std::sin(dlat / 2.0), 2)
+                     + std::cos(lat1 * to_rad) * std::cos(lat2 * to_rad) * std::pow(std::sin(dlon / 2.0), 2);
+    return 2.0 * std::asin(std::sqrt(a)) * 6371.0;
+}
+
+// Random points everywhere on the globe, plus a dense city-sized cluster
+Coordinates random_points(size_t count, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> lat(-90.0, 90.0), lon(-180.0, 180.0);
+    std::uniform_real_distribution<double> jitter(-0.1, 0.1);
+    Coordinates points;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i % 2 == 0)
+            points.add(lat(gen), lon(gen));
+        else
+            points.add(51.5 + jitter(gen), -0.1 + jitter(gen));
+    }
+    return points;
+}
+
+}  // namespace
+
+// The precomputed-radian haversine agrees with the degree formula.
+TEST(GeoCoordinatesTest, HaversineMatchesReference)
+{
+    Coordinates points = random_points(64, 1);
+    const GeoCoordinates geo = points.view(GeoBound::Haversine);
+    for (NodeIndex a = 0; a < 64; ++a)
+    {
+        for (NodeIndex b = 0; b < 64; ++b)
+        {
+            const double expected = reference_haversine_km(
+                points.lat_rad[a] * 180.0 / std::numbers::pi, points.lon_rad[a] * 180.0 / std::numbers::pi,
+                points.lat_rad[b] * 180.0 / std::numbers::pi, points.lon_rad[b] * 180.0 / std::numbers::pi);
+            EXPECT_NEAR(geo.distance_km(a, b), expected, 1e-9 * (1.0 + expected));
+        }
+    }
+}
+
+// The equirectangular bound never exceeds the great-circle distance (admissibility),
+// including pole-crossing and antimeridian pairs, and is tight at city scale.
+TEST(GeoCoordinatesTest, EquirectangularIsLowerBound)
+{
+    Coordinates points = random_points(200, 2);
+    points.add(60.0, 0.0);     // Same latitude, half the globe apart: geodesic over the pole
+    points.add(60.0, 180.0);
+    points.add(0.0, 179.95);   // Across the antimeridian
+    points.add(0.0, -179.95);
+    const GeoCoordinates haversine = points.view(GeoBound::Haversine);
+    const GeoCoordinates equirectangular = points.view(GeoBound::Equirectangular);
+
+    const NodeIndex n = static_cast<NodeIndex>(points.lat_rad.size());
+    for (NodeIndex a = 0; a < n; ++a)
+    {
+        for (NodeIndex b = 0; b < n; ++b)
+        {
+            const double exact = haversine.distance_km(a, b);
+            const double bound = equirectangular.distance_km(a, b);
+            EXPECT_LE(bound, exact * (1.0 + 1e-12) + 1e-12) << "pair " << a << ", " << b;
+            if (a % 2 == 1 && b % 2 == 1 && a < 200 && b < 200)
+            {
+                EXPECT_GE(bound, exact * (1.0 - 1e-5));  // Both in the city cluster
+            }
+        }
+    }
+    const double across = haversine.distance_km(n - 2, n - 1);  // ~11 km, not ~40000 km
+    EXPECT_NEAR(equirectangular.distance_km(n - 2, n - 1), across, 1e-5 * across);
+}
+
+// The batch kernel (vectorized when compiled for AVX2/AVX-512/NEON) fills exactly the
+// scalar values, for every block length so each tail size is covered.
+TEST(GeoCoordinatesTest, BatchMatchesScalar)
+{
+    Coordinates points = random_points(64, 3);
+    for (GeoBound bound : {GeoBound::Haversine, GeoBound::Equirectangular})
+    {
+        const GeoCoordinates geo = points.view(bound);
+        std::vector<NodeIndex> nodes;
+        for (NodeIndex i = 0; i < 37; ++i)
+            nodes.push_back((i * 17) % 64);
+
+        for (size_t count = 0; count <= nodes.size(); ++count)
+        {
+            std::vector<double> out(count + 1, -1.0);
+            geo.distances_km(nodes.data(), count, 5, out.data());
+            for (size_t i = 0; i < count; ++i)
+            {
+                const double expected = geo.distance_km(nodes[i], 5);
+                EXPECT_NEAR(out[i], expected, 1e-12 * (1.0 + expected));
+            }
+            EXPECT_EQ(out[count], -1.0);  // Nothing written past the block
+        }
+    }
+}
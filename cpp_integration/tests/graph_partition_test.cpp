@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>  // For std::mt19937
+#include <vector>
+
+#include "graph_partition.h"
+#include "numa.h"
+
+namespace
+{
+
+// W x H grid of nodes with slightly jittered coordinates and 4-neighbour edges in both
+// directions, as a forward CSR
+struct Grid
+{
+    std::vector<double> lats, lons;
+    std::vector<long long> ids;
+    std::vector<EdgeIndex> offsets;
+    std::vector<NodeIndex> targets;
+};
+
+Grid make_grid(int width, int height, unsigned seed)
+{
+    Grid grid;
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> jitter(-0.0002, 0.0002);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+        {
+            grid.lats.push_back(48.0 + y * 0.001 + jitter(gen));
+            grid.lons.push_back(11.0 + x * 0.0015 + jitter(gen));
+            grid.ids.push_back(1000 + y * width + x);
+        }
+    grid.offsets.push_back(0);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+        {
+            const int dx[] = {1, -1, 0, 0}, dy[] = {0, 0, 1, -1};
+            for (int k = 0; k < 4; ++k)
+                if (x + dx[k] >= 0 && x + dx[k] < width && y + dy[k] >= 0 && y + dy[k] < height)
+                    grid.targets.push_back(static_cast<NodeIndex>((y + dy[k]) * width + x + dx[k]));
+            grid.offsets.push_back(static_cast<EdgeIndex>(grid.targets.size()));
+        }
+    return grid;
+}
+
+// CSR of the grid renumbered so that order[new] = old
+void renumber(Grid &grid, const std::vector<NodeIndex> &order)
+{
+    std::vector<NodeIndex> rank(order.size());
+    for (NodeIndex i = 0; i < order.size(); ++i)
+        rank[order[i]] = i;
+    std::vector<EdgeIndex> offsets = {0};
+    std::vector<NodeIndex> targets;
+    for (NodeIndex old : order)
+    {
+        for (EdgeIndex e = grid.offsets[old]; e < grid.offsets[old + 1]; ++e)
+            targets.push_back(rank[grid.targets[e]]);
+        offsets.push_back(static_cast<EdgeIndex>(targets.size()));
+    }
+    grid.offsets = std::move(offsets);
+    grid.targets = std::move(targets);
+}
+
+}  // namespace
+
+// The parts are a permutation cut into contiguous, equal ranges of geometrically close nodes.
+TEST(GraphPartitionTest, BisectionIsBalancedWithSmallCut)
+{
+    for (size_t parts : {1u, 2u, 3u, 5u, 8u})
+    {
+        Grid grid = make_grid(60, 40, 7);
+        const size_t n = grid.lats.size();
+        const auto result = GraphPartitioning::bisection_order(grid.lats, grid.lons, grid.ids, parts);
+
+        std::vector<NodeIndex> sorted = result.order;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<NodeIndex> identity(n);
+        std::iota(identity.begin(), identity.end(), NodeIndex(0));
+        ASSERT_EQ(sorted, identity);
+
+        ASSERT_EQ(result.part_begin.size(), parts + 1);
+        EXPECT_EQ(result.part_begin.front(), 0u);
+        EXPECT_EQ(result.part_begin.back(), n);
+        for (size_t p = 0; p < parts; ++p)
+        {
+            const size_t size = result.part_begin[p + 1] - result.part_begin[p];
+            EXPECT_LE(size, n / parts + 1);
+            EXPECT_GE(size, n / parts - 1);
+        }
+
+        renumber(grid, result.order);
+        const GraphPartition partition = GraphPartitioning::assign_domains(result.part_begin, 1);
+        const PartitionQuality quality = GraphPartitioning::evaluate(grid.offsets, grid.targets, partition);
+        EXPECT_EQ(quality.cross_domain_edges, 0u);
+        EXPECT_LE(quality.node_imbalance, 1.01);
+        // Straight cuts through a 60 x 40 grid: a few hundred of the ~9400 edges at most
+        EXPECT_LT(quality.cut_fraction, 0.05 * parts) << parts << " parts";
+        if (parts == 1)
+        {
+            EXPECT_EQ(quality.cut_edges, 0u);
+        }
+    }
+}
+
+// Consecutive parts share a domain and the lookups agree with the boundaries.
+TEST(GraphPartitionTest, DomainsAndLookups)
+{
+    const std::vector<NodeIndex> part_begin = {0, 10, 20, 30, 40, 50};
+    const GraphPartition partition = GraphPartitioning::assign_domains(part_begin, 2);
+    EXPECT_EQ(partition.num_parts(), 5u);
+    ASSERT_EQ(partition.num_domains(), 2u);
+    EXPECT_EQ(partition.domain_begin, (std::vector<NodeIndex>{0, 30, 50}));
+    for (NodeIndex u = 0; u < 50; ++u)
+    {
+        EXPECT_EQ(partition.part_of(u), u / 10);
+        EXPECT_EQ(partition.domain_of(u), u < 30 ? 0u : 1u);
+    }
+
+    // More domains than parts: one part per domain
+    EXPECT_EQ(GraphPartitioning::assign_domains(part_begin, 16).num_domains(), 5u);
+    EXPECT_THROW(GraphPartitioning::bisection_order({}, {}, {}, 0), std::invalid_argument);
+}
+
+// evaluate() counts cut and cross-domain edges of a small hand-made graph.
+TEST(GraphPartitionTest, EvaluateCounts)
+{
+    // 0 <-> 1 | 2 <-> 3 | 4, with 1 -> 2 and 3 -> 4 crossing parts; parts {0,1} {2,3} {4}
+    const std::vector<EdgeIndex> offsets = {0, 1, 3, 4, 6, 6};
+    const std::vector<NodeIndex> targets = {1, 0, 2, 3, 2, 4};
+    const GraphPartition partition = GraphPartitioning::assign_domains({0, 2, 4, 5}, 2);  // {0..3} {4}
+    const PartitionQuality quality = GraphPartitioning::evaluate(offsets, targets, partition);
+    EXPECT_EQ(quality.part_nodes, (std::vector<size_t>{2, 2, 1}));
+    EXPECT_EQ(quality.part_edges, (std::vector<size_t>{3, 3, 0}));
+    EXPECT_EQ(quality.part_cut_edges, (std::vector<size_t>{1, 1, 0}));
+    EXPECT_EQ(quality.cut_edges, 2u);
+    EXPECT_EQ(quality.cross_domain_edges, 1u);
+    EXPECT_DOUBLE_EQ(quality.cut_fraction, 2.0 / 6.0);
+    EXPECT_DOUBLE_EQ(quality.edge_imbalance, 1.5);
+}
+
+// cpulist parsing and reading a (fake) sysfs node directory.
+TEST(NumaTopologyTest, ParsesSysfs)
+{
+    EXPECT_EQ(NumaTopology::parse_cpulist("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(NumaTopology::parse_cpulist(""), std::vector<int>{});
+    EXPECT_EQ(NumaTopology::parse_cpulist("x,4"), std::vector<int>{4});
+
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "graph_partition_test_sysfs";
+    std::filesystem::remove_all(root);
+    for (auto [node, list] : {std::pair{0, "4-7,0-1"}, std::pair{1, "2-3,8"}})
+    {
+        std::filesystem::create_directories(root / ("node" + std::to_string(node)));
+        std::ofstream(root / ("node" + std::to_string(node)) / "cpulist") << list << "\n";
+    }
+    const NumaTopology topology = NumaTopology::from_sysfs(root.string());
+    std::filesystem::remove_all(root);
+    ASSERT_EQ(topology.num_nodes(), 2u);
+    EXPECT_EQ(topology.cpus(0), (std::vector<int>{0, 1, 4, 5, 6, 7}));
+    EXPECT_EQ(topology.cpus(1), (std::vector<int>{2, 3, 8}));
+    EXPECT_EQ(topology.node_of_cpu(8), 1u);
+    EXPECT_EQ(topology.node_of_cpu(5), 0u);
+
+    // No node directories: one node with every CPU
+    const NumaTopology fallback = NumaTopology::from_sysfs(root.string());
+    EXPECT_EQ(fallback.num_nodes(), 1u);
+    EXPECT_FALSE(fallback.cpus(0).empty());
+}
+
+// FirstTouchArray slices filled from per-node tasks, and moves.
+TEST(NumaTopologyTest, FirstTouchArrayFill)
+{
+    FirstTouchArray<std::uint32_t> array(100000);
+    const NumaTopology &topology = NumaTopology::system();
+    const size_t nodes = topology.num_nodes();
+    run_on_each_node(topology,
+                     [&](size_t node)
+                     {
+                         const size_t begin = array.size() * node / nodes, end = array.size() * (node + 1) / nodes;
+                         for (size_t i = begin; i < end; ++i)
+                             array.data()[i] = static_cast<std::uint32_t>(i);
+                     });
+    FirstTouchArray<std::uint32_t> moved = std::move(array);
+    EXPECT_EQ(array.size(), 0u);
+    ASSERT_EQ(moved.size(), 100000u);
+    for (size_t i = 0; i < moved.size(); ++i)
+        ASSERT_EQ(moved.view()[i], i);
+    EXPECT_EQ(FirstTouchArray<double>().view().size(), 0u);
+}
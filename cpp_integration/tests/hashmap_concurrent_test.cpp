@@ -0,0 +1,150 @@
+#include <algorithm>  // For std::min
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>  // For std::mt19937
+#include <thread>  // For std::thread
+#include <vector>
+
+#include "data_structure/hashmap_concurrent.h"
+
+using DataStructure::HashMap::ConcurrentHashMap;
+using DataStructure::HashMap::pack_score;
+using DataStructure::HashMap::score_cost;
+using DataStructure::HashMap::score_cost_less;
+using DataStructure::HashMap::score_index;
+
+using ScoreMap = ConcurrentHashMap<std::uint32_t, std::uint64_t>;
+
+// Absent keys read as EMPTY_VALUE; capacity keeps the load factor at or below 50%.
+TEST(ConcurrentHashMapTest, AbsentKeysAndCapacity)
+{
+    ScoreMap map(100);
+    EXPECT_GE(map.capacity(), 200u);
+    EXPECT_EQ(map.size(), 0u);
+    EXPECT_EQ(map.load(7), ScoreMap::EMPTY_VALUE);
+    EXPECT_EQ(map.size(), 0u);  // load() never inserts
+}
+
+// update_min only ever lowers the stored value and reports whether it did.
+TEST(ConcurrentHashMapTest, UpdateMinKeepsMinimum)
+{
+    ScoreMap map(16);
+    EXPECT_TRUE(map.update_min(3, 50));
+    EXPECT_FALSE(map.update_min(3, 60));
+    EXPECT_FALSE(map.update_min(3, 50));
+    EXPECT_TRUE(map.update_min(3, 10));
+    EXPECT_EQ(map.load(3), 10u);
+    EXPECT_EQ(map.size(), 1u);
+
+    map.store(3, 99);  // Unconditional
+    EXPECT_EQ(map.load(3), 99u);
+}
+
+// Colliding keys probe linearly; every key of a full-load table stays retrievable.
+TEST(ConcurrentHashMapTest, ManyKeysAndClear)
+{
+    const std::uint32_t count = 1000;
+    ScoreMap map(count);
+    for (std::uint32_t key = 0; key < count; ++key)
+        map.store(key, key * 2);
+    EXPECT_EQ(map.size(), count);
+    for (std::uint32_t key = 0; key < count; ++key)
+        EXPECT_EQ(map.load(key), key * 2);
+
+    map.clear();
+    EXPECT_EQ(map.size(), 0u);
+    for (std::uint32_t key = 0; key < count; ++key)
+        EXPECT_EQ(map.load(key), ScoreMap::EMPTY_VALUE);
+
+    // Reusable after clear()
+    EXPECT_TRUE(map.update_min(5, 1));
+    EXPECT_EQ(map.load(5), 1u);
+}
+
+// A table without an empty slot reports it instead of probing forever.
+TEST(ConcurrentHashMapTest, FullTableThrows)
+{
+    ScoreMap map(1);  // Minimum capacity
+    for (std::uint32_t key = 0; key < map.capacity(); ++key)
+        map.store(key, key);
+    EXPECT_THROW(map.store(static_cast<std::uint32_t>(map.capacity()), 0), std::length_error);
+}
+
+// Packed scores order by cost first, then index, and round-trip both fields.
+TEST(ConcurrentHashMapTest, PackedScoresOrderByCost)
+{
+    EXPECT_LT(pack_score(1.5f, 900), pack_score(2.0f, 1));
+    EXPECT_LT(pack_score(0.0f, 900), pack_score(1.0e-30f, 0));
+    EXPECT_LT(pack_score(3.0f, 1), pack_score(3.0f, 2));
+    EXPECT_LT(pack_score(1.0e30f, 0xFFFFFFFE), ScoreMap::EMPTY_VALUE);
+
+    const std::uint64_t packed = pack_score(1234.5f, 42);
+    EXPECT_EQ(score_cost(packed), 1234.5f);
+    EXPECT_EQ(score_index(packed), 42u);
+}
+
+// Ordered by cost alone, an equal cost with a smaller index is no improvement: the parent
+// (and the start's missing parent) survives zero-length edges.
+TEST(ConcurrentHashMapTest, UpdateMinByCostKeepsTies)
+{
+    ScoreMap map(16);
+    EXPECT_TRUE(map.update_min(1, pack_score(0.0f, 0xFFFFFFFF), score_cost_less));  // No value yet
+    EXPECT_FALSE(map.update_min(1, pack_score(0.0f, 2), score_cost_less));
+    EXPECT_EQ(score_index(map.load(1)), 0xFFFFFFFFu);
+
+    EXPECT_TRUE(map.update_min(2, pack_score(5.0f, 9), score_cost_less));
+    EXPECT_FALSE(map.update_min(2, pack_score(5.0f, 1), score_cost_less));
+    EXPECT_FALSE(map.update_min(2, pack_score(6.0f, 1), score_cost_less));
+    EXPECT_TRUE(map.update_min(2, pack_score(4.5f, 3), score_cost_less));
+    EXPECT_EQ(map.load(2), pack_score(4.5f, 3));
+}
+
+// Threads race update_min on shared keys; each key ends at the minimum of all updates
+// and the (cost, index) pair is never torn.
+TEST(ConcurrentHashMapTest, ConcurrentUpdateMinReachesMinimum)
+{
+    const int num_threads = 4;
+    const std::uint32_t key_range = 512;
+    const int updates_per_thread = 20000;
+    ScoreMap map(key_range);
+
+    // Each thread's updates are derived from its seed so the expected minimum is known
+    std::vector<std::vector<std::uint64_t>> expected(
+        num_threads, std::vector<std::uint64_t>(key_range, ScoreMap::EMPTY_VALUE));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                std::mt19937 gen(1000 + t);
+                std::uniform_int_distribution<std::uint32_t> key_dist(0, key_range - 1);
+                std::uniform_real_distribution<float> cost_dist(0.0f, 1000.0f);
+                for (int i = 0; i < updates_per_thread; ++i)
+                {
+                    const std::uint32_t key = key_dist(gen);
+                    const float cost = cost_dist(gen);
+                    // The index encodes the cost, so a torn pair would not match
+                    const std::uint64_t value = pack_score(cost, static_cast<std::uint32_t>(cost * 1000));
+                    map.update_min(key, value);
+                    expected[t][key] = std::min(expected[t][key], value);
+                }
+            });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    EXPECT_LE(map.size(), key_range);
+    for (std::uint32_t key = 0; key < key_range; ++key)
+    {
+        std::uint64_t minimum = ScoreMap::EMPTY_VALUE;
+        for (int t = 0; t < num_threads; ++t)
+            minimum = std::min(minimum, expected[t][key]);
+        const std::uint64_t stored = map.load(key);
+        EXPECT_EQ(stored, minimum) << "key " << key;
+        if (stored != ScoreMap::EMPTY_VALUE)
+        {
+            EXPECT_EQ(score_index(stored), static_cast<std::uint32_t>(score_cost(stored) * 1000));
+        }
+    }
+}
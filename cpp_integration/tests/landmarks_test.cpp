@@ -0,0 +1,188 @@
+#include <algorithm>  // For std::equal
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>  // For getpid
+#include <utility>
+#include <vector>
+
+#include "demo/astar.h"
+#include "demo/landmarks.h"
+#include "road_network.h"
+#include "test_networks.h"
+#include "thread_pool.h"
+
+namespace
+{
+
+// Every ordered pair (sampled sources x all targets) satisfies lower_bound <= distance
+void expect_admissible(const RoadNetwork &network, const Graph &graph, const std::vector<long long> &ids)
+{
+    const LandmarkTable &table = network.landmarks();
+    size_t informative = 0;
+    for (size_t s = 0; s < ids.size(); s += 7)
+    {
+        const auto dist = TestNetworks::dijkstra(graph, ids[s]);
+        const NodeIndex u = network.index_of(ids[s]);
+        EXPECT_EQ(table.lower_bound(u, u), 0.0);
+        for (long long target : ids)
+        {
+            auto it = dist.find(target);
+            const double d = it == dist.end() ? TestNetworks::INF : it->second;
+            const double bound = table.lower_bound(u, network.index_of(target));
+            EXPECT_LE(bound, d) << ids[s] << " -> " << target;
+            if (bound > 0.0)
+                ++informative;
+        }
+    }
+    EXPECT_GT(informative, 0u);  // The tables are not trivially 0
+}
+
+using Search = std::vector<long long> (*)(const RoadNetwork &, long long, long long);
+
+// A parallel search on three threads, as a Search
+template <std::vector<long long> (*PARALLEL)(const RoadNetwork &, long long, long long, int)>
+std::vector<long long> on_three_threads(const RoadNetwork &network, long long start, long long goal)
+{
+    return PARALLEL(network, start, goal, 3);
+}
+
+std::vector<long long> bounded_optimal(const RoadNetwork &network, long long start, long long goal)
+{
+    return AStar::search_bounded(network, start, goal, AStarEngine::SearchOptions()).path;
+}
+
+}  // namespace
+
+// The ALT bound never exceeds the true distance, on grids with zero-weight edges and
+// after traffic updates (which only raise weights above the base the tables are for).
+TEST(LandmarksTest, LowerBoundIsAdmissible)
+{
+    ThreadPool::configure(4, false);
+    for (double zero_fraction : {0.0, 0.2})
+    {
+        TestNetworks::TestGraph test = TestNetworks::grid(18, 13, 23, zero_fraction);
+        RoadNetwork network(test.graph, test.nodes);
+        Landmarks::preprocess(network, 6, 0);
+        ASSERT_EQ(network.landmarks().count, 6u);
+        expect_admissible(network, test.graph, test.ids);
+
+        // The stored distances are the Dijkstra distances, rounded to float
+        const LandmarkTable &table = network.landmarks();
+        for (size_t i = 0; i < table.count; ++i)
+        {
+            const auto dist = TestNetworks::dijkstra(test.graph, network.id_of(table.landmarks[i]));
+            for (long long id : test.ids)
+            {
+                auto it = dist.find(id);
+                const double d = it == dist.end() ? TestNetworks::INF : it->second;
+                const float stored = table.from[network.index_of(id) * table.count + i];
+                EXPECT_EQ(stored, static_cast<float>(d));
+            }
+        }
+
+        // Slower traffic on some edges
+        std::vector<long long> from, to;
+        std::vector<double> weights;
+        for (size_t k = 0; k < test.ids.size(); k += 3)
+            for (Edge &edge : test.graph[test.ids[k]])
+            {
+                edge.weight *= 2.5;
+                from.push_back(test.ids[k]);
+                to.push_back(edge.target_node_id);
+                weights.push_back(edge.weight);
+            }
+        network.update_traffic(from, to, weights);
+        expect_admissible(network, test.graph, test.ids);
+    }
+}
+
+// With tables attached every engine built on the A* heuristic still returns a shortest path.
+TEST(LandmarksTest, EnginesStayOptimal)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::grid(20, 15, 29, 0.1);
+    RoadNetwork network(test.graph, test.nodes);
+    Landmarks::preprocess(network, 8, 2);
+    const std::vector<std::pair<const char *, Search>> searches = {
+        {"sequential", &AStar::search},
+        {"bidirectional", &AStar::search_bidirectional},
+        {"TPool_CppLib", &on_three_threads<&AStarParallel::search_TPool_CppLib>},
+        {"TVector_PqFine", &on_three_threads<&AStarParallel::search_TVector_PqFine>},
+        {"TPool_MultiQueue", &on_three_threads<&AStarParallel::search_TPool_MultiQueue>},
+        {"HDA", &on_three_threads<&AStarParallel::search_HDA>},
+        {"bounded", &bounded_optimal},
+    };
+    for (size_t q = 0; q < 25; ++q)
+    {
+        const long long start = test.ids[(q * 71 + 3) % test.ids.size()];
+        const long long goal = test.ids[(q * 113 + 150) % test.ids.size()];
+        const double expected = TestNetworks::distance(test.graph, start, goal);
+        for (const auto &[name, search] : searches)
+        {
+            const std::vector<long long> path = search(network, start, goal);
+            if (expected == TestNetworks::INF)
+            {
+                EXPECT_TRUE(path.empty()) << name;
+                continue;
+            }
+            ASSERT_FALSE(path.empty()) << name;
+            EXPECT_EQ(path.front(), start);
+            EXPECT_EQ(path.back(), goal);
+            // Up to the float rounding of g in the shared-table variants
+            EXPECT_NEAR(TestNetworks::path_cost(test.graph, path), expected, 1e-5 * (1.0 + expected)) << name;
+        }
+    }
+}
+
+// preprocess() accepts 1 to MAX_LANDMARKS landmarks; set_landmarks() checks table sizes
+// and indices.
+TEST(LandmarksTest, CountValidation)
+{
+    const TestNetworks::TestGraph test = TestNetworks::grid(6, 5, 31);
+    RoadNetwork network(test.graph, test.nodes);
+    EXPECT_THROW(Landmarks::preprocess(network, 0, 1), std::invalid_argument);
+    EXPECT_THROW(Landmarks::preprocess(network, Landmarks::MAX_LANDMARKS + 1, 1), std::invalid_argument);
+    EXPECT_TRUE(network.landmarks().empty());
+    Landmarks::preprocess(network, 1, 1);
+    EXPECT_EQ(network.landmarks().count, 1u);
+
+    const size_t n = network.num_nodes();
+    EXPECT_THROW(network.set_landmarks({0}, std::vector<float>(n - 1), std::vector<float>(n)), std::invalid_argument);
+    EXPECT_THROW(network.set_landmarks({0}, std::vector<float>(n), std::vector<float>(2 * n)), std::invalid_argument);
+    EXPECT_THROW(network.set_landmarks({static_cast<NodeIndex>(n)}, std::vector<float>(n), std::vector<float>(n)),
+                 std::invalid_argument);
+    EXPECT_EQ(network.landmarks().count, 1u);  // A rejected table leaves the old one
+}
+
+// save_binary() stores the tables and open_mmap() views them unchanged.
+TEST(LandmarksTest, BinaryRoundTrip)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::grid(12, 9, 37);
+    RoadNetwork network(test.graph, test.nodes);
+    Landmarks::preprocess(network, 4, 2);
+    const std::string path =
+        (std::filesystem::temp_directory_path() / ("landmarks_test_" + std::to_string(::getpid()) + ".rnet")).string();
+    network.save_binary(path);
+    {
+        const RoadNetwork mapped = RoadNetwork::open_mmap(path);
+        const LandmarkTable &original = network.landmarks(), &loaded = mapped.landmarks();
+        ASSERT_EQ(loaded.count, original.count);
+        EXPECT_TRUE(std::equal(loaded.landmarks.begin(), loaded.landmarks.end(), original.landmarks.begin()));
+        ASSERT_EQ(loaded.from.size(), original.from.size());
+        ASSERT_EQ(loaded.to.size(), original.to.size());
+        EXPECT_TRUE(std::equal(loaded.from.begin(), loaded.from.end(), original.from.begin()));
+        EXPECT_TRUE(std::equal(loaded.to.begin(), loaded.to.end(), original.to.begin()));
+        for (size_t q = 0; q < 15; ++q)
+        {
+            const long long start = test.ids[(q * 17) % test.ids.size()];
+            const long long goal = test.ids[(q * 43 + 60) % test.ids.size()];
+            EXPECT_EQ(loaded.lower_bound(mapped.index_of(start), mapped.index_of(goal)),
+                      original.lower_bound(network.index_of(start), network.index_of(goal)));
+            EXPECT_EQ(AStar::search(mapped, start, goal), AStar::search(network, start, goal));
+        }
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,166 @@
+#include <atomic>  // For std::atomic
+#include <gtest/gtest.h>
+#include <thread>  // For std::thread
+#include <vector>
+
+#include "live_weights.h"
+
+namespace
+{
+
+// Directed triangle 0 -> 1 -> 2 -> 0 plus 0 -> 2, in CSR form with its reverse CSR
+struct TinyGraph
+{
+    std::vector<EdgeIndex> offsets{0, 2, 3, 4};
+    std::vector<NodeIndex> targets{1, 2, 2, 0};
+    std::vector<double> weights{1.0, 5.0, 2.0, 3.0};
+    // Incoming: 0 <- 2 (edge 3); 1 <- 0 (edge 0); 2 <- 0 (edge 1), 2 <- 1 (edge 2)
+    std::vector<EdgeIndex> rev_offsets{0, 1, 2, 4};
+    std::vector<double> rev_weights{3.0, 1.0, 5.0, 2.0};
+
+    LiveWeights make_live() const { return {weights, rev_weights, offsets, targets, rev_offsets}; }
+};
+
+// Reverse slot of each forward edge in TinyGraph
+constexpr EdgeIndex REVERSE_SLOT[] = {1, 2, 3, 0};
+
+}  // namespace
+
+// Factors are interpolated between breakpoints and wrap around midnight.
+TEST(LiveWeightsTest, ProfileInterpolatesAndWraps)
+{
+    TrafficProfiles profiles;
+    const std::vector<TrafficProfiles::Breakpoint> rush{{6 * 3600.0f, 1.0f}, {8 * 3600.0f, 2.0f}, {20 * 3600.0f, 1.0f}};
+    const ProfileId id = profiles.add(rush);
+    const std::vector<TrafficProfiles::Breakpoint> constant{{0.0f, 1.5f}};
+    const ProfileId flat_id = profiles.add(constant);
+
+    EXPECT_EQ(profiles.size(), 3u);
+    EXPECT_DOUBLE_EQ(profiles.factor(TrafficProfiles::FLAT, 12345.0), 1.0);
+    EXPECT_DOUBLE_EQ(profiles.factor(flat_id, 999.0), 1.5);
+    EXPECT_DOUBLE_EQ(profiles.factor(id, 7 * 3600.0), 1.5);
+    EXPECT_DOUBLE_EQ(profiles.factor(id, 8 * 3600.0), 2.0);
+    EXPECT_DOUBLE_EQ(profiles.factor(id, 1 * 3600.0), 1.0);                 // Flat 20:00 -> 06:00 overnight
+    EXPECT_DOUBLE_EQ(profiles.factor(id, 7 * 3600.0 + 86400.0), 1.5);       // Next day
+    EXPECT_DOUBLE_EQ(profiles.factor(id, 7 * 3600.0 - 86400.0), 1.5);       // Previous day
+
+    const std::vector<TrafficProfiles::Breakpoint> unsorted{{10.0f, 1.0f}, {5.0f, 1.0f}};
+    EXPECT_THROW(profiles.add(unsorted), std::invalid_argument);
+    EXPECT_THROW(profiles.add({}), std::invalid_argument);
+}
+
+// A published update is visible to new snapshots in both CSR directions, while a snapshot
+// pinned earlier keeps reading the old version.
+TEST(LiveWeightsTest, UpdatesPublishNewVersions)
+{
+    const TinyGraph graph;
+    LiveWeights live = graph.make_live();
+    EXPECT_EQ(live.version(), 0u);
+
+    const WeightSnapshot before = live.pin();
+    const std::vector<EdgeIndex> edges{1, 3};
+    const std::vector<double> weights{7.5, 4.0};
+    live.update(edges, weights);
+    EXPECT_EQ(live.version(), 1u);
+
+    EXPECT_EQ(before.version(), 0u);
+    for (EdgeIndex e = 0; e < 4; ++e)
+    {
+        EXPECT_DOUBLE_EQ(before.forward(e), graph.weights[e]);
+    }
+
+    const WeightSnapshot after = live.pin();
+    EXPECT_EQ(after.version(), 1u);
+    const double expected[] = {1.0, 7.5, 2.0, 4.0};
+    for (EdgeIndex e = 0; e < 4; ++e)
+    {
+        EXPECT_DOUBLE_EQ(after.forward(e), expected[e]);
+        EXPECT_DOUBLE_EQ(after.reverse(REVERSE_SLOT[e]), expected[e]);
+    }
+
+    EXPECT_THROW(live.update(std::vector<EdgeIndex>{4}, std::vector<double>{1.0}), std::invalid_argument);
+    EXPECT_EQ(live.version(), 1u);
+}
+
+// Profiles scale the base weights at the traffic time, overrides win over profiles, and
+// nothing drops below the free-flow base weight.
+TEST(LiveWeightsTest, ProfilesOverridesAndClamping)
+{
+    const TinyGraph graph;
+    LiveWeights live = graph.make_live();
+
+    TrafficProfiles profiles;
+    const std::vector<TrafficProfiles::Breakpoint> rush{{0.0f, 1.0f}, {43200.0f, 3.0f}};
+    const std::vector<TrafficProfiles::Breakpoint> faster{{0.0f, 0.5f}};
+    const ProfileId busy = profiles.add(rush);
+    const ProfileId quick = profiles.add(faster);
+    live.set_profiles(profiles, {busy, quick, TrafficProfiles::FLAT, busy});
+
+    live.set_time(43200.0);
+    {
+        const WeightSnapshot weights = live.pin();
+        EXPECT_DOUBLE_EQ(weights.forward(0), 3.0);
+        EXPECT_DOUBLE_EQ(weights.forward(1), 5.0);  // Factor 0.5 clamped to the base weight
+        EXPECT_DOUBLE_EQ(weights.forward(2), 2.0);
+        EXPECT_DOUBLE_EQ(weights.forward(3), 9.0);
+    }
+
+    live.update(std::vector<EdgeIndex>{0, 2}, std::vector<double>{1.5, 0.1});
+    {
+        const WeightSnapshot weights = live.pin();
+        EXPECT_DOUBLE_EQ(weights.forward(0), 1.5);  // Override replaces the profile
+        EXPECT_DOUBLE_EQ(weights.forward(2), 2.0);  // Clamped to the base weight
+        EXPECT_DOUBLE_EQ(weights.forward(3), 9.0);
+    }
+
+    live.clear_updates();
+    {
+        const WeightSnapshot weights = live.pin();
+        EXPECT_DOUBLE_EQ(weights.forward(0), 3.0);
+        EXPECT_EQ(weights.version(), 4u);
+    }
+}
+
+// Readers pinning snapshots while a writer publishes see every snapshot from exactly one
+// version: all edges carry the value that version wrote, never a mix.
+TEST(LiveWeightsTest, ReadersSeeConsistentVersionsDuringUpdates)
+{
+    const TinyGraph graph;
+    LiveWeights live = graph.make_live();
+    const std::vector<EdgeIndex> all_edges{0, 1, 2, 3};
+
+    std::atomic<bool> stop{false};
+    std::atomic<long> inconsistent{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r)
+    {
+        readers.emplace_back(
+            [&]
+            {
+                while (!stop.load())
+                {
+                    const WeightSnapshot weights = live.pin();
+                    if (weights.version() == 0)
+                        continue;
+                    const double value = 100.0 + static_cast<double>(weights.version());
+                    for (EdgeIndex e = 0; e < 4; ++e)
+                    {
+                        if (weights.forward(e) != value || weights.reverse(e) != value)
+                            inconsistent.fetch_add(1);
+                    }
+                }
+            });
+    }
+
+    for (int version = 1; version <= 300; ++version)
+    {
+        live.update(all_edges, std::vector<double>(4, 100.0 + version));
+    }
+    stop.store(true);
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(live.version(), 300u);
+}
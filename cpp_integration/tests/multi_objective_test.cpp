@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <gtest/gtest.h>
+#include <random>  // For std::mt19937
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "demo/aStarWithVectorFunction.h"
+#include "road_network.h"
+#include "test_networks.h"
+
+namespace
+{
+
+using AStarEnhancementVectorFunction::ParetoPath;
+
+// a <= b in every criterion and a != b
+bool dominates(const CostVector &a, const CostVector &b)
+{
+    bool strictly = false;
+    for (size_t c = 0; c < NUM_CRITERIA; ++c)
+    {
+        if (a[c] > b[c])
+            return false;
+        strictly = strictly || a[c] < b[c];
+    }
+    return strictly;
+}
+
+// Seeded grid whose edges carry small integer (distance, time, toll) costs, so that sums
+// are exact and equal cost vectors (ties) are common
+TestNetworks::TestGraph cost_grid(int width, int height, unsigned seed)
+{
+    TestNetworks::TestGraph test = TestNetworks::grid(width, height, seed);
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> cost(1, 9), toll(0, 3);
+    for (long long u : test.ids)
+        for (Edge &edge : test.graph[u])
+        {
+            edge.costs = {static_cast<double>(cost(gen)), static_cast<double>(cost(gen)),
+                          static_cast<double>(toll(gen))};
+            edge.weight = edge.costs[0];
+        }
+    return test;
+}
+
+// Cost vector of every simple start -> goal path, by depth-first enumeration
+std::vector<CostVector> all_simple_path_costs(const Graph &graph, long long start, long long goal)
+{
+    std::vector<CostVector> costs;
+    std::unordered_set<long long> on_path = {start};
+    std::function<void(long long, CostVector)> visit = [&](long long u, CostVector g)
+    {
+        if (u == goal)
+        {
+            costs.push_back(g);
+            return;
+        }
+        for (const Edge &edge : graph.at(u))
+        {
+            if (!on_path.insert(edge.target_node_id).second)
+                continue;
+            CostVector next = g;
+            for (size_t c = 0; c < NUM_CRITERIA; ++c)
+                next[c] += edge.costs[c];
+            visit(edge.target_node_id, next);
+            on_path.erase(edge.target_node_id);
+        }
+    };
+    visit(start, CostVector{});
+    return costs;
+}
+
+// The distinct non-dominated vectors of costs, in lexicographic order
+std::vector<CostVector> pareto_front(const std::vector<CostVector> &costs)
+{
+    std::vector<CostVector> front;
+    for (const CostVector &cost : costs)
+        if (std::none_of(costs.begin(), costs.end(), [&](const CostVector &other) { return dominates(other, cost); }))
+            front.push_back(cost);
+    std::sort(front.begin(), front.end());
+    front.erase(std::unique(front.begin(), front.end()), front.end());
+    return front;
+}
+
+// Checks that path runs start -> goal over edges and costs exactly result.cost
+void expect_consistent(const Graph &graph, const ParetoPath &result, long long start, long long goal)
+{
+    ASSERT_FALSE(result.path.empty());
+    EXPECT_EQ(result.path.front(), start);
+    EXPECT_EQ(result.path.back(), goal);
+    CostVector sum{};
+    for (size_t i = 1; i < result.path.size(); ++i)
+    {
+        const std::vector<Edge> &edges = graph.at(result.path[i - 1]);
+        auto edge = std::find_if(edges.begin(), edges.end(),
+                                 [&](const Edge &e) { return e.target_node_id == result.path[i]; });
+        ASSERT_NE(edge, edges.end()) << "step " << i << " is not an edge";
+        for (size_t c = 0; c < NUM_CRITERIA; ++c)
+            sum[c] += edge->costs[c];
+    }
+    EXPECT_EQ(sum, result.cost);
+}
+
+}  // namespace
+
+// The returned front is exactly the brute-force Pareto front of the simple paths, in
+// lexicographic order, and every path costs what it claims.
+TEST(MultiObjectiveTest, MatchesBruteForceFront)
+{
+    for (unsigned seed : {1u, 2u, 3u, 4u})
+    {
+        const TestNetworks::TestGraph test = cost_grid(4, 4, seed);
+        const RoadNetwork network(test.graph, test.nodes);
+        ASSERT_TRUE(network.has_edge_costs());
+        for (size_t q = 0; q < 12; ++q)
+        {
+            const long long start = test.ids[(q * 5 + seed) % test.ids.size()];
+            const long long goal = test.ids[(q * 11 + 3) % test.ids.size()];
+            if (start == goal)
+                continue;
+            const std::vector<CostVector> expected =
+                pareto_front(all_simple_path_costs(test.graph, start, goal));
+
+            const std::vector<ParetoPath> results = AStarEnhancementVectorFunction::search(network, start, goal);
+            std::vector<CostVector> front;
+            for (const ParetoPath &result : results)
+            {
+                expect_consistent(test.graph, result, start, goal);
+                front.push_back(result.cost);
+            }
+            EXPECT_TRUE(std::is_sorted(front.begin(), front.end()));
+            EXPECT_EQ(front, expected) << "seed " << seed << ", " << start << " -> " << goal;
+        }
+    }
+}
+
+// With a label cap the search stops early, but whatever it returns is still on the
+// Pareto front; a large enough cap gives the whole front.
+TEST(MultiObjectiveTest, MaxLabelsKeepsParetoOptimality)
+{
+    const TestNetworks::TestGraph test = cost_grid(5, 4, 8);
+    const RoadNetwork network(test.graph, test.nodes);
+    const long long start = test.ids.front(), goal = test.ids.back();
+    const std::vector<CostVector> expected = pareto_front(all_simple_path_costs(test.graph, start, goal));
+    ASSERT_GT(expected.size(), 1u);
+
+    const size_t full = AStarEnhancementVectorFunction::search(network, start, goal).size();
+    EXPECT_EQ(full, expected.size());
+    for (size_t max_labels : {1, 2, 5, 10, 20, 50, 100, 1000, 100000})
+    {
+        const std::vector<ParetoPath> results = AStarEnhancementVectorFunction::search(network, start, goal, max_labels);
+        EXPECT_LE(results.size(), expected.size());
+        for (const ParetoPath &result : results)
+        {
+            expect_consistent(test.graph, result, start, goal);
+            EXPECT_TRUE(std::binary_search(expected.begin(), expected.end(), result.cost))
+                << "dominated path returned with max_labels = " << max_labels;
+        }
+        if (max_labels == 100000)
+        {
+            EXPECT_EQ(results.size(), expected.size());
+        }
+    }
+}
+
+// Unreachable goals give an empty front, unknown ids throw, and a network without cost
+// vectors gives the single shortest path.
+TEST(MultiObjectiveTest, EdgeCases)
+{
+    const TestNetworks::TestGraph test = TestNetworks::from_edges(
+        {{51.5, -0.1}, {51.5, -0.099}, {51.5, -0.098}, {51.5, -0.097}},
+        {{0, 1, 100.0}, {1, 2, 100.0}, {0, 2, 250.0}});
+    const RoadNetwork network(test.graph, test.nodes);
+    EXPECT_FALSE(network.has_edge_costs());
+
+    const std::vector<ParetoPath> results = AStarEnhancementVectorFunction::search(network, 0, 2);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].path, (std::vector<long long>{0, 1, 2}));
+    EXPECT_EQ(results[0].cost, (CostVector{200.0, 0.0, 0.0}));
+
+    EXPECT_TRUE(AStarEnhancementVectorFunction::search(network, 0, 3).empty());
+    EXPECT_THROW(AStarEnhancementVectorFunction::search(network, 0, 42), std::runtime_error);
+    EXPECT_THROW(AStarEnhancementVectorFunction::search(network, 42, 0), std::runtime_error);
+}
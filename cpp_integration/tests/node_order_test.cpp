@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>  // For std::abs
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>  // For std::mt19937
+#include <vector>
+
+#include "node_order.h"
+
+namespace
+{
+
+// Forward and reverse CSR of an undirected W x H grid (both directions of every street),
+// with nodes numbered in a random order so that no locality comes for free
+struct Grid
+{
+    size_t width, height;
+    std::vector<NodeIndex> label;  // Dense index of cell (x, y) at y * width + x
+    std::vector<EdgeIndex> offsets, rev_offsets;
+    std::vector<NodeIndex> targets, rev_sources;
+    std::vector<double> lats, lons;
+    std::vector<long long> node_ids;
+
+    Grid(size_t w, size_t h, unsigned seed) : width(w), height(h), label(w * h)
+    {
+        const size_t n = w * h;
+        std::iota(label.begin(), label.end(), NodeIndex(0));
+        std::mt19937 gen(seed);
+        std::shuffle(label.begin(), label.end(), gen);
+
+        std::vector<std::vector<NodeIndex>> adjacency(n);
+        lats.resize(n);
+        lons.resize(n);
+        node_ids.resize(n);
+        for (size_t y = 0; y < h; ++y)
+        {
+            for (size_t x = 0; x < w; ++x)
+            {
+                const NodeIndex u = label[y * w + x];
+                lats[u] = 35.0 + 0.001 * y;
+                lons[u] = 139.0 + 0.001 * x;
+                node_ids[u] = 1000 + u;
+                if (x + 1 < w)
+                {
+                    adjacency[u].push_back(label[y * w + x + 1]);
+                    adjacency[label[y * w + x + 1]].push_back(u);
+                }
+                if (y + 1 < h)
+                {
+                    adjacency[u].push_back(label[(y + 1) * w + x]);
+                    adjacency[label[(y + 1) * w + x]].push_back(u);
+                }
+            }
+        }
+        // Symmetric graph: the reverse CSR equals the forward one
+        offsets.push_back(0);
+        for (const auto &neighbors : adjacency)
+        {
+            targets.insert(targets.end(), neighbors.begin(), neighbors.end());
+            offsets.push_back(static_cast<EdgeIndex>(targets.size()));
+        }
+        rev_offsets = offsets;
+        rev_sources = targets;
+    }
+
+    // Largest |new(u) - new(v)| over the edges under order (new index -> current index)
+    size_t bandwidth(const std::vector<NodeIndex> &order) const
+    {
+        const std::vector<NodeIndex> index = NodeOrdering::inverse(order);
+        size_t band = 0;
+        for (NodeIndex u = 0; u + 1 < offsets.size(); ++u)
+            for (EdgeIndex e = offsets[u]; e < offsets[u + 1]; ++e)
+                band = std::max<size_t>(band, std::abs(static_cast<long long>(index[u]) - index[targets[e]]));
+        return band;
+    }
+};
+
+bool is_permutation_of_nodes(const std::vector<NodeIndex> &order, size_t n)
+{
+    std::vector<NodeIndex> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<NodeIndex> expected(n);
+    std::iota(expected.begin(), expected.end(), NodeIndex(0));
+    return sorted == expected;
+}
+
+}  // namespace
+
+// Consecutive cells along the curve are grid neighbours, and the curve covers the grid.
+TEST(NodeOrderTest, HilbertKeyIsContinuousCurve)
+{
+    constexpr std::uint32_t side = 1u << NodeOrdering::HILBERT_BITS;
+    constexpr std::uint32_t cells = 64;
+    // The curve starts at (0, 0) and fills each aligned block before leaving it, so the
+    // 64 x 64 corner block holds its first 64 * 64 keys
+    std::vector<std::pair<std::uint64_t, std::pair<std::uint32_t, std::uint32_t>>> curve;
+    for (std::uint32_t x = 0; x < cells; ++x)
+        for (std::uint32_t y = 0; y < cells; ++y)
+            curve.push_back({NodeOrdering::hilbert_key(x, y), {x, y}});
+    std::sort(curve.begin(), curve.end());
+    for (size_t i = 0; i < curve.size(); ++i)
+        EXPECT_EQ(curve[i].first, i);
+    for (size_t i = 1; i < curve.size(); ++i)
+    {
+        const auto [x0, y0] = curve[i - 1].second;
+        const auto [x1, y1] = curve[i].second;
+        EXPECT_EQ(std::abs(int(x1) - int(x0)) + std::abs(int(y1) - int(y0)), 1);
+    }
+    EXPECT_EQ(NodeOrdering::hilbert_key(side - 1, 0), std::uint64_t(side) * side - 1);
+}
+
+// Every ordering is a permutation of the nodes.
+TEST(NodeOrderTest, OrdersArePermutations)
+{
+    Grid grid(23, 17, 1);
+    const size_t n = grid.width * grid.height;
+    EXPECT_TRUE(is_permutation_of_nodes(NodeOrdering::id_order(grid.node_ids), n));
+    EXPECT_TRUE(is_permutation_of_nodes(NodeOrdering::hilbert_order(grid.lats, grid.lons, grid.node_ids), n));
+    EXPECT_TRUE(is_permutation_of_nodes(
+        NodeOrdering::traversal_order(grid.offsets, grid.targets, grid.rev_offsets, grid.rev_sources, false), n));
+    EXPECT_TRUE(is_permutation_of_nodes(
+        NodeOrdering::traversal_order(grid.offsets, grid.targets, grid.rev_offsets, grid.rev_sources, true), n));
+}
+
+// Id order sorts by OSM id, and inverse() undoes a permutation.
+TEST(NodeOrderTest, IdOrderAndInverse)
+{
+    const std::vector<long long> ids = {40, 10, 30, 20};
+    const std::vector<NodeIndex> order = NodeOrdering::id_order(ids);
+    EXPECT_EQ(order, (std::vector<NodeIndex>{1, 3, 2, 0}));
+    const std::vector<NodeIndex> index = NodeOrdering::inverse(order);
+    for (size_t i = 0; i < order.size(); ++i)
+        EXPECT_EQ(index[order[i]], i);
+}
+
+// Breadth-first and Cuthill-McKee orders of a grid have a bandwidth of about one row
+// (a diagonal), far below that of the shuffled numbering.
+TEST(NodeOrderTest, TraversalOrdersReduceBandwidth)
+{
+    Grid grid(40, 30, 2);
+    std::vector<NodeIndex> identity(grid.width * grid.height);
+    std::iota(identity.begin(), identity.end(), NodeIndex(0));
+    const size_t shuffled = grid.bandwidth(identity);
+
+    const auto bfs = NodeOrdering::traversal_order(grid.offsets, grid.targets, grid.rev_offsets, grid.rev_sources, false);
+    const auto rcm = NodeOrdering::traversal_order(grid.offsets, grid.targets, grid.rev_offsets, grid.rev_sources, true);
+    EXPECT_LE(grid.bandwidth(rcm), 2 * grid.height);
+    EXPECT_LE(grid.bandwidth(bfs), 2 * grid.height);
+    EXPECT_LT(grid.bandwidth(rcm) * 10, shuffled);
+}
+
+// Along the Hilbert order the mean index distance of neighbours is a small multiple of
+// the grid side rather than a third of the node count.
+TEST(NodeOrderTest, HilbertOrderKeepsNeighboursClose)
+{
+    Grid grid(64, 64, 3);
+    const auto order = NodeOrdering::hilbert_order(grid.lats, grid.lons, grid.node_ids);
+    const std::vector<NodeIndex> index = NodeOrdering::inverse(order);
+    double total = 0.0;
+    for (NodeIndex u = 0; u + 1 < grid.offsets.size(); ++u)
+        for (EdgeIndex e = grid.offsets[u]; e < grid.offsets[u + 1]; ++e)
+            total += std::abs(static_cast<double>(index[u]) - index[grid.targets[e]]);
+    EXPECT_LT(total / grid.targets.size(), 64.0);
+}
+
+// Disconnected components are numbered one after the other.
+TEST(NodeOrderTest, BreadthFirstCoversAllComponents)
+{
+    // Two paths 0-2-4 and 1-3, stored both ways
+    const std::vector<EdgeIndex> offsets = {0, 1, 2, 4, 5, 6};
+    const std::vector<NodeIndex> targets = {2, 3, 0, 4, 1, 2};
+    const auto order = NodeOrdering::traversal_order(offsets, targets, offsets, targets, false);
+    EXPECT_EQ(order, (std::vector<NodeIndex>{0, 2, 4, 1, 3}));
+}
@@ -0,0 +1,188 @@
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <gtest/gtest.h>
+#include <new>  // For std::bad_alloc
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "demo/astar.h"
+#include "demo/astar_engine_impl.h"  // search_HDA with a custom Stats policy
+#include "demo/landmarks.h"
+#include "road_network.h"
+#include "test_networks.h"
+#include "thread_pool.h"
+
+namespace
+{
+
+using SearchFunction = std::vector<long long> (*)(const RoadNetwork &, long long, long long, int);
+
+const std::vector<std::pair<std::string, SearchFunction>> &shared_table_searches()
+{
+    static const std::vector<std::pair<std::string, SearchFunction>> searches = {
+        {"TPool_CppLib", &AStarParallel::search_TPool_CppLib},
+        {"TVector_CppLib", &AStarParallel::search_TVector_CppLib},
+        {"TPool_PqFine", &AStarParallel::search_TPool_PqFine},
+        {"TVector_PqFine", &AStarParallel::search_TVector_PqFine},
+        {"TPool_MultiQueue", &AStarParallel::search_TPool_MultiQueue},
+        {"TVector_MultiQueue", &AStarParallel::search_TVector_MultiQueue},
+        {"HDA", &AStarParallel::search_HDA},
+    };
+    return searches;
+}
+
+// Stats policy that fails the search on the limit-th expansion, whichever worker makes it
+struct ThrowingStats : AStarEngine::NoStats
+{
+    std::atomic<int> expansions{0};
+    int limit = 0;
+
+    void on_expand()
+    {
+        if (expansions.fetch_add(1) + 1 == limit)
+            throw std::bad_alloc();
+    }
+};
+
+}  // namespace
+
+// A zero-weight cycle next to the start: ties must not re-parent the start or close a
+// parent cycle (the path walk used to loop until bad_alloc).
+TEST(ParallelSearchTest, ZeroWeightCycleAtStart)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::from_edges(
+        {{51.5, -0.1}, {51.5, -0.1}, {51.5, -0.1}}, {{0, 1, 0.0}, {1, 0, 0.0}, {1, 2, 1.0}});
+    const RoadNetwork network(test.graph, test.nodes);
+    const std::vector<long long> expected = {0, 1, 2};
+    EXPECT_EQ(AStar::search(network, 0, 2), expected);
+    for (const auto &[name, search] : shared_table_searches())
+        for (int threads : {1, 2, 4})
+            EXPECT_EQ(search(network, 0, 2, threads), expected) << name << " with " << threads << " threads";
+}
+
+// Every shared-table variant finds a shortest path (up to the float rounding of g) on
+// grids with zero-length edges.
+TEST(ParallelSearchTest, MatchesDijkstraWithZeroWeights)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::grid(20, 15, 11, 0.2);
+    const RoadNetwork network(test.graph, test.nodes);
+    for (size_t q = 0; q < 25; ++q)
+    {
+        const long long start = test.ids[(q * 97) % test.ids.size()];
+        const long long goal = test.ids[(q * 193 + 31) % test.ids.size()];
+        const double expected = TestNetworks::distance(test.graph, start, goal);
+        for (const auto &[name, search] : shared_table_searches())
+        {
+            const std::vector<long long> path = search(network, start, goal, 3);
+            if (expected == TestNetworks::INF)
+            {
+                EXPECT_TRUE(path.empty()) << name;
+                continue;
+            }
+            ASSERT_FALSE(path.empty()) << name;
+            EXPECT_EQ(path.front(), start) << name;
+            EXPECT_EQ(path.back(), goal) << name;
+            EXPECT_NEAR(TestNetworks::path_cost(test.graph, path), expected, 1e-5 * (1.0 + expected)) << name;
+        }
+    }
+}
+
+// An edge closed by a +infinity traffic update is never crossed: the goal behind it is
+// unreachable, not reached at g = infinity.
+TEST(ParallelSearchTest, ClosedEdgeIsNotCrossed)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::from_edges(
+        {{51.5, -0.1}, {51.5, -0.099}, {51.5, -0.098}}, {{0, 1, 100.0}, {1, 2, 100.0}});
+    RoadNetwork network(test.graph, test.nodes);
+    const std::vector<long long> sources = {1}, targets = {2};
+    const std::vector<double> closed = {std::numeric_limits<double>::infinity()};
+    ASSERT_EQ(network.update_traffic(sources, targets, closed), 1u);
+    EXPECT_TRUE(AStar::search(network, 0, 2).empty());
+    for (const auto &[name, search] : shared_table_searches())
+        EXPECT_TRUE(search(network, 0, 2, 2).empty()) << name;
+}
+
+// An exception in one HDA* worker ends the search on every worker and is rethrown to the
+// caller, instead of leaving the others waiting for its work.
+TEST(ParallelSearchTest, HdaWorkerExceptionIsRethrown)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::grid(20, 15, 3);
+    const RoadNetwork network(test.graph, test.nodes);
+    for (int limit : {1, 10, 60})
+        for (int threads : {2, 4})
+        {
+            ThrowingStats stats;
+            stats.limit = limit;
+            EXPECT_THROW((AStarEngine::search_HDA<AStarEngine::GreatCircleHeuristic, AStarEngine::EdgeWeightCost>(
+                             network, test.ids.front(), test.ids.back(), threads, stats)),
+                         std::bad_alloc)
+                << limit << " expansions, " << threads << " threads";
+        }
+
+    // The pool and the thread's search context are usable afterwards
+    const double expected = TestNetworks::distance(test.graph, test.ids.front(), test.ids.back());
+    EXPECT_NEAR(TestNetworks::path_cost(test.graph, AStarParallel::search_HDA(network, test.ids.front(), test.ids.back(), 4)),
+                expected, 1e-5 * (1.0 + expected));
+}
+
+// Bidirectional A* (two threads, meeting point and stopping rule of its own) finds a
+// shortest path on directed grids, with and without zero-weight edges, and with ALT
+// tables giving the two directions different bounds.
+TEST(ParallelSearchTest, BidirectionalMatchesDijkstra)
+{
+    ThreadPool::configure(4, false);
+    for (double zero_fraction : {0.0, 0.2})
+        for (bool alt : {false, true})
+        {
+            const TestNetworks::TestGraph test = TestNetworks::grid(22, 16, 17, zero_fraction);
+            RoadNetwork network(test.graph, test.nodes);
+            if (alt)
+                Landmarks::preprocess(network, 4, 2);
+            for (size_t q = 0; q < 40; ++q)
+            {
+                const long long start = test.ids[(q * 89 + 5) % test.ids.size()];
+                const long long goal = test.ids[(q * 151 + 47) % test.ids.size()];
+                const double expected = TestNetworks::distance(test.graph, start, goal);
+                const std::vector<long long> path = AStar::search_bidirectional(network, start, goal);
+                if (expected == TestNetworks::INF)
+                {
+                    EXPECT_TRUE(path.empty());
+                    continue;
+                }
+                ASSERT_FALSE(path.empty()) << start << " -> " << goal;
+                EXPECT_EQ(path.front(), start);
+                EXPECT_EQ(path.back(), goal);
+                EXPECT_NEAR(TestNetworks::path_cost(test.graph, path), expected, 1e-9 * (1.0 + expected))
+                    << start << " -> " << goal << (alt ? " with ALT" : "") << ", zero fraction " << zero_fraction;
+            }
+        }
+}
+
+// start == goal is the one-node path; a goal that only has outgoing edges, or sits
+// behind a closed edge, is unreachable.
+TEST(ParallelSearchTest, BidirectionalTrivialAndUnreachable)
+{
+    ThreadPool::configure(4, false);
+    const TestNetworks::TestGraph test = TestNetworks::from_edges(
+        {{51.5, -0.1}, {51.5, -0.099}, {51.5, -0.098}, {51.5, -0.097}},
+        {{0, 1, 100.0}, {1, 2, 100.0}, {3, 0, 100.0}});
+    RoadNetwork network(test.graph, test.nodes);
+    EXPECT_EQ(AStar::search_bidirectional(network, 1, 1), (std::vector<long long>{1}));
+    EXPECT_EQ(AStar::search_bidirectional(network, 3, 2), (std::vector<long long>{3, 0, 1, 2}));
+    EXPECT_TRUE(AStar::search_bidirectional(network, 0, 3).empty());
+    EXPECT_TRUE(AStar::search_bidirectional(network, 2, 0).empty());
+
+    const std::vector<long long> sources = {1}, targets = {2};
+    const std::vector<double> closed = {std::numeric_limits<double>::infinity()};
+    ASSERT_EQ(network.update_traffic(sources, targets, closed), 1u);
+    EXPECT_TRUE(AStar::search_bidirectional(network, 0, 2).empty());
+    EXPECT_THROW(AStar::search_bidirectional(network, 0, 42), std::runtime_error);
+}
@@ -0,0 +1,116 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>  // For std::mt19937
+#include <thread>
+#include <vector>
+
+#include "path_cache.h"
+
+// encode/decode round-trip paths with small, large and negative steps.
+TEST(PathCacheTest, CompressionRoundTrip)
+{
+    const std::vector<std::vector<NodeIndex>> paths = {
+        {},
+        {7},
+        {100, 101, 102, 99, 3, 0},
+        {0, std::numeric_limits<NodeIndex>::max() - 1, 5, 1u << 31},
+    };
+    for (const auto &path : paths)
+        EXPECT_EQ(PathCache::decode(PathCache::encode(path), path.size()), path);
+
+    // Steps between neighbouring indices take one byte each
+    std::vector<NodeIndex> local;
+    for (NodeIndex u = 5000; u < 5100; ++u)
+        local.push_back(u % 2 == 0 ? u : u + 40);
+    EXPECT_EQ(PathCache::encode(local).size(), local.size() + 1);  // The first delta takes two
+}
+
+// Hits only for the same (start, goal, version); replace and clear behave.
+TEST(PathCacheTest, FindInsertAndVersions)
+{
+    PathCache cache(64);
+    const std::vector<NodeIndex> path = {1, 4, 9};
+    EXPECT_FALSE(cache.find(1, 9, 0).has_value());
+    cache.insert(1, 9, 0, path, 12.5);
+
+    auto hit = cache.find(1, 9, 0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->path, path);
+    EXPECT_DOUBLE_EQ(hit->cost, 12.5);
+    EXPECT_FALSE(cache.find(1, 9, 1).has_value());  // Newer weights
+    EXPECT_FALSE(cache.find(9, 1, 0).has_value());  // Other direction
+
+    cache.insert(1, 9, 0, std::vector<NodeIndex>{1, 9}, 11.0);
+    EXPECT_EQ(cache.find(1, 9, 0)->path, (std::vector<NodeIndex>{1, 9}));
+
+    cache.insert(2, 3, 0, {}, std::numeric_limits<double>::infinity());  // Unreachable
+    EXPECT_TRUE(cache.find(2, 3, 0)->path.empty());
+
+    PathCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_EQ(stats.hits, 3u);
+    EXPECT_EQ(stats.misses, 3u);
+    EXPECT_EQ(stats.insertions, 3u);
+
+    cache.clear();
+    EXPECT_FALSE(cache.find(1, 9, 0).has_value());
+    stats = cache.stats();
+    EXPECT_EQ(stats.size, 0u);
+    EXPECT_EQ(stats.hits, 3u);
+}
+
+// The cache never holds more than its capacity, and the recently used entries survive.
+TEST(PathCacheTest, EvictsLeastRecentlyUsed)
+{
+    constexpr size_t capacity = 160;
+    PathCache cache(capacity);
+    const std::vector<NodeIndex> path = {0, 1};
+    for (NodeIndex goal = 0; goal < 1000; ++goal)
+    {
+        cache.insert(0, goal, 0, path, 1.0);
+        // Keep touching goal 0, so it stays the most recent entry of its shard
+        ASSERT_TRUE(cache.find(0, 0, 0).has_value());
+    }
+    const PathCache::Stats stats = cache.stats();
+    EXPECT_LE(stats.size, capacity);
+    EXPECT_EQ(stats.evictions, 1000u - stats.size);
+    EXPECT_TRUE(cache.find(0, 999, 0).has_value());  // Just inserted
+}
+
+// Concurrent readers and writers keep the counters consistent and return intact paths.
+TEST(PathCacheTest, ConcurrentAccess)
+{
+    PathCache cache(1024);
+    constexpr int threads = 8, rounds = 20000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back(
+            [&cache, t]
+            {
+                std::mt19937 gen(t);
+                std::uniform_int_distribution<NodeIndex> node(0, 200);
+                for (int i = 0; i < rounds; ++i)
+                {
+                    const NodeIndex start = node(gen), goal = node(gen);
+                    if (auto hit = cache.find(start, goal, 0))
+                    {
+                        ASSERT_EQ(hit->path, (std::vector<NodeIndex>{start, start + goal, goal}));
+                        ASSERT_EQ(hit->cost, double(start + goal));
+                    }
+                    else
+                    {
+                        const std::vector<NodeIndex> path = {start, start + goal, goal};
+                        cache.insert(start, goal, 0, path, double(start + goal));
+                    }
+                }
+            });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+    const PathCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, std::uint64_t(threads) * rounds);
+    EXPECT_EQ(stats.insertions, stats.misses);
+    EXPECT_LE(stats.size, cache.capacity());
+}
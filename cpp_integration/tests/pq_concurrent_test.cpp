@@ -12,6 +12,8 @@
 // Include the interface and the implementation to be tested
 #include "data_structure/ipq.h"
 #include "data_structure/pq_fine.h"  // Header containing the implementation
+#include "data_structure/pq_multiqueue.h"
+#include "data_structure/spin_lock.h"
 
 // --- Test Element Type ---
 // Using a pair to test: {priority, sequence_id}
@@ -83,7 +85,10 @@ protected:
 
 // Define the list of concurrent priority queue implementation types to be tested.
 using ConcurrentPriorityQueueImplementations = ::testing::Types<
-    DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement, ComparePriorityOnly>
+    DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement, ComparePriorityOnly>,
+    DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement, ComparePriorityOnly,
+                                                              DataStructure::SpinLock>,
+    DataStructure::PriorityQueue::MultiQueuePQ<TestPQElement, ComparePriorityOnly>
     // Add other concurrent implementations here later if needed
     >;
 
@@ -257,6 +262,68 @@ TYPED_TEST(ConcurrentPriorityQueueCorrectnessTest, ConcurrentMixedOpsInvariantCh
     SUCCEED() << "ConcurrentMixedOps completed and passed invariant check.";
 }
 
+// Tests concurrent push_bulk and pop_k: every pushed item is popped exactly once.
+TYPED_TEST(ConcurrentPriorityQueueCorrectnessTest, ConcurrentBulkPushPopK)
+{
+    std::vector<std::thread> threads;
+    int num_threads = this->DEFAULT_NUM_THREADS;
+    int ops_per_thread = this->OPS_PER_THREAD;
+    const int BATCH_SIZE = 5;
+    int total_items = num_threads * ops_per_thread;
+    std::vector<std::atomic<int>> popped(total_items);
+    std::atomic<int> pushers_done{0};
+
+    // Half the threads push batches of unique items, the other half drain with pop_k
+    for (int i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back(
+            [this, &popped, &pushers_done, i, num_threads, ops_per_thread]()
+            {
+                std::vector<TestPQElement> batch;
+                if (i % 2 == 0)
+                {
+                    // Each pusher covers two threads' worth of sequence ids
+                    int first_id = (i / 2) * 2 * ops_per_thread;
+                    for (int id = first_id; id < first_id + 2 * ops_per_thread; id += BATCH_SIZE)
+                    {
+                        batch.clear();
+                        for (int j = id; j < id + BATCH_SIZE; ++j)
+                        {
+                            batch.push_back({(j * 7919) % 100, j});
+                        }
+                        this->pq->push_bulk(batch);
+                    }
+                    pushers_done.fetch_add(1);
+                }
+                else
+                {
+                    int num_pushers = (num_threads + 1) / 2;
+                    while (pushers_done.load() < num_pushers || !this->pq->empty())
+                    {
+                        batch.clear();
+                        this->pq->pop_k(BATCH_SIZE, batch);
+                        for (const auto &item : batch)
+                        {
+                            popped[item.second].fetch_add(1);
+                        }
+                    }
+                }
+            });
+    }
+
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    for (int id = 0; id < total_items; ++id)
+    {
+        EXPECT_EQ(popped[id].load(), 1) << "Item " << id;
+    }
+    EXPECT_TRUE(this->pq->empty());
+    ASSERT_TRUE(this->pq->check_invariants());
+}
+
 // Stress test running for a fixed duration, checking for crashes and invariant violations.
 TYPED_TEST(ConcurrentPriorityQueueCorrectnessTest, StressTestDuration10Seconds)
 {
@@ -0,0 +1,240 @@
+#include <algorithm>  // For std::all_of, std::min_element
+#include <cstdint>
+#include <functional>  // For std::greater
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <type_traits>  // For std::integral_constant
+#include <vector>
+
+#include "data_structure/pq_indexed_dary.h"
+
+// --- Test Fixture ---
+// Min-heap keyed by double, the way the A* open sets use it.
+template <typename ArityConstant>
+class IndexedDaryHeapTest : public ::testing::Test
+{
+protected:
+    using Heap = DataStructure::PriorityQueue::IndexedDaryHeap<ArityConstant::value, double,
+                                                               std::greater<double>>;
+
+    static constexpr size_t CAPACITY = 1000;
+    Heap heap{CAPACITY};
+};
+
+// --- Test Suite Definition ---
+
+// Arities the A* benchmarks compare
+using HeapArities = ::testing::Types<std::integral_constant<size_t, 2>,
+                                     std::integral_constant<size_t, 4>,
+                                     std::integral_constant<size_t, 8>>;
+
+TYPED_TEST_SUITE(IndexedDaryHeapTest, HeapArities);
+
+// --- Typed Tests ---
+
+TYPED_TEST(IndexedDaryHeapTest, InitialIsEmpty)
+{
+    EXPECT_TRUE(this->heap.empty());
+    EXPECT_EQ(this->heap.size(), 0u);
+    EXPECT_EQ(this->heap.capacity(), TestFixture::CAPACITY);
+    EXPECT_FALSE(this->heap.contains(0));
+    ASSERT_TRUE(this->heap.check_invariants());
+}
+
+TYPED_TEST(IndexedDaryHeapTest, PopsInKeyOrder)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> key_dist(0.0, 1000.0);
+    for (std::uint32_t id = 0; id < TestFixture::CAPACITY; ++id)
+    {
+        this->heap.push(id, key_dist(gen));
+    }
+    EXPECT_EQ(this->heap.size(), TestFixture::CAPACITY);
+    ASSERT_TRUE(this->heap.check_invariants());
+
+    double last_key = -std::numeric_limits<double>::infinity();
+    std::vector<bool> seen(TestFixture::CAPACITY, false);
+    while (!this->heap.empty())
+    {
+        auto [id, key] = this->heap.pop();
+        EXPECT_LE(last_key, key);  // Smallest key first
+        EXPECT_FALSE(seen[id]);
+        EXPECT_FALSE(this->heap.contains(id));
+        seen[id] = true;
+        last_key = key;
+    }
+    EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](bool s) { return s; }));
+    ASSERT_TRUE(this->heap.check_invariants());
+}
+
+TYPED_TEST(IndexedDaryHeapTest, DecreaseKeyMovesEntryUp)
+{
+    for (std::uint32_t id = 0; id < 100; ++id)
+    {
+        this->heap.push(id, 100.0 + id);
+    }
+
+    this->heap.decrease_key(77, 1.0);
+    ASSERT_TRUE(this->heap.check_invariants());
+    EXPECT_EQ(this->heap.size(), 100u);  // Updated in place, no duplicate
+    EXPECT_DOUBLE_EQ(this->heap.key_of(77), 1.0);
+
+    auto [id, key] = this->heap.top();
+    EXPECT_EQ(id, 77u);
+    EXPECT_DOUBLE_EQ(key, 1.0);
+}
+
+TYPED_TEST(IndexedDaryHeapTest, PushOrDecreaseKeepsBestKey)
+{
+    EXPECT_TRUE(this->heap.push_or_decrease(5, 50.0));   // New entry
+    EXPECT_TRUE(this->heap.push_or_decrease(5, 20.0));   // Improvement
+    EXPECT_FALSE(this->heap.push_or_decrease(5, 30.0));  // Worse: ignored
+    EXPECT_FALSE(this->heap.push_or_decrease(5, 20.0));  // Equal: ignored
+
+    EXPECT_EQ(this->heap.size(), 1u);
+    EXPECT_DOUBLE_EQ(this->heap.key_of(5), 20.0);
+    ASSERT_TRUE(this->heap.check_invariants());
+
+    // Once popped the id can be pushed again (A* re-opening a closed node)
+    this->heap.pop();
+    EXPECT_TRUE(this->heap.push_or_decrease(5, 10.0));
+    EXPECT_TRUE(this->heap.contains(5));
+}
+
+TYPED_TEST(IndexedDaryHeapTest, ClearResetsOnlyStoredIds)
+{
+    for (std::uint32_t id = 0; id < 50; ++id)
+    {
+        this->heap.push(id * 3, static_cast<double>(id));
+    }
+    this->heap.pop();
+    this->heap.clear();
+
+    EXPECT_TRUE(this->heap.empty());
+    for (std::uint32_t id = 0; id < TestFixture::CAPACITY; ++id)
+    {
+        ASSERT_FALSE(this->heap.contains(id));
+    }
+    ASSERT_TRUE(this->heap.check_invariants());
+
+    // Reuse after clear behaves like a fresh heap
+    this->heap.push(3, 2.0);
+    this->heap.push(9, 1.0);
+    EXPECT_EQ(this->heap.pop().first, 9u);
+    EXPECT_EQ(this->heap.pop().first, 3u);
+}
+
+// Random mix of decrease-key and pop against a sorted reference
+TYPED_TEST(IndexedDaryHeapTest, RandomDecreaseKeyWorkload)
+{
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<std::uint32_t> id_dist(0, TestFixture::CAPACITY - 1);
+    std::uniform_real_distribution<double> key_dist(0.0, 1000.0);
+    std::vector<double> best(TestFixture::CAPACITY, std::numeric_limits<double>::infinity());
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (step % 3 != 2)
+        {
+            std::uint32_t id = id_dist(gen);
+            double key = key_dist(gen);
+            bool improved = key < best[id];
+            EXPECT_EQ(this->heap.push_or_decrease(id, key), improved);
+            if (improved)
+                best[id] = key;
+        }
+        else if (!this->heap.empty())
+        {
+            // The popped key must be the minimum over all stored ids
+            auto [id, key] = this->heap.pop();
+            EXPECT_DOUBLE_EQ(key, *std::min_element(best.begin(), best.end()));
+            best[id] = std::numeric_limits<double>::infinity();
+        }
+    }
+    ASSERT_TRUE(this->heap.check_invariants());
+}
+
+TYPED_TEST(IndexedDaryHeapTest, UpdateKeyMovesBothWays)
+{
+    for (std::uint32_t id = 0; id < 100; ++id)
+    {
+        this->heap.push(id, static_cast<double>(id));
+    }
+
+    this->heap.update_key(0, 500.0);  // Lowered priority: sifts down
+    ASSERT_TRUE(this->heap.check_invariants());
+    EXPECT_EQ(this->heap.top().first, 1u);
+
+    this->heap.update_key(99, -1.0);  // Raised priority: sifts up
+    ASSERT_TRUE(this->heap.check_invariants());
+    EXPECT_EQ(this->heap.top().first, 99u);
+    EXPECT_EQ(this->heap.size(), 100u);
+}
+
+TYPED_TEST(IndexedDaryHeapTest, EraseRemovesArbitraryIds)
+{
+    for (std::uint32_t id = 0; id < 100; ++id)
+    {
+        this->heap.push(id, static_cast<double>((id * 37) % 100));
+    }
+    for (std::uint32_t id = 0; id < 100; id += 3)
+    {
+        this->heap.erase(id);
+        ASSERT_TRUE(this->heap.check_invariants());
+        EXPECT_FALSE(this->heap.contains(id));
+    }
+    EXPECT_EQ(this->heap.size(), 66u);
+
+    // The remaining ids still pop in key order
+    double previous = -1.0;
+    while (!this->heap.empty())
+    {
+        auto [id, key] = this->heap.pop();
+        EXPECT_NE(id % 3, 0u);
+        EXPECT_GE(key, previous);
+        previous = key;
+    }
+}
+
+// Random mix of push, update_key, erase and pop against a reference array
+TYPED_TEST(IndexedDaryHeapTest, RandomUpdateEraseWorkload)
+{
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<std::uint32_t> id_dist(0, TestFixture::CAPACITY - 1);
+    std::uniform_real_distribution<double> key_dist(0.0, 1000.0);
+    const double absent = std::numeric_limits<double>::infinity();
+    std::vector<double> stored(TestFixture::CAPACITY, absent);
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        std::uint32_t id = id_dist(gen);
+        double key = key_dist(gen);
+        switch (step % 4)
+        {
+        case 0:
+        case 1:
+            if (this->heap.contains(id))
+                this->heap.update_key(id, key);
+            else
+                this->heap.push(id, key);
+            stored[id] = key;
+            break;
+        case 2:
+            if (this->heap.contains(id))
+            {
+                this->heap.erase(id);
+                stored[id] = absent;
+            }
+            break;
+        default:
+            if (!this->heap.empty())
+            {
+                auto [top_id, top_key] = this->heap.pop();
+                EXPECT_DOUBLE_EQ(top_key, *std::min_element(stored.begin(), stored.end()));
+                stored[top_id] = absent;
+            }
+        }
+    }
+    ASSERT_TRUE(this->heap.check_invariants());
+}
@@ -1,4 +1,6 @@
+#include <algorithm>  // For std::all_of
 #include <gtest/gtest.h>
+#include <limits>
 #include <optional>
 #include <utility>  // For std::pair
 #include <vector>
@@ -6,6 +8,8 @@
 // Include the interface and the implementation to be tested
 #include "data_structure/ipq.h"
 #include "data_structure/pq_fine.h"  // Header containing the implementation
+#include "data_structure/pq_multiqueue.h"
+#include "data_structure/spin_lock.h"
 
 // --- Test Element Type ---
 // Using a pair to test FIFO: {priority, sequence_id}
@@ -74,7 +78,9 @@ protected:
 // Define the list of priority queue implementation types to be tested sequentially.
 // Add other sequential/concurrent implementations here later if needed for logic tests.
 using PriorityQueueImplementations = ::testing::Types<
-    DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement, ComparePriorityOnly>>;
+    DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement, ComparePriorityOnly>,
+    DataStructure::PriorityQueue::SortedLinkedList_FineLockPQ<TestPQElement, ComparePriorityOnly,
+                                                              DataStructure::SpinLock>>;
 
 // Register the typed test suite
 TYPED_TEST_SUITE(SequentialPriorityQueueLogicTest, PriorityQueueImplementations);
@@ -288,3 +294,172 @@ TYPED_TEST(SequentialPriorityQueueLogicTest, LargeDataSet)
     EXPECT_EQ(this->pq->size(), 0);
     ASSERT_TRUE(this->pq->check_invariants());
 }
+
+// push_bulk must leave the queue exactly as the same pushes one by one would, including
+// the FIFO order of equal priorities within the batch and against queued elements.
+TYPED_TEST(SequentialPriorityQueueLogicTest, PushBulkMatchesSinglePushes)
+{
+    using PQType = TypeParam;
+    PQType reference;
+    const std::vector<TestPQElement> queued = {{5, 1}, {2, 2}, {8, 3}};
+    const std::vector<TestPQElement> batch = {{5, 4}, {9, 5}, {2, 6}, {5, 7}, {0, 8}, {9, 9}};
+    for (const auto &val : queued)
+    {
+        this->pq->push(val);
+        reference.push(val);
+    }
+    this->pq->push_bulk(batch);
+    for (const auto &val : batch)
+    {
+        reference.push(val);
+    }
+
+    EXPECT_EQ(this->pq->size(), queued.size() + batch.size());
+    ASSERT_TRUE(this->pq->check_invariants());
+    while (std::optional<TestPQElement> expected = reference.pop())
+    {
+        std::optional<TestPQElement> popped = this->pq->pop();
+        ASSERT_TRUE(popped.has_value());
+        EXPECT_EQ(popped.value(), expected.value());
+    }
+    EXPECT_TRUE(this->pq->empty());
+
+    this->pq->push_bulk({});  // Empty batch is a no-op
+    EXPECT_TRUE(this->pq->empty());
+}
+
+// pop_k returns what k pops would, in pop order, and stops early when the queue runs empty.
+TYPED_TEST(SequentialPriorityQueueLogicTest, PopKMatchesSinglePops)
+{
+    using PQType = TypeParam;
+    PQType reference;
+    for (int i = 0; i < 200; ++i)
+    {
+        TestPQElement val = {(i * 37) % 23, i};
+        this->pq->push(val);
+        reference.push(val);
+    }
+
+    std::vector<TestPQElement> out;
+    for (size_t k : {0u, 1u, 2u, 7u, 50u, 300u})
+    {
+        out.clear();
+        size_t expected_count = std::min(k, reference.size());
+        EXPECT_EQ(this->pq->pop_k(k, out), expected_count);
+        ASSERT_EQ(out.size(), expected_count);
+        for (const auto &val : out)
+        {
+            EXPECT_EQ(val, reference.pop().value());
+        }
+        EXPECT_EQ(this->pq->size(), reference.size());
+        ASSERT_TRUE(this->pq->check_invariants());
+    }
+    EXPECT_TRUE(this->pq->empty());
+    out.clear();
+    EXPECT_EQ(this->pq->pop_k(4, out), 0u);
+    EXPECT_TRUE(out.empty());
+}
+
+// --- Relaxed Priority Queue Tests ---
+// MultiQueuePQ only approximates priority order, so it is not part of the typed suite above.
+
+using TestMultiQueue = DataStructure::PriorityQueue::MultiQueuePQ<TestPQElement, ComparePriorityOnly>;
+
+// With a single internal heap the relaxation disappears and pops are exact.
+TEST(MultiQueuePQLogicTest, SingleHeapPopsInPriorityOrder)
+{
+    TestMultiQueue pq(1);
+    for (int i = 0; i < 1000; ++i)
+    {
+        pq.push({(i * 7919) % 1000, i});
+    }
+    ASSERT_TRUE(pq.check_invariants());
+
+    int last_priority = std::numeric_limits<int>::max();
+    size_t pop_count = 0;
+    while (std::optional<TestPQElement> popped = pq.pop())
+    {
+        EXPECT_LE(popped->first, last_priority);
+        last_priority = popped->first;
+        pop_count++;
+    }
+    EXPECT_EQ(pop_count, 1000u);
+    EXPECT_TRUE(pq.empty());
+}
+
+// Relaxed pops may come out of order, but every element must come out exactly once.
+TEST(MultiQueuePQLogicTest, RelaxedPopsReturnEveryElement)
+{
+    TestMultiQueue pq(8);
+    const int num_elements = 5000;
+    for (int i = 0; i < num_elements; ++i)
+    {
+        pq.push({rand() % 1000, i});
+    }
+    EXPECT_EQ(pq.size(), static_cast<size_t>(num_elements));
+    ASSERT_TRUE(pq.check_invariants());
+
+    std::vector<bool> seen(num_elements, false);
+    while (std::optional<TestPQElement> popped = pq.pop())
+    {
+        ASSERT_FALSE(seen[popped->second]);
+        seen[popped->second] = true;
+    }
+    EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](bool s) { return s; }));
+    EXPECT_TRUE(pq.empty());
+    EXPECT_FALSE(pq.pop().has_value());
+    ASSERT_TRUE(pq.check_invariants());
+}
+
+// Batched operations keep the relaxed guarantee: every element comes out exactly once,
+// and with a single heap pop_k is exact.
+TEST(MultiQueuePQLogicTest, PushBulkPopKReturnEveryElement)
+{
+    TestMultiQueue single(1);
+    std::vector<TestPQElement> batch;
+    for (int i = 0; i < 100; ++i)
+    {
+        batch.push_back({(i * 7919) % 100, i});
+    }
+    single.push_bulk(batch);
+    ASSERT_TRUE(single.check_invariants());
+    std::vector<TestPQElement> out;
+    EXPECT_EQ(single.pop_k(100, out), 100u);
+    EXPECT_TRUE(std::is_sorted(out.begin(), out.end(),
+                               [](const TestPQElement &a, const TestPQElement &b) { return a.first > b.first; }));
+    EXPECT_TRUE(single.empty());
+
+    TestMultiQueue pq(8);
+    const int num_elements = 5000;
+    for (int i = 0; i < num_elements; i += 10)
+    {
+        batch.clear();
+        for (int j = i; j < i + 10; ++j)
+        {
+            batch.push_back({rand() % 1000, j});
+        }
+        pq.push_bulk(batch);
+    }
+    EXPECT_EQ(pq.size(), static_cast<size_t>(num_elements));
+    ASSERT_TRUE(pq.check_invariants());
+
+    std::vector<bool> seen(num_elements, false);
+    size_t popped = 0;
+    while (!pq.empty())
+    {
+        out.clear();
+        size_t taken = pq.pop_k(7, out);
+        ASSERT_GT(taken, 0u);
+        ASSERT_EQ(out.size(), taken);
+        for (const auto &val : out)
+        {
+            ASSERT_FALSE(seen[val.second]);
+            seen[val.second] = true;
+        }
+        popped += taken;
+    }
+    EXPECT_EQ(popped, static_cast<size_t>(num_elements));
+    out.clear();
+    EXPECT_EQ(pq.pop_k(7, out), 0u);
+    ASSERT_TRUE(pq.check_invariants());
+}
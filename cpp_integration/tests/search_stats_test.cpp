@@ -0,0 +1,121 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "demo/astar.h"
+#include "demo/search_stats.h"
+#include "road_network.h"
+#include "test_networks.h"
+#include "thread_pool.h"
+
+namespace
+{
+
+using AStarEngine::LockSite;
+using AStarEngine::Phase;
+using AStarEngine::SearchStats;
+using AStarEngine::StatsRecorder;
+using Heuristic = AStarEngine::GreatCircleHeuristic;
+using Cost = AStarEngine::EdgeWeightCost;
+
+size_t index(Phase phase) { return static_cast<size_t>(phase); }
+
+size_t index(LockSite site) { return static_cast<size_t>(site); }
+
+// Invariants every engine keeps: the open set never holds more than was pushed, every
+// expansion came from a pop, and the setup and search phases were timed
+void expect_common(const SearchStats &stats)
+{
+    EXPECT_GT(stats.expanded, 0u);
+    EXPECT_GE(stats.pushes, stats.expanded);
+    EXPECT_GE(stats.pops, stats.expanded + stats.stale_pops);
+    EXPECT_GE(stats.peak_open, 1u);
+    EXPECT_LE(stats.peak_open, stats.pushes);
+    EXPECT_LE(stats.reopened, stats.expanded);
+    EXPECT_GT(stats.phase_ns[index(Phase::SETUP)], 0u);
+    EXPECT_GT(stats.phase_ns[index(Phase::SEARCH)], 0u);
+    EXPECT_GT(stats.phase_ns[index(Phase::PATH)], 0u);
+}
+
+class SearchStatsTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ThreadPool::configure(4, false);
+        test_ = TestNetworks::grid(20, 15, 41);
+        network_ = std::make_unique<RoadNetwork>(test_.graph, test_.nodes);
+        start_ = test_.ids[3];
+        goal_ = test_.ids[test_.ids.size() - 5];
+        ASSERT_NE(TestNetworks::distance(test_.graph, start_, goal_), TestNetworks::INF);
+    }
+
+    // The recorded search must still return a shortest path
+    void expect_shortest(const std::vector<long long> &path, double tolerance = 1e-9) const
+    {
+        const double expected = TestNetworks::distance(test_.graph, start_, goal_);
+        EXPECT_NEAR(TestNetworks::path_cost(test_.graph, path), expected, tolerance * expected);
+    }
+
+    TestNetworks::TestGraph test_;
+    std::unique_ptr<RoadNetwork> network_;
+    long long start_ = 0, goal_ = 0;
+};
+
+}  // namespace
+
+// The goal is popped once and never expanded: pops = expanded + stale pops + 1.
+TEST_F(SearchStatsTest, Sequential)
+{
+    StatsRecorder recorder;
+    expect_shortest(AStarEngine::search<Heuristic, Cost, AStarEngine::DefaultOpenSet>(*network_, start_, goal_, recorder));
+    const SearchStats stats = recorder.result();
+    expect_common(stats);
+    EXPECT_EQ(stats.pops, stats.expanded + stats.stale_pops + 1);
+    EXPECT_EQ(stats.messages, 0u);
+    EXPECT_EQ(stats.phase_ns[index(Phase::PARALLEL_RELAX)], 0u);
+}
+
+// Both directions expand what they pop and share the meeting-point lock.
+TEST_F(SearchStatsTest, Bidirectional)
+{
+    StatsRecorder recorder;
+    expect_shortest(AStarEngine::search_bidirectional<Heuristic, Cost>(*network_, start_, goal_, recorder));
+    const SearchStats stats = recorder.result();
+    expect_common(stats);
+    EXPECT_EQ(stats.pops, stats.expanded);
+    EXPECT_EQ(stats.stale_pops, 0u);
+    EXPECT_GT(stats.lock_acquisitions[index(LockSite::MEETING_POINT)], 0u);
+}
+
+// Fork-join CppLib: every push and pop goes through the open-set lock, and the
+// relaxation phase is part of the search phase.
+TEST_F(SearchStatsTest, ForkJoinCppLib)
+{
+    StatsRecorder recorder;
+    expect_shortest(AStarEngine::search_TPool_CppLib<Heuristic, Cost>(*network_, start_, goal_, 4, recorder), 1e-5);
+    const SearchStats stats = recorder.result();
+    expect_common(stats);
+    EXPECT_EQ(stats.pops, stats.expanded + stats.stale_pops + 1);
+    // The start is pushed without the lock; every other push and every pop takes it
+    EXPECT_EQ(stats.lock_acquisitions[index(LockSite::OPEN_SET)], stats.pushes - 1 + stats.pops);
+    EXPECT_GT(stats.phase_ns[index(Phase::PARALLEL_RELAX)], 0u);
+    EXPECT_LE(stats.phase_ns[index(Phase::PARALLEL_RELAX)], stats.phase_ns[index(Phase::SEARCH)]);
+}
+
+// HDA* with several workers sends successors to other workers; the goal is never pushed,
+// so no pop is left over.
+TEST_F(SearchStatsTest, HdaMessages)
+{
+    StatsRecorder recorder;
+    expect_shortest(AStarEngine::search_HDA<Heuristic, Cost>(*network_, start_, goal_, 4, recorder));
+    const SearchStats stats = recorder.result();
+    expect_common(stats);
+    EXPECT_EQ(stats.pops, stats.expanded + stats.stale_pops);
+    EXPECT_GT(stats.messages, 0u);
+
+    StatsRecorder single;
+    AStarEngine::search_HDA<Heuristic, Cost>(*network_, start_, goal_, 1, single);
+    EXPECT_EQ(single.result().messages, 0u);
+}
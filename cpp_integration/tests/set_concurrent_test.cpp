@@ -15,6 +15,9 @@
 #include "data_structure/iset.h"
 #include "data_structure/set_coarse.h"
 #include "data_structure/set_fine.h"
+#include "data_structure/set_lazy.h"
+#include "data_structure/set_optimistic.h"
+#include "data_structure/spin_lock.h"
 
 // Define the type for the elements in the set for testing
 using TestSetElement = int;
@@ -43,7 +46,13 @@ protected:
 // Define the list of concurrent set implementation types to be tested
 using ConcurrentSetImplementations =
     ::testing::Types<DataStructure::Set::SortedLinkedList_CoarseLock<TestSetElement>,
-                     DataStructure::Set::SortedLinkedList_FineLock<TestSetElement>
+                     DataStructure::Set::SortedLinkedList_FineLock<TestSetElement>,
+                     DataStructure::Set::SortedLinkedList_FineLock<TestSetElement,
+                                                                   DataStructure::SpinLock>,
+                     DataStructure::Set::SortedLinkedList_Optimistic<TestSetElement>,
+                     DataStructure::Set::SortedLinkedList_Lazy<TestSetElement>,
+                     DataStructure::Set::SortedLinkedList_Lazy<TestSetElement,
+                                                               DataStructure::SpinLock>
                      // Add future concurrent implementations here
                      >;
 
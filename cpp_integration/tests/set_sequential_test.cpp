@@ -10,7 +10,10 @@
 #include "data_structure/iset.h"
 #include "data_structure/set_coarse.h"  // Included to allow testing sequential logic
 #include "data_structure/set_fine.h"    // Included to allow testing sequential logic
+#include "data_structure/set_lazy.h"
+#include "data_structure/set_optimistic.h"
 #include "data_structure/set_sequential.h"
+#include "data_structure/spin_lock.h"
 
 // Define the type for the elements in the set for testing
 using TestSetElement = int;
@@ -38,7 +41,11 @@ protected:
 using AllSetImplementations =
     ::testing::Types<DataStructure::Set::SortedLinkedList_Sequential<TestSetElement>,
                      DataStructure::Set::SortedLinkedList_CoarseLock<TestSetElement>,
-                     DataStructure::Set::SortedLinkedList_FineLock<TestSetElement>>;
+                     DataStructure::Set::SortedLinkedList_FineLock<TestSetElement>,
+                     DataStructure::Set::SortedLinkedList_FineLock<TestSetElement,
+                                                                   DataStructure::SpinLock>,
+                     DataStructure::Set::SortedLinkedList_Optimistic<TestSetElement>,
+                     DataStructure::Set::SortedLinkedList_Lazy<TestSetElement>>;
 
 // Register the typed test suite
 TYPED_TEST_SUITE(SequentialSetLogicTest, AllSetImplementations);
@@ -0,0 +1,119 @@
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numbers>
+#include <random>  // For std::mt19937
+#include <vector>
+
+#include "spatial_index.h"
+
+namespace
+{
+
+struct Points
+{
+    std::vector<double> lats, lons;
+
+    void add(double lat, double lon)
+    {
+        lats.push_back(lat);
+        lons.push_back(lon);
+    }
+};
+
+// Linear scan with the same distance and tie rule as SpatialIndex::nearest
+NodeIndex brute_force_nearest(const Points &points, double lat, double lon)
+{
+    constexpr double to_rad = std::numbers::pi / 180.0;
+    NodeIndex best_node = INVALID_NODE_INDEX;
+    double best = std::numeric_limits<double>::infinity();
+    for (NodeIndex u = 0; u < points.lats.size(); ++u)
+    {
+        const double d = GeoCoordinates::haversine_km(lat * to_rad, lon * to_rad, std::cos(lat * to_rad),
+                                                      points.lats[u] * to_rad, points.lons[u] * to_rad,
+                                                      std::cos(points.lats[u] * to_rad));
+        if (d < best)
+        {
+            best = d;
+            best_node = u;
+        }
+    }
+    return best_node;
+}
+
+// A city-sized cloud: a dense core, sparse suburbs and a few far outliers
+Points random_city(size_t count, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::normal_distribution<double> core(0.0, 0.01);
+    std::uniform_real_distribution<double> suburb(-0.2, 0.2);
+    Points points;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i % 97 == 0)
+            points.add(51.5 + suburb(gen) * 5, -0.1 + suburb(gen) * 5);
+        else if (i % 3 == 0)
+            points.add(51.5 + suburb(gen), -0.1 + suburb(gen));
+        else
+            points.add(51.5 + core(gen), -0.1 + core(gen));
+    }
+    return points;
+}
+
+}  // namespace
+
+// Queries inside, around and far outside the node cloud agree with a linear scan.
+TEST(SpatialIndexTest, NearestMatchesBruteForce)
+{
+    const Points points = random_city(5000, 1);
+    const SpatialIndex index(points.lats, points.lons);
+    ASSERT_EQ(index.size(), points.lats.size());
+    EXPECT_GT(index.num_cells(), 100u);
+
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<double> near(-0.3, 0.3), far(-5.0, 5.0);
+    for (int q = 0; q < 2000; ++q)
+    {
+        const double spread = q % 10 == 0 ? far(gen) : near(gen);
+        const double lat = 51.5 + spread, lon = -0.1 + (q % 10 == 0 ? far(gen) : near(gen));
+        EXPECT_EQ(index.nearest(lat, lon), brute_force_nearest(points, lat, lon)) << lat << ", " << lon;
+    }
+}
+
+// A point at a node's exact position snaps to it.
+TEST(SpatialIndexTest, NodePositionsSnapToThemselves)
+{
+    const Points points = random_city(1000, 3);
+    const SpatialIndex index(points.lats, points.lons);
+    for (NodeIndex u = 0; u < points.lats.size(); ++u)
+    {
+        const NodeIndex v = index.nearest(points.lats[u], points.lons[u]);
+        EXPECT_TRUE(v == u || (points.lats[v] == points.lats[u] && points.lons[v] == points.lons[u]));
+    }
+}
+
+// Degenerate inputs: no nodes, one node, nodes on a line, duplicates (lowest index wins).
+TEST(SpatialIndexTest, DegenerateInputs)
+{
+    const SpatialIndex empty({}, {});
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.nearest(0.0, 0.0), INVALID_NODE_INDEX);
+
+    Points single;
+    single.add(35.69, 139.70);
+    EXPECT_EQ(SpatialIndex(single.lats, single.lons).nearest(-80.0, 10.0), 0u);
+
+    Points line;
+    for (int i = 0; i < 100; ++i)
+        line.add(35.0 + 0.001 * i, 139.0);
+    const SpatialIndex line_index(line.lats, line.lons);
+    EXPECT_EQ(line_index.nearest(35.0504, 139.001), 50u);
+    EXPECT_EQ(line_index.nearest(34.0, 139.0), 0u);
+
+    Points duplicates;
+    duplicates.add(10.0, 10.0);
+    duplicates.add(10.0, 10.0);
+    duplicates.add(11.0, 11.0);
+    duplicates.add(10.0, 10.0);
+    EXPECT_EQ(SpatialIndex(duplicates.lats, duplicates.lons).nearest(10.1, 10.1), 0u);
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>  // For std::max, std::min
+#include <cmath>
+#include <functional>  // For std::greater
+#include <limits>
+#include <queue>
+#include <random>  // For std::mt19937
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "graph_types.h"
+
+// Small graphs and a reference Dijkstra for the search engine tests.
+namespace TestNetworks
+{
+
+inline constexpr double INF = std::numeric_limits<double>::infinity();
+
+// Meters between two nodes (haversine), so that edge weights keep the great-circle
+// heuristic admissible
+inline double meters(const Node &a, const Node &b)
+{
+    constexpr double EARTH_RADIUS = 6371000.0, DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+    const double dlat = (b.lat - a.lat) * DEG_TO_RAD, dlon = (b.lon - a.lon) * DEG_TO_RAD;
+    const double h = std::sin(dlat / 2) * std::sin(dlat / 2)
+                     + std::cos(a.lat * DEG_TO_RAD) * std::cos(b.lat * DEG_TO_RAD) * std::sin(dlon / 2)
+                           * std::sin(dlon / 2);
+    return 2 * EARTH_RADIUS * std::asin(std::sqrt(h));
+}
+
+struct TestGraph
+{
+    Graph graph;
+    NodeMap nodes;
+    std::vector<long long> ids;  // In insertion order
+};
+
+// width x height grid (ids 1000 + 7 * k) with 4-neighbour edges, each missing with
+// probability 0.1 and otherwise weighing 1-1.5x its length. A zero_fraction of the nodes
+// sits on the previous node of its row (same coordinates), joined to it by 0-weight edges
+// both ways, so zero-length edges and ties appear.
+inline TestGraph grid(int width, int height, unsigned seed, double zero_fraction = 0.0)
+{
+    TestGraph test;
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    auto id = [width](int x, int y) { return 1000LL + static_cast<long long>(y * width + x) * 7; };
+    std::vector<bool> merged(static_cast<size_t>(width * height), false);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+        {
+            const long long u = id(x, y);
+            const bool zero = x > 0 && unit(gen) < zero_fraction;
+            merged[static_cast<size_t>(y * width + x)] = zero;
+            const Node previous = x > 0 ? test.nodes.at(id(x - 1, y)) : Node();
+            test.nodes.emplace(u, zero ? Node(u, previous.lat, previous.lon)
+                                       : Node(u, 51.5 + y * 0.0009, -0.1 + x * 0.0014));
+            test.graph[u];
+            test.ids.push_back(u);
+        }
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+        {
+            const int dx[] = {1, -1, 0, 0}, dy[] = {0, 0, 1, -1};
+            for (int k = 0; k < 4; ++k)
+            {
+                const int nx = x + dx[k], ny = y + dy[k];
+                if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+                    continue;
+                const long long a = id(x, y), b = id(nx, ny);
+                const bool zero_pair = ny == y && merged[static_cast<size_t>(y * width + std::max(x, nx))];
+                if (zero_pair)
+                {
+                    test.graph[a].emplace_back(b, 0.0);
+                    continue;
+                }
+                if (unit(gen) < 0.1)
+                    continue;
+                test.graph[a].emplace_back(b, meters(test.nodes.at(a), test.nodes.at(b)) * (1.0 + 0.5 * unit(gen)));
+            }
+        }
+    return test;
+}
+
+// Graph from (from, to, weight) triples; node k gets id k and sits at (lat, lon) of nodes[k]
+inline TestGraph from_edges(const std::vector<std::pair<double, double>> &coordinates,
+                            const std::vector<std::tuple<long long, long long, double>> &edges)
+{
+    TestGraph test;
+    for (size_t k = 0; k < coordinates.size(); ++k)
+    {
+        const long long u = static_cast<long long>(k);
+        test.nodes.emplace(u, Node(u, coordinates[k].first, coordinates[k].second));
+        test.graph[u];
+        test.ids.push_back(u);
+    }
+    for (const auto &[from, to, weight] : edges)
+        test.graph[from].emplace_back(to, weight);
+    return test;
+}
+
+// Shortest distances from source to every node, INF where unreachable
+inline std::unordered_map<long long, double> dijkstra(const Graph &graph, long long source)
+{
+    std::unordered_map<long long, double> dist;
+    using Item = std::pair<double, long long>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+    dist[source] = 0.0;
+    queue.push({0.0, source});
+    while (!queue.empty())
+    {
+        const auto [d, u] = queue.top();
+        queue.pop();
+        if (d > dist[u])
+            continue;
+        auto it = graph.find(u);
+        if (it == graph.end())
+            continue;
+        for (const Edge &edge : it->second)
+        {
+            const double candidate = d + edge.weight;
+            auto [entry, inserted] = dist.try_emplace(edge.target_node_id, candidate);
+            if (inserted || candidate < entry->second)
+            {
+                entry->second = candidate;
+                queue.push({candidate, edge.target_node_id});
+            }
+        }
+    }
+    return dist;
+}
+
+inline double distance(const Graph &graph, long long source, long long target)
+{
+    const auto dist = dijkstra(graph, source);
+    auto it = dist.find(target);
+    return it == dist.end() ? INF : it->second;
+}
+
+// Cost of a path along the cheapest parallel edge of each step; INF for an empty path,
+// NaN if a step is not an edge
+inline double path_cost(const Graph &graph, const std::vector<long long> &path)
+{
+    if (path.empty())
+        return INF;
+    double cost = 0.0;
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        double best = INF;
+        for (const Edge &edge : graph.at(path[i - 1]))
+            if (edge.target_node_id == path[i])
+                best = std::min(best, edge.weight);
+        if (best == INF)
+            return std::numeric_limits<double>::quiet_NaN();
+        cost += best;
+    }
+    return cost;
+}
+
+}  // namespace TestNetworks